@@ -42,6 +42,20 @@ function(td_set_up_compiler)
     message(FATAL_ERROR "No C++14 support in the compiler. Please upgrade the compiler.")
   endif()
 
+  # coroutines require C++20, so the whole project is compiled as C++20 if they are enabled
+  if (TD_ENABLE_COROUTINES)
+    if (GCC OR CLANG)
+      check_cxx_compiler_flag(-std=c++20 HAVE_STD20)
+    endif()
+    if (HAVE_STD20)
+      # u8 string literals must keep type const char[]
+      set(STD14_FLAG "-std=c++20 -fno-char8_t")
+      set(TD_HAVE_COROUTINES 1 PARENT_SCOPE)
+    else()
+      message(WARNING "Coroutines are disabled, because the compiler doesn't support -std=c++20")
+    endif()
+  endif()
+
   if (MSVC)
     if (CMAKE_CXX_FLAGS_DEBUG MATCHES "/RTC1")
       string(REPLACE "/RTC1" " " CMAKE_CXX_FLAGS_DEBUG "${CMAKE_CXX_FLAGS_DEBUG}")
@@ -6,6 +6,8 @@
 //
 #include "td/actor/actor.h"
 #include "td/actor/ConcurrentScheduler.h"
+#include "td/actor/Coroutine.h"
+#include "td/actor/MultiPromise.h"
 #include "td/actor/PromiseFuture.h"
 
 #include "td/utils/benchmark.h"
@@ -14,11 +16,40 @@
 #include "td/utils/logging.h"
 #include "td/utils/Promise.h"
 #include "td/utils/SliceBuilder.h"
+#include "td/utils/Time.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
 
 #if TD_MSVC
 #pragma comment(linker, "/STACK:16777216")
 #endif
 
+static std::atomic<td::uint64> allocation_count;
+
+void *operator new(std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  auto ptr = std::malloc(size == 0 ? 1 : size);
+  if (ptr == nullptr) {
+    std::abort();
+  }
+  return ptr;
+}
+
+void operator delete(void *ptr) noexcept {
+  std::free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept {
+  std::free(ptr);
+}
+
+static td::uint64 get_allocation_count() {
+  return allocation_count.load(std::memory_order_relaxed);
+}
+
 struct TestActor final : public td::Actor {
   static td::int32 actor_count_;
 
@@ -83,12 +114,14 @@ class RingBench final : public td::Benchmark {
   int thread_n_ = -1;
   td::vector<td::ActorId<PassActor>> actor_array_;
   td::unique_ptr<td::ConcurrentScheduler> scheduler_;
+  double allocations_per_event_ = 0.0;
 
  public:
   td::string get_description() const final {
     static const char *types[] = {"later", "immediate", "raw", "tail", "lambda"};
     static_assert(0 <= type && type < 5, "");
-    return PSTRING() << "Ring (send_" << types[type] << ") (threads_n = " << thread_n_ << ")";
+    return PSTRING() << "Ring (send_" << types[type] << ") (threads_n = " << thread_n_
+                     << ", allocations per event = " << allocations_per_event_ << ")";
   }
 
   struct PassActor final : public td::Actor {
@@ -157,10 +190,14 @@ class RingBench final : public td::Benchmark {
 
   void run(int n) final {
     // first actor is on main_thread
-    actor_array_[0].get_actor_unsafe()->start_n = td::max(n, 100);
+    auto event_count = td::max(n, 100);
+    auto begin_allocation_count = get_allocation_count();
+    actor_array_[0].get_actor_unsafe()->start_n = event_count;
     while (scheduler_->run_main(10)) {
       // empty
     }
+    allocations_per_event_ =
+        static_cast<double>(get_allocation_count() - begin_allocation_count) / static_cast<double>(event_count);
   }
 
   void tear_down() final {
@@ -324,7 +361,446 @@ class QueryBench final : public td::Benchmark {
   td::ActorOwn<ServerActor> server_;
 };
 
+template <bool use_work_stealing>
+class SkewedLoadBench final : public td::Benchmark {
+ public:
+  static constexpr int THREAD_COUNT = 4;
+  static constexpr int WORKER_COUNT = 32;
+
+  struct DriverActor;
+
+  struct WorkerActor final : public td::Actor {
+    td::ActorId<DriverActor> driver;
+    td::uint32 state = 0;
+
+    void start_up() final {
+      set_migratable(use_work_stealing);
+    }
+
+    void work(int id) {
+      // simulate several microseconds of CPU-bound work
+      for (int i = 0; i < 5000; i++) {
+        state = state * 1664525 + 1013904223;
+      }
+      send_closure(driver, &DriverActor::on_work_done, id, state);
+    }
+  };
+
+  struct DriverActor final : public td::Actor {
+    td::vector<td::ActorId<WorkerActor>> workers;
+    int left_query_count = 0;
+    int active_query_count = 0;
+    td::uint32 result = 0;
+
+    void start_up() final {
+      for (size_t i = 0; i < workers.size(); i++) {
+        send_next_query(static_cast<int>(i));
+      }
+    }
+
+    void send_next_query(int id) {
+      if (left_query_count == 0) {
+        if (active_query_count == 0) {
+          td::Scheduler::instance()->finish();
+        }
+        return;
+      }
+      left_query_count--;
+      active_query_count++;
+      send_closure_later(workers[id], &WorkerActor::work, id);
+    }
+
+    void on_work_done(int id, td::uint32 worker_state) {
+      result += worker_state;
+      active_query_count--;
+      send_next_query(id);
+    }
+  };
+
+  td::string get_description() const final {
+    return PSTRING() << "SkewedLoad (work_stealing = " << use_work_stealing << ", threads_n = " << THREAD_COUNT
+                     << ")";
+  }
+
+  void run(int n) final {
+    td::ConcurrentScheduler scheduler(THREAD_COUNT, 0);
+    if (use_work_stealing) {
+      scheduler.enable_work_stealing();
+    }
+    // all workers are created on the same scheduler, so other schedulers have no work without stealing
+    auto driver = scheduler.create_actor_unsafe<DriverActor>(1, "DriverActor").release();
+    for (int i = 0; i < WORKER_COUNT; i++) {
+      auto worker = scheduler.create_actor_unsafe<WorkerActor>(1, "WorkerActor").release();
+      worker.get_actor_unsafe()->driver = driver;
+      driver.get_actor_unsafe()->workers.push_back(worker);
+    }
+    driver.get_actor_unsafe()->left_query_count = td::max(n, WORKER_COUNT);
+    scheduler.start();
+    while (scheduler.run_main(10)) {
+      // empty
+    }
+    scheduler.finish();
+    stolen_actor_count_ += scheduler.get_stolen_actor_count();
+  }
+
+  void tear_down() final {
+    LOG(INFO) << get_description() << ": " << stolen_actor_count_ << " actors were moved between schedulers";
+    stolen_actor_count_ = 0;
+  }
+
+ private:
+  td::uint64 stolen_actor_count_ = 0;
+};
+
+class FanOutBench final : public td::Benchmark {
+ public:
+  static constexpr int THREAD_COUNT = 3;
+  static constexpr int WORKER_COUNT = 30;
+  static constexpr int BURST_SIZE = 100;
+
+  struct DriverActor;
+
+  struct WorkerActor final : public td::Actor {
+    td::ActorId<DriverActor> driver;
+
+    void query(int x) {
+      send_closure(driver, &DriverActor::on_query_result, x);
+    }
+  };
+
+  struct DriverActor final : public td::Actor {
+    td::vector<td::ActorId<WorkerActor>> workers;
+    int left_burst_count = 0;
+    int active_query_count = 0;
+
+    void start_up() final {
+      send_burst();
+    }
+
+    void send_burst() {
+      if (left_burst_count == 0) {
+        td::Scheduler::instance()->finish();
+        return;
+      }
+      left_burst_count--;
+      for (int i = 0; i < BURST_SIZE; i++) {
+        send_closure(workers[i % workers.size()], &WorkerActor::query, i);
+      }
+      active_query_count = BURST_SIZE;
+    }
+
+    void on_query_result(int x) {
+      if (--active_query_count == 0) {
+        send_burst();
+      }
+    }
+  };
+
+  td::string get_description() const final {
+    return PSTRING() << "FanOut (threads_n = " << THREAD_COUNT << ", burst size = " << BURST_SIZE << ")";
+  }
+
+  void run(int n) final {
+    td::ConcurrentScheduler scheduler(THREAD_COUNT, 0);
+    auto driver = scheduler.create_actor_unsafe<DriverActor>(1, "DriverActor").release();
+    for (int i = 0; i < WORKER_COUNT; i++) {
+      auto worker = scheduler.create_actor_unsafe<WorkerActor>(2 + i % (THREAD_COUNT - 1), "WorkerActor").release();
+      worker.get_actor_unsafe()->driver = driver;
+      driver.get_actor_unsafe()->workers.push_back(worker);
+    }
+    driver.get_actor_unsafe()->left_burst_count = td::max(n / BURST_SIZE, 1);
+    scheduler.start();
+    while (scheduler.run_main(10)) {
+      // empty
+    }
+    stats_ = scheduler.get_outbound_event_stats();
+    scheduler.finish();
+  }
+
+  void tear_down() final {
+    LOG(INFO) << get_description() << ": " << stats_;
+  }
+
+ private:
+  td::OutboundEventStats stats_;
+};
+
+// percentiles are computed over all runs of a benchmark, so they are printed when the benchmark is destroyed
+static void print_latency_percentiles(const td::string &description, td::vector<double> &latencies) {
+  if (latencies.empty()) {
+    return;
+  }
+  std::sort(latencies.begin(), latencies.end());
+  auto get_percentile = [&](double percent) {
+    auto pos = static_cast<size_t>(static_cast<double>(latencies.size() - 1) * percent / 100);
+    return latencies[pos] * 1e6;
+  };
+  LOG(PLAIN) << description << " in microseconds: p50 = " << get_percentile(50) << ", p90 = " << get_percentile(90)
+             << ", p99 = " << get_percentile(99) << ", p99.9 = " << get_percentile(99.9)
+             << ", max = " << latencies.back() * 1e6;
+}
+
+template <bool use_busy_poll>
+class PingPongLatencyBench final : public td::Benchmark {
+ public:
+  static constexpr double BUSY_POLL_DURATION = 50e-6;
+
+  struct PingActor;
+
+  struct PongActor final : public td::Actor {
+    td::ActorId<PingActor> ping;
+
+    void pong(int n) {
+      send_closure(ping, &PingActor::ping, n);
+    }
+  };
+
+  struct PingActor final : public td::Actor {
+    td::ActorId<PongActor> pong;
+    td::vector<double> *latencies = nullptr;
+    int left_ping_count = 0;
+    double sent_at = 0.0;
+
+    void start_up() final {
+      send_ping();
+    }
+
+    void send_ping() {
+      if (left_ping_count == 0) {
+        td::Scheduler::instance()->finish();
+        return;
+      }
+      left_ping_count--;
+      sent_at = td::Time::now();
+      send_closure(pong, &PongActor::pong, left_ping_count);
+    }
+
+    void ping(int n) {
+      latencies->push_back(td::Time::now() - sent_at);
+      send_ping();
+    }
+  };
+
+  td::string get_description() const final {
+    return PSTRING() << "PingPongLatency (busy_poll = " << use_busy_poll << ")";
+  }
+
+  void run(int n) final {
+    td::ConcurrentScheduler scheduler(2, 0);
+    if (use_busy_poll) {
+      scheduler.set_busy_poll_duration(BUSY_POLL_DURATION);
+    }
+    auto ping = scheduler.create_actor_unsafe<PingActor>(1, "PingActor").release();
+    auto pong = scheduler.create_actor_unsafe<PongActor>(2, "PongActor").release();
+    ping.get_actor_unsafe()->pong = pong;
+    ping.get_actor_unsafe()->latencies = &latencies_;
+    ping.get_actor_unsafe()->left_ping_count = td::max(n, 100);
+    pong.get_actor_unsafe()->ping = ping;
+    scheduler.start();
+    while (scheduler.run_main(10)) {
+      // empty
+    }
+    scheduler.finish();
+  }
+
+  PingPongLatencyBench() = default;
+  PingPongLatencyBench(const PingPongLatencyBench &) = delete;
+  PingPongLatencyBench &operator=(const PingPongLatencyBench &) = delete;
+  PingPongLatencyBench(PingPongLatencyBench &&) = delete;
+  PingPongLatencyBench &operator=(PingPongLatencyBench &&) = delete;
+  ~PingPongLatencyBench() final {
+    print_latency_percentiles(get_description() + ": round trip latency", latencies_);
+  }
+
+ private:
+  td::vector<double> latencies_;
+};
+
+class TimeoutLatencyBench final : public td::Benchmark {
+ public:
+  static constexpr double TIMEOUT = 100e-6;
+
+  struct TimeoutActor final : public td::Actor {
+    td::vector<double> *latencies = nullptr;
+    int left_timeout_count = 0;
+    double expected_at = 0.0;
+
+    void start_up() final {
+      set_next_timeout();
+    }
+
+    void set_next_timeout() {
+      if (left_timeout_count == 0) {
+        td::Scheduler::instance()->finish();
+        return;
+      }
+      left_timeout_count--;
+      expected_at = td::Time::now() + TIMEOUT;
+      set_timeout_at(expected_at);
+    }
+
+    void timeout_expired() final {
+      latencies->push_back(td::Time::now() - expected_at);
+      set_next_timeout();
+    }
+  };
+
+  td::string get_description() const final {
+    return PSTRING() << "TimeoutLatency (timeout = " << TIMEOUT * 1e6 << "us)";
+  }
+
+  void run(int n) final {
+    td::ConcurrentScheduler scheduler(0, 0);
+    auto actor = scheduler.create_actor_unsafe<TimeoutActor>(0, "TimeoutActor").release();
+    actor.get_actor_unsafe()->latencies = &latencies_;
+    actor.get_actor_unsafe()->left_timeout_count = td::max(n / 100, 10);
+    scheduler.start();
+    while (scheduler.run_main(10)) {
+      // empty
+    }
+    scheduler.finish();
+  }
+
+  TimeoutLatencyBench() = default;
+  TimeoutLatencyBench(const TimeoutLatencyBench &) = delete;
+  TimeoutLatencyBench &operator=(const TimeoutLatencyBench &) = delete;
+  TimeoutLatencyBench(TimeoutLatencyBench &&) = delete;
+  TimeoutLatencyBench &operator=(TimeoutLatencyBench &&) = delete;
+  ~TimeoutLatencyBench() final {
+    print_latency_percentiles(get_description() + ": timeout overshoot", latencies_);
+  }
+
+ private:
+  td::vector<double> latencies_;
+};
+
+template <class MultiPromiseT>
+class MultiPromiseBench final : public td::Benchmark {
+ public:
+  static constexpr int PROMISES_PER_JOIN = 10;
+
+  struct JoinActor final : public td::Actor {
+    int join_count = 0;
+    int finished_join_count = 0;
+
+    void start_up() final {
+      td::vector<td::Promise<td::Unit>> promises;
+      for (int i = 0; i < join_count; i++) {
+        MultiPromiseT multi_promise{"MultiPromiseBench"};
+        multi_promise.add_promise(td::PromiseCreator::lambda([this](td::Unit) {
+          if (++finished_join_count == join_count) {
+            td::Scheduler::instance()->finish();
+          }
+        }));
+        auto lock = multi_promise.get_promise();
+        for (int j = 0; j < PROMISES_PER_JOIN; j++) {
+          promises.push_back(multi_promise.get_promise());
+        }
+        td::set_promises(promises);
+        lock.set_value(td::Unit());
+      }
+    }
+  };
+
+  explicit MultiPromiseBench(const char *name) : name_(name) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << name_ << " (allocations per promise = " << allocations_per_promise_ << ")";
+  }
+
+  void run(int n) final {
+    td::ConcurrentScheduler scheduler(0, 0);
+    auto join_count = td::max(n / PROMISES_PER_JOIN, 10);
+    auto begin_allocation_count = get_allocation_count();
+    scheduler.create_actor_unsafe<JoinActor>(0, "JoinActor").release().get_actor_unsafe()->join_count = join_count;
+    scheduler.start();
+    while (scheduler.run_main(10)) {
+      // empty
+    }
+    scheduler.finish();
+    allocations_per_promise_ = static_cast<double>(get_allocation_count() - begin_allocation_count) /
+                               static_cast<double>(join_count * (PROMISES_PER_JOIN + 2));
+  }
+
+ private:
+  const char *name_;
+  double allocations_per_promise_ = 0.0;
+};
+
+#if TD_HAVE_ACTOR_COROUTINES
+template <bool use_coroutines>
+class QueryChainBench final : public td::Benchmark {
+ public:
+  struct ServerActor final : public td::Actor {
+    void query(int value, td::Promise<int> &&promise) {
+      promise.set_value(value + 1);
+    }
+  };
+
+  struct ClientActor final : public td::Actor {
+    td::ActorId<ServerActor> server;
+    int query_count = 0;
+
+    void start_up() final {
+      if (use_coroutines) {
+        run().start(td::Promise<td::Unit>());
+      } else {
+        on_result(0);
+      }
+    }
+
+    void on_result(int value) {
+      if (value == query_count) {
+        td::Scheduler::instance()->finish();
+        return;
+      }
+      send_closure(server, &ServerActor::query, value,
+                   td::PromiseCreator::lambda([actor_id = actor_id(this)](td::Result<int> result) {
+                     send_closure(actor_id, &ClientActor::on_result, result.move_as_ok());
+                   }));
+    }
+
+    td::Task<td::Unit> run() {
+      int value = 0;
+      while (value != query_count) {
+        auto r_value = co_await td::co_send_closure(server, &ServerActor::query, value);
+        value = r_value.move_as_ok();
+      }
+      td::Scheduler::instance()->finish();
+      co_return td::Unit();
+    }
+  };
+
+  td::string get_description() const final {
+    return PSTRING() << "QueryChain (" << (use_coroutines ? "coroutines" : "callbacks")
+                     << ", allocations per query = " << allocations_per_query_ << ")";
+  }
+
+  void run(int n) final {
+    td::ConcurrentScheduler scheduler(1, 0);
+    auto server = scheduler.create_actor_unsafe<ServerActor>(1, "ServerActor").release();
+    auto query_count = td::max(n, 100);
+    auto begin_allocation_count = get_allocation_count();
+    auto client = scheduler.create_actor_unsafe<ClientActor>(0, "ClientActor").release();
+    client.get_actor_unsafe()->server = server;
+    client.get_actor_unsafe()->query_count = query_count;
+    scheduler.start();
+    while (scheduler.run_main(10)) {
+      // empty
+    }
+    scheduler.finish();
+    allocations_per_query_ =
+        static_cast<double>(get_allocation_count() - begin_allocation_count) / static_cast<double>(query_count);
+  }
+
+ private:
+  double allocations_per_query_ = 0.0;
+};
+#endif
+
 int main() {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
   td::init_openssl_threads();
 
   bench(CreateActorBench());
@@ -346,4 +822,16 @@ int main() {
   bench(RingBench<0>(504, 2));
   bench(RingBench<1>(504, 2));
   bench(RingBench<2>(504, 2));
+  bench(SkewedLoadBench<false>());
+  bench(SkewedLoadBench<true>());
+  bench(FanOutBench());
+  bench(MultiPromiseBench<td::MultiPromiseActorSafe>("MultiPromiseActorSafe"));
+  bench(MultiPromiseBench<td::MultiPromiseJoin>("MultiPromiseJoin"));
+#if TD_HAVE_ACTOR_COROUTINES
+  bench(QueryChainBench<false>());
+  bench(QueryChainBench<true>());
+#endif
+  bench(PingPongLatencyBench<false>());
+  bench(PingPongLatencyBench<true>());
+  bench(TimeoutLatencyBench());
 }
@@ -373,6 +373,52 @@ class AesIgeShortBench final : public td::Benchmark {
   }
 };
 
+template <bool use_multi>
+class AesIgeMultiBench final : public td::Benchmark {
+ public:
+  static constexpr int BUFFER_COUNT = 8;
+  static constexpr int BUFFER_SIZE = 1 << 10;
+  alignas(64) unsigned char data[BUFFER_COUNT][BUFFER_SIZE];
+  td::UInt256 key[BUFFER_COUNT];
+  td::UInt256 iv[BUFFER_COUNT];
+
+  std::string get_description() const final {
+    return PSTRING() << "AES IGE decrypt " << (use_multi ? "multi-buffer" : "sequential") << " [" << BUFFER_COUNT
+                     << "x" << BUFFER_SIZE << "B]";
+  }
+
+  void start_up() final {
+    for (int i = 0; i < BUFFER_COUNT; i++) {
+      std::fill(std::begin(data[i]), std::end(data[i]), static_cast<unsigned char>(123));
+      td::Random::secure_bytes(as_mutable_slice(key[i]));
+      td::Random::secure_bytes(as_mutable_slice(iv[i]));
+    }
+  }
+
+  void run(int n) final {
+    td::AesIgeBuffer buffers[BUFFER_COUNT];
+    for (int i = 0; i < BUFFER_COUNT; i++) {
+      td::MutableSlice data_slice(data[i], BUFFER_SIZE);
+      buffers[i] = {as_slice(key[i]), as_mutable_slice(iv[i]), data_slice, data_slice};
+    }
+    for (int i = 0; i < n; i++) {
+      if (use_multi) {
+        td::aes_ige_decrypt_multi(buffers);
+      } else {
+        for (auto &buffer : buffers) {
+          td::aes_ige_decrypt(buffer.key, buffer.iv, buffer.from, buffer.to);
+        }
+      }
+    }
+  }
+};
+
+template <bool use_multi>
+constexpr int AesIgeMultiBench<use_multi>::BUFFER_COUNT;
+
+template <bool use_multi>
+constexpr int AesIgeMultiBench<use_multi>::BUFFER_SIZE;
+
 BENCH(Rand, "std_rand") {
   int res = 0;
   for (int i = 0; i < n; i++) {
@@ -467,6 +513,27 @@ class Crc32Bench final : public td::Benchmark {
   }
 };
 
+class Crc32cBench final : public td::Benchmark {
+ public:
+  alignas(64) unsigned char data[DATA_SIZE];
+
+  std::string get_description() const final {
+    return PSTRING() << "CRC32C [" << (DATA_SIZE >> 10) << "KB]";
+  }
+
+  void start_up() final {
+    std::fill(std::begin(data), std::end(data), static_cast<unsigned char>(123));
+  }
+
+  void run(int n) final {
+    td::uint64 res = 0;
+    for (int i = 0; i < n; i++) {
+      res += td::crc32c(td::Slice(data, DATA_SIZE));
+    }
+    td::do_not_optimize_away(res);
+  }
+};
+
 class Crc64Bench final : public td::Benchmark {
  public:
   alignas(64) unsigned char data[DATA_SIZE];
@@ -488,6 +555,27 @@ class Crc64Bench final : public td::Benchmark {
   }
 };
 
+class Crc16Bench final : public td::Benchmark {
+ public:
+  alignas(64) unsigned char data[DATA_SIZE];
+
+  std::string get_description() const final {
+    return PSTRING() << "CRC16 [" << (DATA_SIZE >> 10) << "KB]";
+  }
+
+  void start_up() final {
+    std::fill(std::begin(data), std::end(data), static_cast<unsigned char>(123));
+  }
+
+  void run(int n) final {
+    td::uint64 res = 0;
+    for (int i = 0; i < n; i++) {
+      res += td::crc16(td::Slice(data, DATA_SIZE));
+    }
+    td::do_not_optimize_away(res);
+  }
+};
+
 int main() {
   td::init_openssl_threads();
   td::bench(AesCtrBench());
@@ -501,6 +589,8 @@ int main() {
   td::bench(AesIgeShortBench<false>());
   td::bench(AesIgeEncryptBench());
   td::bench(AesIgeDecryptBench());
+  td::bench(AesIgeMultiBench<false>());
+  td::bench(AesIgeMultiBench<true>());
   td::bench(AesEcbBench());
 
   td::bench(Pbkdf2Bench());
@@ -521,5 +611,7 @@ int main() {
   td::bench(HmacSha256ShortBench());
   td::bench(HmacSha512ShortBench());
   td::bench(Crc32Bench());
+  td::bench(Crc32cBench());
   td::bench(Crc64Bench());
+  td::bench(Crc16Bench());
 }
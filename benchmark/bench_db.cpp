@@ -21,6 +21,7 @@
 #include "td/utils/common.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
+#include "td/utils/port/thread.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
 #include "td/utils/StringBuilder.h"
@@ -230,6 +231,52 @@ class BinlogKeyValueBench final : public td::Benchmark {
   }
 };
 
+class BinlogKeyValueConcurrentReadBench final : public td::Benchmark {
+  static constexpr int READER_COUNT = 3;
+  static constexpr int KEY_COUNT = 10000;
+
+  td::string get_description() const final {
+    return PSTRING() << "BinlogKeyValue concurrent get/prefix_get " << td::tag("readers", READER_COUNT);
+  }
+
+  td::BinlogKeyValue<td::Binlog> kv;
+  void start_up() final {
+    td::Binlog::destroy("test_binlog").ignore();
+    kv.init("test_binlog").ensure();
+    for (int i = 0; i < KEY_COUNT; i++) {
+      kv.set(PSTRING() << "key" << i % 100 << '_' << i, td::to_string(i));
+    }
+  }
+  void tear_down() final {
+    kv.close();
+    td::Binlog::destroy("test_binlog").ignore();
+  }
+  void run(int n) final {
+    td::vector<td::thread> threads;
+    for (int thread_id = 0; thread_id < READER_COUNT; thread_id++) {
+      threads.emplace_back([&, thread_id] {
+        size_t found = 0;
+        for (int i = 0; i < n; i++) {
+          auto key_id = (i * 7919 + thread_id) % KEY_COUNT;
+          if (i % 64 == 0) {
+            found += kv.prefix_get(PSLICE() << "key" << key_id % 100 << '_').size();
+          } else {
+            found += kv.get(PSTRING() << "key" << key_id % 100 << '_' << key_id).size();
+          }
+        }
+        td::do_not_optimize_away(found);
+      });
+    }
+    for (int i = 0; i < n; i++) {
+      auto key_id = i % KEY_COUNT;
+      kv.set(PSTRING() << "key" << key_id % 100 << '_' << key_id, td::to_string(i));
+    }
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+};
+
 int main() {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(WARNING));
   bench(TdKvBench<td::BinlogKeyValue<td::Binlog>>("BinlogKeyValue<Binlog>"));
@@ -237,6 +284,7 @@ int main() {
 
   bench(BinlogKeyValueBench<true>());
   bench(BinlogKeyValueBench<false>());
+  bench(BinlogKeyValueConcurrentReadBench());
   bench(SqliteKVBench<false>());
   bench(SqliteKVBench<true>());
   bench(SqliteKeyValueAsyncBench());
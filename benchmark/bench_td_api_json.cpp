@@ -0,0 +1,146 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/telegram/td_api.h"
+#include "td/telegram/td_api_json.h"
+
+#include "td/utils/benchmark.h"
+#include "td/utils/common.h"
+#include "td/utils/JsonBuilder.h"
+#include "td/utils/logging.h"
+#include "td/utils/Random.h"
+
+#include <utility>
+
+static td::td_api::object_ptr<td::td_api::formattedText> get_formatted_text(td::string text, bool with_entities) {
+  td::vector<td::td_api::object_ptr<td::td_api::textEntity>> entities;
+  if (with_entities) {
+    entities.push_back(
+        td::td_api::make_object<td::td_api::textEntity>(0, 5, td::td_api::make_object<td::td_api::textEntityTypeBold>()));
+    entities.push_back(td::td_api::make_object<td::td_api::textEntity>(
+        6, 12, td::td_api::make_object<td::td_api::textEntityTypeTextUrl>("https://telegram.org/blog")));
+  }
+  return td::td_api::make_object<td::td_api::formattedText>(std::move(text), std::move(entities));
+}
+
+static td::td_api::object_ptr<td::td_api::file> get_file(td::int32 id, td::int64 size) {
+  auto file = td::td_api::make_object<td::td_api::file>();
+  file->id_ = id;
+  file->size_ = size;
+  file->expected_size_ = size;
+  file->local_ = td::td_api::make_object<td::td_api::localFile>();
+  file->remote_ = td::td_api::make_object<td::td_api::remoteFile>(
+      "AgACAgIAAxkBAAIBZ2S7Hk3u1wABbZ6TkQABv1m9hQqTBkQAAmTNMRtF0ehJb9sL2jWZm9wBAAMCAAN5AAMvBA", "AQADZM0xG0XR6El-", false,
+      true, size);
+  return file;
+}
+
+static td::td_api::object_ptr<td::td_api::message> get_message(td::int64 id,
+                                                               td::td_api::object_ptr<td::td_api::MessageContent> content) {
+  auto message = td::td_api::make_object<td::td_api::message>();
+  message->id_ = id << 20;
+  message->sender_id_ = td::td_api::make_object<td::td_api::messageSenderUser>(1234567890);
+  message->chat_id_ = -1001234567890;
+  message->can_be_forwarded_ = true;
+  message->can_be_saved_ = true;
+  message->can_be_deleted_only_for_self_ = true;
+  message->can_get_message_thread_ = true;
+  message->is_channel_post_ = true;
+  message->date_ = 1690000000 + static_cast<td::int32>(id);
+  message->self_destruct_in_ = 0.0;
+  message->auto_delete_in_ = 86400.0;
+  message->media_album_id_ = 13678523478126348;
+
+  auto interaction_info = td::td_api::make_object<td::td_api::messageInteractionInfo>();
+  interaction_info->view_count_ = 123456;
+  interaction_info->forward_count_ = 789;
+  interaction_info->reactions_.push_back(td::td_api::make_object<td::td_api::messageReaction>(
+      td::td_api::make_object<td::td_api::reactionTypeEmoji>("\xF0\x9F\x91\x8D"), 1024, false,
+      td::vector<td::td_api::object_ptr<td::td_api::MessageSender>>()));
+  message->interaction_info_ = std::move(interaction_info);
+  message->content_ = std::move(content);
+  return message;
+}
+
+// a set of objects, resembling updates received by a client subscribed to several channels
+static td::vector<td::td_api::object_ptr<td::td_api::Object>> get_updates() {
+  td::vector<td::td_api::object_ptr<td::td_api::Object>> result;
+  td::string english_text;
+  td::string russian_text;
+  for (int i = 0; i < 10; i++) {
+    english_text +=
+        "Hello world! Telegram is a cloud-based mobile and desktop messaging app with a focus on security and "
+        "speed. See \"https://telegram.org/faq\" for details.\n";
+    russian_text +=
+        "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82, \xD0\xBC\xD0\xB8\xD1\x80! "
+        "\xD0\xAD\xD1\x82\xD0\xBE \xD1\x82\xD0\xB5\xD1\x81\xD1\x82\xD0\xBE\xD0\xB2\xD0\xBE\xD0\xB5 "
+        "\xD1\x81\xD0\xBE\xD0\xBE\xD0\xB1\xD1\x89\xD0\xB5\xD0\xBD\xD0\xB8\xD0\xB5 \xF0\x9F\x98\x80\n";
+  }
+
+  result.push_back(td::td_api::make_object<td::td_api::updateNewMessage>(get_message(
+      1, td::td_api::make_object<td::td_api::messageText>(get_formatted_text(english_text, true), nullptr))));
+  result.push_back(td::td_api::make_object<td::td_api::updateNewMessage>(get_message(
+      2, td::td_api::make_object<td::td_api::messageText>(get_formatted_text(russian_text, true), nullptr))));
+
+  // minithumbnails are small JPEG files, which are encoded in base64 like any other bytes
+  td::Random::Xorshift128plus rnd(123);
+  td::string thumbnail(1500, '\0');
+  for (auto &c : thumbnail) {
+    c = static_cast<char>(rnd() & 255);
+  }
+  auto photo = td::td_api::make_object<td::td_api::photo>();
+  photo->minithumbnail_ = td::td_api::make_object<td::td_api::minithumbnail>(40, 40, std::move(thumbnail));
+  photo->sizes_.push_back(
+      td::td_api::make_object<td::td_api::photoSize>("m", get_file(101, 15309), 320, 320, td::vector<td::int32>()));
+  photo->sizes_.push_back(td::td_api::make_object<td::td_api::photoSize>(
+      "y", get_file(102, 152342), 1280, 1280, td::vector<td::int32>{10152, 35721, 80834, 118563}));
+  result.push_back(td::td_api::make_object<td::td_api::updateNewMessage>(
+      get_message(3, td::td_api::make_object<td::td_api::messagePhoto>(
+                         std::move(photo), get_formatted_text("Photo of the day", false), false, false))));
+
+  result.push_back(td::td_api::make_object<td::td_api::updateNewMessage>(
+      get_message(4, td::td_api::make_object<td::td_api::messageLocation>(
+                         td::td_api::make_object<td::td_api::location>(51.507351, -0.127758, 16.25), 900, 897, 0, 0))));
+
+  for (int i = 0; i < 4; i++) {
+    result.push_back(td::td_api::make_object<td::td_api::updateUserStatus>(
+        1000000000 + i, td::td_api::make_object<td::td_api::userStatusOnline>(1690000300 + i)));
+  }
+  return result;
+}
+
+class TdApiToJsonBench final : public td::Benchmark {
+ public:
+  td::string get_description() const final {
+    return "td_api to_json";
+  }
+
+  void start_up() final {
+    updates_ = get_updates();
+  }
+
+  void run(int n) final {
+    size_t length = 0;
+    for (int i = 0; i < n; i++) {
+      for (auto &update : updates_) {
+        length += td::json_encode<td::string>(td::ToJson(*update)).size();
+      }
+    }
+    td::do_not_optimize_away(length);
+  }
+
+  void tear_down() final {
+    updates_.clear();
+  }
+
+ private:
+  td::vector<td::td_api::object_ptr<td::td_api::Object>> updates_;
+};
+
+int main() {
+  SET_VERBOSITY_LEVEL(VERBOSITY_NAME(INFO));
+  td::bench(TdApiToJsonBench());
+}
@@ -11,6 +11,8 @@
 #include "td/telegram/ServerMessageId.h"
 #include "td/telegram/UserId.h"
 
+#include "td/db/binlog/Binlog.h"
+#include "td/db/binlog/BinlogEvent.h"
 #include "td/db/DbKey.h"
 #include "td/db/SqliteConnectionSafe.h"
 #include "td/db/SqliteDb.h"
@@ -20,10 +22,15 @@
 #include "td/utils/benchmark.h"
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
+#include "td/utils/format.h"
 #include "td/utils/logging.h"
+#include "td/utils/port/Clocks.h"
+#include "td/utils/port/Stat.h"
 #include "td/utils/Promise.h"
 #include "td/utils/Random.h"
+#include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
+#include "td/utils/Storer.h"
 
 #include <memory>
 
@@ -36,6 +43,91 @@ static td::Status init_db(td::SqliteDb &db) {
   return td::Status::OK();
 }
 
+class BinlogReindexBench final : public td::Benchmark {
+ public:
+  td::string get_description() const final {
+    return "Binlog rewrite with reindex";
+  }
+  void start_up() final {
+    td::Binlog::destroy(binlog_name_).ignore();
+    binlog_ = td::make_unique<td::Binlog>();
+    binlog_->init(binlog_name_, [](const td::BinlogEvent &) {}).ensure();
+    event_ids_.clear();
+    for (int i = 0; i < EVENT_COUNT; i++) {
+      event_ids_.push_back(binlog_->add(1, td::create_storer(value_)));
+    }
+    max_time_ = 0;
+  }
+  void run(int n) final {
+    for (int i = 0; i < n; i++) {
+      auto begin_time = td::Clocks::monotonic();
+      binlog_->rewrite(event_ids_[td::Random::fast(0, EVENT_COUNT - 1)], 1, td::create_storer(value_));
+      max_time_ = td::max(max_time_, td::Clocks::monotonic() - begin_time);
+    }
+  }
+  void tear_down() final {
+    LOG(ERROR) << "Maximum time to add an event: " << td::format::as_time(max_time_);
+    binlog_->close_and_destroy().ensure();
+    binlog_.reset();
+  }
+
+ private:
+  static constexpr int EVENT_COUNT = 4096;
+  td::string binlog_name_ = "testdb.binlog";
+  td::string value_ = td::string(1000, 'a');
+  td::unique_ptr<td::Binlog> binlog_;
+  td::vector<td::uint64> event_ids_;
+  double max_time_ = 0;
+};
+
+class BinlogLoadBench final : public td::Benchmark {
+ public:
+  explicit BinlogLoadBench(bool is_encrypted)
+      : db_key_(is_encrypted ? td::DbKey::raw_key(td::string(32, 'A')) : td::DbKey::empty()) {
+  }
+  td::string get_description() const final {
+    return PSTRING() << "Binlog load" << (db_key_.is_empty() ? "" : " encrypted");
+  }
+  void start_up() final {
+    td::Binlog::destroy(binlog_name_).ignore();
+    td::Binlog binlog;
+    binlog.init(binlog_name_, [](const td::BinlogEvent &) {}, db_key_).ensure();
+    for (int i = 0; i < EVENT_COUNT; i++) {
+      binlog.add(1, td::create_storer(value_));
+    }
+    binlog.close().ensure();
+    binlog_size_ = td::stat(binlog_name_).move_as_ok().size_;
+    total_size_ = 0;
+    total_time_ = 0;
+  }
+  void run(int n) final {
+    for (int i = 0; i < n; i++) {
+      auto begin_time = td::Clocks::monotonic();
+      td::Binlog binlog;
+      binlog.init(binlog_name_, [](const td::BinlogEvent &) {}, db_key_).ensure();
+      total_size_ += binlog_size_;
+      binlog.close(false).ensure();
+      total_time_ += td::Clocks::monotonic() - begin_time;
+    }
+  }
+  void tear_down() final {
+    if (total_time_ > 0) {
+      auto speed = static_cast<td::int64>(static_cast<double>(total_size_) / total_time_);
+      LOG(ERROR) << "Load speed: " << td::format::as_size(speed) << "/s";
+    }
+    td::Binlog::destroy(binlog_name_).ignore();
+  }
+
+ private:
+  static constexpr int EVENT_COUNT = 65536;
+  td::string binlog_name_ = "testdb.binlog";
+  td::string value_ = td::string(1000, 'a');
+  td::DbKey db_key_;
+  td::int64 binlog_size_ = 0;
+  td::int64 total_size_ = 0;
+  double total_time_ = 0;
+};
+
 class MessageDbBench final : public td::Benchmark {
  public:
   td::string get_description() const final {
@@ -109,5 +201,8 @@ class MessageDbBench final : public td::Benchmark {
 
 int main() {
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(WARNING));
+  td::bench(BinlogReindexBench());
+  td::bench(BinlogLoadBench(false));
+  td::bench(BinlogLoadBench(true));
   td::bench(MessageDbBench());
 }
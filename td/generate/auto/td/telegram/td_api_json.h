@@ -0,0 +1,6994 @@
+#pragma once
+
+#include "td/telegram/td_api.h"
+
+#include "td/utils/JsonBuilder.h"
+#include "td/utils/Status.h"
+
+namespace td {
+namespace td_api {
+
+void to_json(JsonValueScope &jv, const tl_object_ptr<Object> &value);
+
+Status from_json(tl_object_ptr<Function> &to, td::JsonValue from);
+
+Status from_json(tl_object_ptr<Function> &to, MutableSlice json, string &extra);
+
+void to_json(JsonValueScope &jv, const Object &object);
+
+void to_json(JsonValueScope &jv, const Function &object);
+
+Result<int32> tl_constructor_from_string(td_api::AutosaveSettingsScope *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::BackgroundFill *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::BackgroundType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::BotCommandScope *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::CallProblem *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::CallbackQueryPayload *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::ChatAction *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::ChatAvailableReactions *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::ChatList *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::ChatMemberStatus *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::ChatMembersFilter *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::ChatPhotoStickerType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::DeviceToken *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::EmailAddressAuthentication *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::EmojiCategoryType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::FileType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::FirebaseAuthenticationSettings *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::GroupCallVideoQuality *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InlineKeyboardButtonType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InlineQueryResultsButtonType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InputBackground *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InputChatPhoto *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InputCredentials *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InputFile *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InputInlineQueryResult *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InputInvoice *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InputMessageContent *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InputPassportElement *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InputPassportElementErrorSource *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InputStoryContent *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::InternalLinkType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::JsonValue *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::KeyboardButtonType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::LanguagePackStringValue *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::LogStream *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::MaskPoint *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::MessageReplyTo *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::MessageSchedulingState *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::MessageSender *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::MessageSource *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::NetworkStatisticsEntry *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::NetworkType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::NotificationSettingsScope *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::OptionValue *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::PassportElementType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::PollType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::PremiumFeature *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::PremiumLimitType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::PremiumSource *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::ProxyType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::PublicChatType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::ReactionType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::ReplyMarkup *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::ReportReason *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::SearchMessagesFilter *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::StickerFormat *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::StickerType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::StorePaymentPurpose *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::StoryList *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::StoryPrivacySettings *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::SuggestedAction *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::SupergroupMembersFilter *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::TargetChat *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::TextEntityType *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::TextParseMode *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::TopChatCategory *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::UserPrivacySetting *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::UserPrivacySettingRule *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::Object *object, Slice str);
+
+Result<int32> tl_constructor_from_string(td_api::Function *object, Slice str);
+
+Status from_json(td_api::accountTtl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::accountTtl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::address &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::address &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::archiveChatListSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::archiveChatListSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::autoDownloadSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::autoDownloadSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::autosaveSettingsScopePrivateChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::autosaveSettingsScopePrivateChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::autosaveSettingsScopeGroupChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::autosaveSettingsScopeGroupChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::autosaveSettingsScopeChannelChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::autosaveSettingsScopeChannelChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::autosaveSettingsScopeChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::autosaveSettingsScopeChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::backgroundFillSolid &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::backgroundFillSolid &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::backgroundFillGradient &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::backgroundFillGradient &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::backgroundFillFreeformGradient &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::backgroundFillFreeformGradient &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::backgroundTypeWallpaper &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::backgroundTypeWallpaper &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::backgroundTypePattern &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::backgroundTypePattern &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::backgroundTypeFill &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::backgroundTypeFill &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::botCommand &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::botCommand &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::botCommandScopeDefault &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::botCommandScopeDefault &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::botCommandScopeAllPrivateChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::botCommandScopeAllPrivateChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::botCommandScopeAllGroupChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::botCommandScopeAllGroupChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::botCommandScopeAllChatAdministrators &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::botCommandScopeAllChatAdministrators &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::botCommandScopeChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::botCommandScopeChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::botCommandScopeChatAdministrators &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::botCommandScopeChatAdministrators &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::botCommandScopeChatMember &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::botCommandScopeChatMember &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::botMenuButton &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::botMenuButton &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callProblemEcho &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callProblemEcho &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callProblemNoise &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callProblemNoise &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callProblemInterruptions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callProblemInterruptions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callProblemDistortedSpeech &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callProblemDistortedSpeech &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callProblemSilentLocal &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callProblemSilentLocal &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callProblemSilentRemote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callProblemSilentRemote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callProblemDropped &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callProblemDropped &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callProblemDistortedVideo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callProblemDistortedVideo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callProblemPixelatedVideo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callProblemPixelatedVideo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callProtocol &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callProtocol &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callbackQueryPayloadData &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callbackQueryPayloadData &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callbackQueryPayloadDataWithPassword &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callbackQueryPayloadDataWithPassword &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::callbackQueryPayloadGame &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::callbackQueryPayloadGame &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionTyping &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionTyping &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionRecordingVideo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionRecordingVideo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionUploadingVideo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionUploadingVideo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionRecordingVoiceNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionRecordingVoiceNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionUploadingVoiceNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionUploadingVoiceNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionUploadingPhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionUploadingPhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionUploadingDocument &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionUploadingDocument &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionChoosingSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionChoosingSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionChoosingLocation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionChoosingLocation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionChoosingContact &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionChoosingContact &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionStartPlayingGame &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionStartPlayingGame &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionRecordingVideoNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionRecordingVideoNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionUploadingVideoNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionUploadingVideoNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionWatchingAnimations &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionWatchingAnimations &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatActionCancel &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatActionCancel &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatAdministratorRights &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatAdministratorRights &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatAvailableReactionsAll &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatAvailableReactionsAll &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatAvailableReactionsSome &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatAvailableReactionsSome &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatEventLogFilters &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatEventLogFilters &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatFolder &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatFolder &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatFolderIcon &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatFolderIcon &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatInviteLinkMember &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatInviteLinkMember &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatJoinRequest &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatJoinRequest &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatListMain &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatListMain &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatListArchive &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatListArchive &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatListFolder &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatListFolder &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatLocation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatLocation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMemberStatusCreator &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMemberStatusCreator &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMemberStatusAdministrator &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMemberStatusAdministrator &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMemberStatusMember &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMemberStatusMember &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMemberStatusRestricted &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMemberStatusRestricted &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMemberStatusLeft &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMemberStatusLeft &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMemberStatusBanned &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMemberStatusBanned &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMembersFilterContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMembersFilterContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMembersFilterAdministrators &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMembersFilterAdministrators &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMembersFilterMembers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMembersFilterMembers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMembersFilterMention &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMembersFilterMention &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMembersFilterRestricted &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMembersFilterRestricted &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMembersFilterBanned &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMembersFilterBanned &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatMembersFilterBots &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatMembersFilterBots &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatNotificationSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatNotificationSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatPermissions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatPermissions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatPhotoSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatPhotoSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatPhotoStickerTypeRegularOrMask &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatPhotoStickerTypeRegularOrMask &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::chatPhotoStickerTypeCustomEmoji &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::chatPhotoStickerTypeCustomEmoji &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::contact &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::contact &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::date &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::date &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenFirebaseCloudMessaging &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenFirebaseCloudMessaging &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenApplePush &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenApplePush &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenApplePushVoIP &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenApplePushVoIP &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenWindowsPush &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenWindowsPush &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenMicrosoftPush &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenMicrosoftPush &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenMicrosoftPushVoIP &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenMicrosoftPushVoIP &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenWebPush &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenWebPush &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenSimplePush &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenSimplePush &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenUbuntuPush &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenUbuntuPush &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenBlackBerryPush &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenBlackBerryPush &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenTizenPush &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenTizenPush &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deviceTokenHuaweiPush &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deviceTokenHuaweiPush &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::draftMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::draftMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::emailAddressAuthenticationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::emailAddressAuthenticationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::emailAddressAuthenticationAppleId &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::emailAddressAuthenticationAppleId &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::emailAddressAuthenticationGoogleId &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::emailAddressAuthenticationGoogleId &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::emojiCategoryTypeDefault &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::emojiCategoryTypeDefault &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::emojiCategoryTypeEmojiStatus &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::emojiCategoryTypeEmojiStatus &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::emojiCategoryTypeChatPhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::emojiCategoryTypeChatPhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::emojiStatus &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::emojiStatus &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::error &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::error &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeNone &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeNone &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeAnimation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeAnimation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeAudio &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeAudio &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeDocument &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeDocument &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeNotificationSound &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeNotificationSound &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypePhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypePhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypePhotoStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypePhotoStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeProfilePhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeProfilePhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeSecret &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeSecret &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeSecretThumbnail &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeSecretThumbnail &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeSecure &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeSecure &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeThumbnail &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeThumbnail &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeUnknown &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeUnknown &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeVideo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeVideo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeVideoNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeVideoNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeVideoStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeVideoStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeVoiceNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeVoiceNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::fileTypeWallpaper &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::fileTypeWallpaper &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::firebaseAuthenticationSettingsAndroid &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::firebaseAuthenticationSettingsAndroid &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::firebaseAuthenticationSettingsIos &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::firebaseAuthenticationSettingsIos &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::formattedText &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::formattedText &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::forumTopicIcon &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::forumTopicIcon &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::groupCallVideoQualityThumbnail &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::groupCallVideoQualityThumbnail &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::groupCallVideoQualityMedium &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::groupCallVideoQualityMedium &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::groupCallVideoQualityFull &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::groupCallVideoQualityFull &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineKeyboardButton &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineKeyboardButton &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineKeyboardButtonTypeUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineKeyboardButtonTypeUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineKeyboardButtonTypeLoginUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineKeyboardButtonTypeLoginUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineKeyboardButtonTypeWebApp &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineKeyboardButtonTypeWebApp &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineKeyboardButtonTypeCallback &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineKeyboardButtonTypeCallback &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineKeyboardButtonTypeCallbackWithPassword &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineKeyboardButtonTypeCallbackWithPassword &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineKeyboardButtonTypeCallbackGame &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineKeyboardButtonTypeCallbackGame &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineKeyboardButtonTypeSwitchInline &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineKeyboardButtonTypeSwitchInline &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineKeyboardButtonTypeBuy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineKeyboardButtonTypeBuy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineKeyboardButtonTypeUser &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineKeyboardButtonTypeUser &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineQueryResultsButton &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineQueryResultsButton &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineQueryResultsButtonTypeStartBot &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineQueryResultsButtonTypeStartBot &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inlineQueryResultsButtonTypeWebApp &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inlineQueryResultsButtonTypeWebApp &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputBackgroundLocal &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputBackgroundLocal &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputBackgroundRemote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputBackgroundRemote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputBackgroundPrevious &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputBackgroundPrevious &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputChatPhotoPrevious &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputChatPhotoPrevious &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputChatPhotoStatic &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputChatPhotoStatic &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputChatPhotoAnimation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputChatPhotoAnimation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputChatPhotoSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputChatPhotoSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputCredentialsSaved &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputCredentialsSaved &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputCredentialsNew &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputCredentialsNew &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputCredentialsApplePay &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputCredentialsApplePay &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputCredentialsGooglePay &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputCredentialsGooglePay &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputFileId &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputFileId &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputFileRemote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputFileRemote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputFileLocal &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputFileLocal &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputFileGenerated &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputFileGenerated &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputIdentityDocument &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputIdentityDocument &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultAnimation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultAnimation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultArticle &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultArticle &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultAudio &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultAudio &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultContact &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultContact &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultDocument &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultDocument &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultGame &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultGame &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultLocation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultLocation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultPhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultPhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultVenue &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultVenue &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultVideo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultVideo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInlineQueryResultVoiceNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInlineQueryResultVoiceNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInvoiceMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInvoiceMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputInvoiceName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputInvoiceName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageText &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageText &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageAnimation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageAnimation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageAudio &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageAudio &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageDocument &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageDocument &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessagePhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessagePhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageVideo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageVideo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageVideoNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageVideoNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageVoiceNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageVoiceNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageLocation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageLocation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageVenue &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageVenue &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageContact &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageContact &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageDice &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageDice &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageGame &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageGame &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageInvoice &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageInvoice &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessagePoll &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessagePoll &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputMessageForwarded &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputMessageForwarded &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementPersonalDetails &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementPersonalDetails &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementPassport &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementPassport &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementDriverLicense &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementDriverLicense &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementIdentityCard &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementIdentityCard &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementInternalPassport &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementInternalPassport &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementAddress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementAddress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementUtilityBill &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementUtilityBill &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementBankStatement &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementBankStatement &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementRentalAgreement &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementRentalAgreement &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementPassportRegistration &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementPassportRegistration &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementTemporaryRegistration &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementTemporaryRegistration &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementPhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementPhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementEmailAddress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementEmailAddress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementError &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementError &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementErrorSourceUnspecified &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementErrorSourceUnspecified &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementErrorSourceDataField &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementErrorSourceDataField &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementErrorSourceFrontSide &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementErrorSourceFrontSide &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementErrorSourceReverseSide &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementErrorSourceReverseSide &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementErrorSourceSelfie &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementErrorSourceSelfie &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementErrorSourceTranslationFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementErrorSourceTranslationFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementErrorSourceTranslationFiles &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementErrorSourceTranslationFiles &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementErrorSourceFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementErrorSourceFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPassportElementErrorSourceFiles &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPassportElementErrorSourceFiles &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputPersonalDocument &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputPersonalDocument &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputStoryContentPhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputStoryContentPhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputStoryContentVideo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputStoryContentVideo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inputThumbnail &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inputThumbnail &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeActiveSessions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeActiveSessions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeAttachmentMenuBot &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeAttachmentMenuBot &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeAuthenticationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeAuthenticationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeBackground &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeBackground &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeBotAddToChannel &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeBotAddToChannel &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeBotStart &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeBotStart &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeBotStartInGroup &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeBotStartInGroup &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeChangePhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeChangePhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeChatFolderInvite &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeChatFolderInvite &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeChatFolderSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeChatFolderSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeChatInvite &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeChatInvite &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeDefaultMessageAutoDeleteTimerSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeDefaultMessageAutoDeleteTimerSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeEditProfileSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeEditProfileSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeGame &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeGame &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeInstantView &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeInstantView &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeInvoice &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeInvoice &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeLanguagePack &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeLanguagePack &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeLanguageSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeLanguageSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeMessageDraft &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeMessageDraft &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypePassportDataRequest &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypePassportDataRequest &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypePhoneNumberConfirmation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypePhoneNumberConfirmation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypePremiumFeatures &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypePremiumFeatures &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypePrivacyAndSecuritySettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypePrivacyAndSecuritySettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeProxy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeProxy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypePublicChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypePublicChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeQrCodeAuthentication &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeQrCodeAuthentication &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeRestorePurchases &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeRestorePurchases &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeStickerSet &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeStickerSet &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeTheme &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeTheme &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeThemeSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeThemeSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeUnknownDeepLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeUnknownDeepLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeUnsupportedProxy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeUnsupportedProxy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeUserPhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeUserPhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeUserToken &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeUserToken &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeVideoChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeVideoChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::internalLinkTypeWebApp &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::internalLinkTypeWebApp &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::invoice &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::invoice &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::jsonObjectMember &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::jsonObjectMember &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::jsonValueNull &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::jsonValueNull &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::jsonValueBoolean &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::jsonValueBoolean &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::jsonValueNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::jsonValueNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::jsonValueString &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::jsonValueString &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::jsonValueArray &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::jsonValueArray &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::jsonValueObject &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::jsonValueObject &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::keyboardButton &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::keyboardButton &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::keyboardButtonTypeText &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::keyboardButtonTypeText &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::keyboardButtonTypeRequestPhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::keyboardButtonTypeRequestPhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::keyboardButtonTypeRequestLocation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::keyboardButtonTypeRequestLocation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::keyboardButtonTypeRequestPoll &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::keyboardButtonTypeRequestPoll &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::keyboardButtonTypeRequestUser &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::keyboardButtonTypeRequestUser &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::keyboardButtonTypeRequestChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::keyboardButtonTypeRequestChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::keyboardButtonTypeWebApp &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::keyboardButtonTypeWebApp &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::labeledPricePart &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::labeledPricePart &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::languagePackInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::languagePackInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::languagePackString &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::languagePackString &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::languagePackStringValueOrdinary &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::languagePackStringValueOrdinary &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::languagePackStringValuePluralized &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::languagePackStringValuePluralized &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::languagePackStringValueDeleted &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::languagePackStringValueDeleted &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::location &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::location &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::logStreamDefault &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::logStreamDefault &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::logStreamFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::logStreamFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::logStreamEmpty &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::logStreamEmpty &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::maskPointForehead &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::maskPointForehead &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::maskPointEyes &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::maskPointEyes &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::maskPointMouth &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::maskPointMouth &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::maskPointChin &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::maskPointChin &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::maskPosition &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::maskPosition &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageAutoDeleteTime &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageAutoDeleteTime &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageCopyOptions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageCopyOptions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageReplyToMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageReplyToMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageReplyToStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageReplyToStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSchedulingStateSendAtDate &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSchedulingStateSendAtDate &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSchedulingStateSendWhenOnline &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSchedulingStateSendWhenOnline &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSendOptions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSendOptions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSenderUser &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSenderUser &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSenderChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSenderChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSourceChatHistory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSourceChatHistory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSourceMessageThreadHistory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSourceMessageThreadHistory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSourceForumTopicHistory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSourceForumTopicHistory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSourceHistoryPreview &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSourceHistoryPreview &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSourceChatList &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSourceChatList &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSourceSearch &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSourceSearch &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSourceChatEventLog &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSourceChatEventLog &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSourceNotification &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSourceNotification &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSourceScreenshot &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSourceScreenshot &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageSourceOther &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageSourceOther &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::messageViewer &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::messageViewer &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::networkStatisticsEntryFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::networkStatisticsEntryFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::networkStatisticsEntryCall &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::networkStatisticsEntryCall &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::networkTypeNone &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::networkTypeNone &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::networkTypeMobile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::networkTypeMobile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::networkTypeMobileRoaming &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::networkTypeMobileRoaming &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::networkTypeWiFi &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::networkTypeWiFi &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::networkTypeOther &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::networkTypeOther &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::notificationSettingsScopePrivateChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::notificationSettingsScopePrivateChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::notificationSettingsScopeGroupChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::notificationSettingsScopeGroupChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::notificationSettingsScopeChannelChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::notificationSettingsScopeChannelChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::optionValueBoolean &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::optionValueBoolean &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::optionValueEmpty &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::optionValueEmpty &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::optionValueInteger &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::optionValueInteger &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::optionValueString &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::optionValueString &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::orderInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::orderInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypePersonalDetails &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypePersonalDetails &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypePassport &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypePassport &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypeDriverLicense &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypeDriverLicense &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypeIdentityCard &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypeIdentityCard &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypeInternalPassport &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypeInternalPassport &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypeAddress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypeAddress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypeUtilityBill &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypeUtilityBill &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypeBankStatement &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypeBankStatement &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypeRentalAgreement &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypeRentalAgreement &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypePassportRegistration &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypePassportRegistration &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypeTemporaryRegistration &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypeTemporaryRegistration &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypePhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypePhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::passportElementTypeEmailAddress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::passportElementTypeEmailAddress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::personalDetails &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::personalDetails &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::phoneNumberAuthenticationSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::phoneNumberAuthenticationSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::pollTypeRegular &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::pollTypeRegular &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::pollTypeQuiz &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::pollTypeQuiz &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureIncreasedLimits &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureIncreasedLimits &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureIncreasedUploadFileSize &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureIncreasedUploadFileSize &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureImprovedDownloadSpeed &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureImprovedDownloadSpeed &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureVoiceRecognition &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureVoiceRecognition &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureDisabledAds &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureDisabledAds &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureUniqueReactions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureUniqueReactions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureUniqueStickers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureUniqueStickers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureCustomEmoji &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureCustomEmoji &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureAdvancedChatManagement &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureAdvancedChatManagement &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureProfileBadge &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureProfileBadge &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureEmojiStatus &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureEmojiStatus &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureAnimatedProfilePhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureAnimatedProfilePhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureForumTopicIcon &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureForumTopicIcon &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureAppIcons &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureAppIcons &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumFeatureRealTimeChatTranslation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumFeatureRealTimeChatTranslation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeSupergroupCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeSupergroupCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypePinnedChatCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypePinnedChatCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeCreatedPublicChatCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeCreatedPublicChatCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeSavedAnimationCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeSavedAnimationCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeFavoriteStickerCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeFavoriteStickerCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeChatFolderCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeChatFolderCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeChatFolderChosenChatCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeChatFolderChosenChatCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypePinnedArchivedChatCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypePinnedArchivedChatCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeCaptionLength &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeCaptionLength &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeBioLength &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeBioLength &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeChatFolderInviteLinkCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeChatFolderInviteLinkCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeShareableChatFolderCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeShareableChatFolderCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumLimitTypeActiveStoryCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumLimitTypeActiveStoryCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumSourceLimitExceeded &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumSourceLimitExceeded &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumSourceFeature &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumSourceFeature &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumSourceLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumSourceLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::premiumSourceSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::premiumSourceSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::proxyTypeSocks5 &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::proxyTypeSocks5 &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::proxyTypeHttp &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::proxyTypeHttp &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::proxyTypeMtproto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::proxyTypeMtproto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::publicChatTypeHasUsername &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::publicChatTypeHasUsername &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::publicChatTypeIsLocationBased &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::publicChatTypeIsLocationBased &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reactionTypeEmoji &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reactionTypeEmoji &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reactionTypeCustomEmoji &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reactionTypeCustomEmoji &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::replyMarkupRemoveKeyboard &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::replyMarkupRemoveKeyboard &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::replyMarkupForceReply &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::replyMarkupForceReply &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::replyMarkupShowKeyboard &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::replyMarkupShowKeyboard &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::replyMarkupInlineKeyboard &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::replyMarkupInlineKeyboard &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportReasonSpam &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportReasonSpam &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportReasonViolence &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportReasonViolence &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportReasonPornography &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportReasonPornography &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportReasonChildAbuse &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportReasonChildAbuse &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportReasonCopyright &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportReasonCopyright &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportReasonUnrelatedLocation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportReasonUnrelatedLocation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportReasonFake &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportReasonFake &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportReasonIllegalDrugs &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportReasonIllegalDrugs &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportReasonPersonalDetails &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportReasonPersonalDetails &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportReasonCustom &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportReasonCustom &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::scopeAutosaveSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::scopeAutosaveSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::scopeNotificationSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::scopeNotificationSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterEmpty &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterEmpty &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterAnimation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterAnimation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterAudio &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterAudio &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterDocument &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterDocument &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterPhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterPhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterVideo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterVideo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterVoiceNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterVoiceNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterPhotoAndVideo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterPhotoAndVideo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterChatPhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterChatPhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterVideoNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterVideoNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterVoiceAndVideoNote &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterVoiceAndVideoNote &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterMention &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterMention &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterUnreadMention &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterUnreadMention &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterUnreadReaction &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterUnreadReaction &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterFailedToSend &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterFailedToSend &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessagesFilterPinned &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessagesFilterPinned &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::shippingOption &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::shippingOption &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::stickerFormatWebp &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::stickerFormatWebp &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::stickerFormatTgs &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::stickerFormatTgs &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::stickerFormatWebm &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::stickerFormatWebm &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::stickerTypeRegular &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::stickerTypeRegular &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::stickerTypeMask &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::stickerTypeMask &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::stickerTypeCustomEmoji &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::stickerTypeCustomEmoji &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::storePaymentPurposePremiumSubscription &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::storePaymentPurposePremiumSubscription &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::storePaymentPurposeGiftedPremium &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::storePaymentPurposeGiftedPremium &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::storyListMain &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::storyListMain &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::storyListArchive &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::storyListArchive &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::storyPrivacySettingsEveryone &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::storyPrivacySettingsEveryone &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::storyPrivacySettingsContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::storyPrivacySettingsContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::storyPrivacySettingsCloseFriends &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::storyPrivacySettingsCloseFriends &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::storyPrivacySettingsSelectedContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::storyPrivacySettingsSelectedContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::suggestedActionEnableArchiveAndMuteNewChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::suggestedActionEnableArchiveAndMuteNewChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::suggestedActionCheckPassword &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::suggestedActionCheckPassword &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::suggestedActionCheckPhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::suggestedActionCheckPhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::suggestedActionViewChecksHint &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::suggestedActionViewChecksHint &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::suggestedActionConvertToBroadcastGroup &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::suggestedActionConvertToBroadcastGroup &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::suggestedActionSetPassword &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::suggestedActionSetPassword &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::suggestedActionUpgradePremium &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::suggestedActionUpgradePremium &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::suggestedActionRestorePremium &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::suggestedActionRestorePremium &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::suggestedActionSubscribeToAnnualPremium &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::suggestedActionSubscribeToAnnualPremium &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::supergroupMembersFilterRecent &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::supergroupMembersFilterRecent &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::supergroupMembersFilterContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::supergroupMembersFilterContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::supergroupMembersFilterAdministrators &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::supergroupMembersFilterAdministrators &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::supergroupMembersFilterSearch &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::supergroupMembersFilterSearch &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::supergroupMembersFilterRestricted &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::supergroupMembersFilterRestricted &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::supergroupMembersFilterBanned &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::supergroupMembersFilterBanned &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::supergroupMembersFilterMention &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::supergroupMembersFilterMention &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::supergroupMembersFilterBots &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::supergroupMembersFilterBots &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::targetChatCurrent &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::targetChatCurrent &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::targetChatChosen &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::targetChatChosen &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::targetChatInternalLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::targetChatInternalLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testInt &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testInt &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testString &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testString &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntity &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntity &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeMention &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeMention &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeHashtag &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeHashtag &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeCashtag &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeCashtag &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeBotCommand &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeBotCommand &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeEmailAddress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeEmailAddress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypePhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypePhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeBankCardNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeBankCardNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeBold &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeBold &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeItalic &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeItalic &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeUnderline &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeUnderline &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeStrikethrough &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeStrikethrough &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeSpoiler &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeSpoiler &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypePre &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypePre &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypePreCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypePreCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeTextUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeTextUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeMentionName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeMentionName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeCustomEmoji &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeCustomEmoji &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textEntityTypeMediaTimestamp &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textEntityTypeMediaTimestamp &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textParseModeMarkdown &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textParseModeMarkdown &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::textParseModeHTML &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::textParseModeHTML &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::themeParameters &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::themeParameters &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::topChatCategoryUsers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::topChatCategoryUsers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::topChatCategoryBots &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::topChatCategoryBots &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::topChatCategoryGroups &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::topChatCategoryGroups &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::topChatCategoryChannels &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::topChatCategoryChannels &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::topChatCategoryInlineBots &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::topChatCategoryInlineBots &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::topChatCategoryCalls &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::topChatCategoryCalls &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::topChatCategoryForwardChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::topChatCategoryForwardChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingShowStatus &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingShowStatus &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingShowProfilePhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingShowProfilePhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingShowLinkInForwardedMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingShowLinkInForwardedMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingShowPhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingShowPhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingShowBio &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingShowBio &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingAllowChatInvites &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingAllowChatInvites &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingAllowCalls &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingAllowCalls &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingAllowPeerToPeerCalls &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingAllowPeerToPeerCalls &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingAllowFindingByPhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingAllowFindingByPhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingAllowPrivateVoiceAndVideoNoteMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingAllowPrivateVoiceAndVideoNoteMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingRuleAllowAll &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingRuleAllowAll &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingRuleAllowContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingRuleAllowContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingRuleAllowUsers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingRuleAllowUsers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingRuleAllowChatMembers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingRuleAllowChatMembers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingRuleRestrictAll &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingRuleRestrictAll &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingRuleRestrictContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingRuleRestrictContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingRuleRestrictUsers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingRuleRestrictUsers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingRuleRestrictChatMembers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingRuleRestrictChatMembers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::userPrivacySettingRules &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::userPrivacySettingRules &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::venue &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::venue &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::acceptCall &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::acceptCall &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::acceptTermsOfService &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::acceptTermsOfService &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addApplicationChangelog &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addApplicationChangelog &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addChatFolderByInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addChatFolderByInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addChatMember &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addChatMember &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addChatMembers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addChatMembers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addChatToList &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addChatToList &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addContact &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addContact &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addCustomServerLanguagePack &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addCustomServerLanguagePack &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addFavoriteSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addFavoriteSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addFileToDownloads &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addFileToDownloads &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addLocalMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addLocalMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addLogMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addLogMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addMessageReaction &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addMessageReaction &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addNetworkStatistics &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addNetworkStatistics &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addProxy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addProxy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addRecentSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addRecentSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addRecentlyFoundChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addRecentlyFoundChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addSavedAnimation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addSavedAnimation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addSavedNotificationSound &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addSavedNotificationSound &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::addStickerToSet &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::addStickerToSet &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::answerCallbackQuery &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::answerCallbackQuery &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::answerCustomQuery &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::answerCustomQuery &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::answerInlineQuery &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::answerInlineQuery &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::answerPreCheckoutQuery &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::answerPreCheckoutQuery &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::answerShippingQuery &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::answerShippingQuery &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::answerWebAppQuery &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::answerWebAppQuery &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::assignAppStoreTransaction &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::assignAppStoreTransaction &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::assignGooglePlayTransaction &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::assignGooglePlayTransaction &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::banChatMember &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::banChatMember &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::blockMessageSenderFromReplies &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::blockMessageSenderFromReplies &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::canPurchasePremium &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::canPurchasePremium &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::canTransferOwnership &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::canTransferOwnership &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::cancelDownloadFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::cancelDownloadFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::cancelPasswordReset &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::cancelPasswordReset &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::cancelPreliminaryUploadFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::cancelPreliminaryUploadFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::changeImportedContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::changeImportedContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::changePhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::changePhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::changeStickerSet &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::changeStickerSet &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkAuthenticationBotToken &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkAuthenticationBotToken &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkAuthenticationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkAuthenticationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkAuthenticationEmailCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkAuthenticationEmailCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkAuthenticationPassword &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkAuthenticationPassword &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkAuthenticationPasswordRecoveryCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkAuthenticationPasswordRecoveryCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkChangePhoneNumberCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkChangePhoneNumberCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkChatFolderInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkChatFolderInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkChatInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkChatInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkChatUsername &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkChatUsername &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkCreatedPublicChatsLimit &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkCreatedPublicChatsLimit &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkEmailAddressVerificationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkEmailAddressVerificationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkLoginEmailAddressCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkLoginEmailAddressCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkPasswordRecoveryCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkPasswordRecoveryCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkPhoneNumberConfirmationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkPhoneNumberConfirmationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkPhoneNumberVerificationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkPhoneNumberVerificationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkRecoveryEmailAddressCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkRecoveryEmailAddressCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::checkStickerSetName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::checkStickerSetName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::cleanFileName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::cleanFileName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::clearAllDraftMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::clearAllDraftMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::clearAutosaveSettingsExceptions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::clearAutosaveSettingsExceptions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::clearImportedContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::clearImportedContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::clearRecentEmojiStatuses &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::clearRecentEmojiStatuses &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::clearRecentReactions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::clearRecentReactions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::clearRecentStickers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::clearRecentStickers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::clearRecentlyFoundChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::clearRecentlyFoundChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::clickAnimatedEmojiMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::clickAnimatedEmojiMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::clickChatSponsoredMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::clickChatSponsoredMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::clickPremiumSubscriptionButton &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::clickPremiumSubscriptionButton &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::close &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::close &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::closeChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::closeChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::closeSecretChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::closeSecretChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::closeStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::closeStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::closeWebApp &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::closeWebApp &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::confirmQrCodeAuthentication &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::confirmQrCodeAuthentication &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createBasicGroupChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createBasicGroupChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createCall &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createCall &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createChatFolder &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createChatFolder &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createChatFolderInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createChatFolderInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createChatInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createChatInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createForumTopic &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createForumTopic &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createInvoiceLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createInvoiceLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createNewBasicGroupChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createNewBasicGroupChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createNewSecretChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createNewSecretChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createNewStickerSet &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createNewStickerSet &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createNewSupergroupChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createNewSupergroupChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createPrivateChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createPrivateChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createSecretChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createSecretChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createSupergroupChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createSupergroupChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createTemporaryPassword &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createTemporaryPassword &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::createVideoChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::createVideoChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteAccount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteAccount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteAllCallMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteAllCallMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteAllRevokedChatInviteLinks &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteAllRevokedChatInviteLinks &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteChatFolder &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteChatFolder &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteChatFolderInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteChatFolderInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteChatHistory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteChatHistory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteChatMessagesByDate &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteChatMessagesByDate &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteChatMessagesBySender &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteChatMessagesBySender &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteChatReplyMarkup &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteChatReplyMarkup &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteCommands &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteCommands &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteForumTopic &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteForumTopic &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteLanguagePack &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteLanguagePack &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deletePassportElement &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deletePassportElement &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteProfilePhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteProfilePhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteRevokedChatInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteRevokedChatInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteSavedCredentials &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteSavedCredentials &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteSavedOrderInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteSavedOrderInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteStickerSet &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteStickerSet &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::deleteStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::deleteStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::destroy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::destroy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::disableAllSupergroupUsernames &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::disableAllSupergroupUsernames &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::disableProxy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::disableProxy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::discardCall &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::discardCall &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::disconnectAllWebsites &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::disconnectAllWebsites &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::disconnectWebsite &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::disconnectWebsite &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::downloadFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::downloadFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editChatFolder &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editChatFolder &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editChatFolderInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editChatFolderInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editChatInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editChatInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editCustomLanguagePackInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editCustomLanguagePackInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editForumTopic &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editForumTopic &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editInlineMessageCaption &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editInlineMessageCaption &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editInlineMessageLiveLocation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editInlineMessageLiveLocation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editInlineMessageMedia &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editInlineMessageMedia &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editInlineMessageReplyMarkup &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editInlineMessageReplyMarkup &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editInlineMessageText &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editInlineMessageText &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editMessageCaption &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editMessageCaption &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editMessageLiveLocation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editMessageLiveLocation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editMessageMedia &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editMessageMedia &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editMessageReplyMarkup &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editMessageReplyMarkup &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editMessageSchedulingState &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editMessageSchedulingState &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editMessageText &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editMessageText &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editProxy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editProxy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::editStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::editStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::enableProxy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::enableProxy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::endGroupCall &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::endGroupCall &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::endGroupCallRecording &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::endGroupCallRecording &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::endGroupCallScreenSharing &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::endGroupCallScreenSharing &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::finishFileGeneration &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::finishFileGeneration &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::forwardMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::forwardMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getAccountTtl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getAccountTtl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getActiveLiveLocationMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getActiveLiveLocationMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getActiveSessions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getActiveSessions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getActorStatistics &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getActorStatistics &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getAllPassportElements &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getAllPassportElements &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getAnimatedEmoji &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getAnimatedEmoji &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getApplicationConfig &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getApplicationConfig &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getApplicationDownloadLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getApplicationDownloadLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getArchiveChatListSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getArchiveChatListSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getArchivedStickerSets &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getArchivedStickerSets &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getArchivedStories &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getArchivedStories &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getAttachedStickerSets &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getAttachedStickerSets &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getAttachmentMenuBot &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getAttachmentMenuBot &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getAuthorizationState &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getAuthorizationState &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getAutoDownloadSettingsPresets &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getAutoDownloadSettingsPresets &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getAutosaveSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getAutosaveSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getBackgroundUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getBackgroundUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getBackgrounds &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getBackgrounds &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getBankCardInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getBankCardInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getBasicGroup &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getBasicGroup &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getBasicGroupFullInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getBasicGroupFullInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getBlockedMessageSenders &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getBlockedMessageSenders &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getBotInfoDescription &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getBotInfoDescription &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getBotInfoShortDescription &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getBotInfoShortDescription &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getBotName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getBotName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getCallbackQueryAnswer &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getCallbackQueryAnswer &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getCallbackQueryMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getCallbackQueryMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatActiveStories &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatActiveStories &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatAdministrators &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatAdministrators &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatAvailableMessageSenders &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatAvailableMessageSenders &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatEventLog &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatEventLog &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatFolder &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatFolder &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatFolderChatCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatFolderChatCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatFolderChatsToLeave &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatFolderChatsToLeave &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatFolderDefaultIconName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatFolderDefaultIconName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatFolderInviteLinks &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatFolderInviteLinks &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatFolderNewChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatFolderNewChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatHistory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatHistory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatInviteLinkCounts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatInviteLinkCounts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatInviteLinkMembers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatInviteLinkMembers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatInviteLinks &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatInviteLinks &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatJoinRequests &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatJoinRequests &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatListsToAddChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatListsToAddChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatMember &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatMember &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatMessageByDate &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatMessageByDate &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatMessageCalendar &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatMessageCalendar &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatMessageCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatMessageCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatMessagePosition &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatMessagePosition &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatNotificationSettingsExceptions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatNotificationSettingsExceptions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatPinnedMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatPinnedMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatPinnedStories &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatPinnedStories &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatScheduledMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatScheduledMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatSparseMessagePositions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatSparseMessagePositions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatSponsoredMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatSponsoredMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatStatistics &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatStatistics &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getChatsForChatFolderInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getChatsForChatFolderInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getCloseFriends &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getCloseFriends &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getCommands &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getCommands &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getConnectedWebsites &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getConnectedWebsites &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getCountries &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getCountries &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getCountryCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getCountryCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getCreatedPublicChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getCreatedPublicChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getCurrentState &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getCurrentState &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getCustomEmojiReactionAnimations &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getCustomEmojiReactionAnimations &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getCustomEmojiStickers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getCustomEmojiStickers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getDatabaseStatistics &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getDatabaseStatistics &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getDeepLinkInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getDeepLinkInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getDefaultChatPhotoCustomEmojiStickers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getDefaultChatPhotoCustomEmojiStickers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getDefaultEmojiStatuses &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getDefaultEmojiStatuses &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getDefaultMessageAutoDeleteTime &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getDefaultMessageAutoDeleteTime &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getDefaultProfilePhotoCustomEmojiStickers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getDefaultProfilePhotoCustomEmojiStickers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getEmojiCategories &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getEmojiCategories &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getEmojiReaction &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getEmojiReaction &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getEmojiSuggestionsUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getEmojiSuggestionsUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getExternalLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getExternalLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getExternalLinkInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getExternalLinkInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getFavoriteStickers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getFavoriteStickers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getFileDownloadedPrefixSize &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getFileDownloadedPrefixSize &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getFileExtension &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getFileExtension &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getFileMimeType &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getFileMimeType &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getForumTopic &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getForumTopic &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getForumTopicDefaultIcons &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getForumTopicDefaultIcons &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getForumTopicLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getForumTopicLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getForumTopics &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getForumTopics &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getGameHighScores &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getGameHighScores &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getGroupCall &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getGroupCall &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getGroupCallInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getGroupCallInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getGroupCallStreamSegment &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getGroupCallStreamSegment &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getGroupCallStreams &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getGroupCallStreams &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getGroupsInCommon &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getGroupsInCommon &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getImportedContactCount &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getImportedContactCount &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getInactiveSupergroupChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getInactiveSupergroupChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getInlineGameHighScores &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getInlineGameHighScores &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getInlineQueryResults &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getInlineQueryResults &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getInstalledStickerSets &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getInstalledStickerSets &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getInternalLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getInternalLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getInternalLinkType &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getInternalLinkType &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getJsonString &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getJsonString &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getJsonValue &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getJsonValue &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getLanguagePackInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getLanguagePackInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getLanguagePackString &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getLanguagePackString &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getLanguagePackStrings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getLanguagePackStrings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getLocalizationTargetInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getLocalizationTargetInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getLogStream &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getLogStream &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getLogTagVerbosityLevel &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getLogTagVerbosityLevel &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getLogTags &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getLogTags &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getLogVerbosityLevel &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getLogVerbosityLevel &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getLoginUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getLoginUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getLoginUrlInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getLoginUrlInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMapThumbnailFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMapThumbnailFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMarkdownText &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMarkdownText &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMe &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMe &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMenuButton &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMenuButton &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageAddedReactions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageAddedReactions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageAvailableReactions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageAvailableReactions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageEmbeddingCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageEmbeddingCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageFileType &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageFileType &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageImportConfirmationText &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageImportConfirmationText &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageLinkInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageLinkInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageLocally &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageLocally &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessagePublicForwards &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessagePublicForwards &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageStatistics &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageStatistics &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageThread &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageThread &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageThreadHistory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageThreadHistory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessageViewers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessageViewers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getNetworkStatistics &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getNetworkStatistics &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getOption &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getOption &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPassportAuthorizationForm &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPassportAuthorizationForm &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPassportAuthorizationFormAvailableElements &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPassportAuthorizationFormAvailableElements &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPassportElement &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPassportElement &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPasswordState &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPasswordState &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPaymentForm &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPaymentForm &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPaymentReceipt &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPaymentReceipt &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPhoneNumberInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPhoneNumberInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPhoneNumberInfoSync &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPhoneNumberInfoSync &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPollVoters &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPollVoters &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPreferredCountryLanguage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPreferredCountryLanguage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPremiumFeatures &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPremiumFeatures &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPremiumLimit &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPremiumLimit &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPremiumState &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPremiumState &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPremiumStickerExamples &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPremiumStickerExamples &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPremiumStickers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPremiumStickers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getProxies &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getProxies &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getProxyLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getProxyLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getPushReceiverId &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getPushReceiverId &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getRecentEmojiStatuses &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getRecentEmojiStatuses &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getRecentInlineBots &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getRecentInlineBots &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getRecentStickers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getRecentStickers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getRecentlyOpenedChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getRecentlyOpenedChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getRecentlyVisitedTMeUrls &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getRecentlyVisitedTMeUrls &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getRecommendedChatFolders &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getRecommendedChatFolders &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getRecoveryEmailAddress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getRecoveryEmailAddress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getRemoteFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getRemoteFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getRepliedMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getRepliedMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSavedAnimations &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSavedAnimations &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSavedNotificationSound &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSavedNotificationSound &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSavedNotificationSounds &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSavedNotificationSounds &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSavedOrderInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSavedOrderInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getScopeNotificationSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getScopeNotificationSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSecretChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSecretChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getStatisticalGraph &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getStatisticalGraph &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getStickerEmojis &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getStickerEmojis &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getStickerSet &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getStickerSet &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getStickers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getStickers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getStorageStatistics &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getStorageStatistics &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getStorageStatisticsFast &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getStorageStatisticsFast &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getStoryNotificationSettingsExceptions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getStoryNotificationSettingsExceptions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getStoryViewers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getStoryViewers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSuggestedFileName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSuggestedFileName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSuggestedStickerSetName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSuggestedStickerSetName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSuitableDiscussionChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSuitableDiscussionChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSupergroup &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSupergroup &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSupergroupFullInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSupergroupFullInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSupergroupMembers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSupergroupMembers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSupportName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSupportName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getSupportUser &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getSupportUser &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getTemporaryPasswordState &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getTemporaryPasswordState &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getTextEntities &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getTextEntities &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getThemeParametersJsonString &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getThemeParametersJsonString &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getThemedEmojiStatuses &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getThemedEmojiStatuses &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getTopChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getTopChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getTrendingStickerSets &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getTrendingStickerSets &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getUser &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getUser &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getUserFullInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getUserFullInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getUserLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getUserLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getUserPrivacySettingRules &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getUserPrivacySettingRules &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getUserProfilePhotos &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getUserProfilePhotos &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getUserSupportInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getUserSupportInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getVideoChatAvailableParticipants &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getVideoChatAvailableParticipants &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getVideoChatRtmpUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getVideoChatRtmpUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getWebAppLinkUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getWebAppLinkUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getWebAppUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getWebAppUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getWebPageInstantView &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getWebPageInstantView &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::getWebPagePreview &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::getWebPagePreview &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::hideSuggestedAction &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::hideSuggestedAction &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::importContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::importContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::importMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::importMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::inviteGroupCallParticipants &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::inviteGroupCallParticipants &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::joinChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::joinChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::joinChatByInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::joinChatByInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::joinGroupCall &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::joinGroupCall &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::leaveChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::leaveChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::leaveGroupCall &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::leaveGroupCall &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::loadActiveStories &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::loadActiveStories &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::loadChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::loadChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::loadGroupCallParticipants &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::loadGroupCallParticipants &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::logOut &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::logOut &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::openChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::openChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::openMessageContent &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::openMessageContent &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::openStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::openStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::openWebApp &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::openWebApp &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::optimizeStorage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::optimizeStorage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::parseMarkdown &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::parseMarkdown &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::parseTextEntities &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::parseTextEntities &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::pinChatMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::pinChatMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::pingProxy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::pingProxy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::preliminaryUploadFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::preliminaryUploadFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::processChatFolderNewChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::processChatFolderNewChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::processChatJoinRequest &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::processChatJoinRequest &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::processChatJoinRequests &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::processChatJoinRequests &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::processPushNotification &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::processPushNotification &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::rateSpeechRecognition &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::rateSpeechRecognition &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::readAllChatMentions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::readAllChatMentions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::readAllChatReactions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::readAllChatReactions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::readAllMessageThreadMentions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::readAllMessageThreadMentions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::readAllMessageThreadReactions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::readAllMessageThreadReactions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::readChatList &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::readChatList &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::readFilePart &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::readFilePart &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::recognizeSpeech &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::recognizeSpeech &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::recoverAuthenticationPassword &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::recoverAuthenticationPassword &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::recoverPassword &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::recoverPassword &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::registerDevice &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::registerDevice &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::registerUser &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::registerUser &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeAllFilesFromDownloads &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeAllFilesFromDownloads &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeBackground &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeBackground &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeChatActionBar &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeChatActionBar &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeFavoriteSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeFavoriteSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeFileFromDownloads &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeFileFromDownloads &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeMessageReaction &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeMessageReaction &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeNotification &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeNotification &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeNotificationGroup &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeNotificationGroup &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeProxy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeProxy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeRecentHashtag &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeRecentHashtag &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeRecentSticker &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeRecentSticker &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeRecentlyFoundChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeRecentlyFoundChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeSavedAnimation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeSavedAnimation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeSavedNotificationSound &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeSavedNotificationSound &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeStickerFromSet &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeStickerFromSet &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::removeTopChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::removeTopChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reorderActiveUsernames &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reorderActiveUsernames &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reorderBotActiveUsernames &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reorderBotActiveUsernames &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reorderChatFolders &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reorderChatFolders &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reorderInstalledStickerSets &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reorderInstalledStickerSets &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reorderSupergroupActiveUsernames &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reorderSupergroupActiveUsernames &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::replacePrimaryChatInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::replacePrimaryChatInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::replaceVideoChatRtmpUrl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::replaceVideoChatRtmpUrl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportChatPhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportChatPhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportMessageReactions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportMessageReactions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportSupergroupAntiSpamFalsePositive &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportSupergroupAntiSpamFalsePositive &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::reportSupergroupSpam &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::reportSupergroupSpam &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::requestAuthenticationPasswordRecovery &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::requestAuthenticationPasswordRecovery &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::requestPasswordRecovery &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::requestPasswordRecovery &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::requestQrCodeAuthentication &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::requestQrCodeAuthentication &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resendAuthenticationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resendAuthenticationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resendChangePhoneNumberCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resendChangePhoneNumberCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resendEmailAddressVerificationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resendEmailAddressVerificationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resendLoginEmailAddressCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resendLoginEmailAddressCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resendMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resendMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resendPhoneNumberConfirmationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resendPhoneNumberConfirmationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resendPhoneNumberVerificationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resendPhoneNumberVerificationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resendRecoveryEmailAddressCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resendRecoveryEmailAddressCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resetAllNotificationSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resetAllNotificationSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resetAuthenticationEmailAddress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resetAuthenticationEmailAddress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resetBackgrounds &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resetBackgrounds &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resetNetworkStatistics &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resetNetworkStatistics &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::resetPassword &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::resetPassword &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::revokeChatInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::revokeChatInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::revokeGroupCallInviteLink &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::revokeGroupCallInviteLink &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::saveApplicationLogEvent &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::saveApplicationLogEvent &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchBackground &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchBackground &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchCallMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchCallMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchChatMembers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchChatMembers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchChatMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchChatMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchChatRecentLocationMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchChatRecentLocationMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchChatsNearby &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchChatsNearby &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchChatsOnServer &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchChatsOnServer &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchContacts &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchContacts &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchEmojis &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchEmojis &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchFileDownloads &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchFileDownloads &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchHashtags &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchHashtags &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchInstalledStickerSets &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchInstalledStickerSets &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchOutgoingDocumentMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchOutgoingDocumentMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchPublicChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchPublicChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchPublicChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchPublicChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchRecentlyFoundChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchRecentlyFoundChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchSecretMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchSecretMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchStickerSet &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchStickerSet &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchStickerSets &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchStickerSets &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchStickers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchStickers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchUserByPhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchUserByPhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchUserByToken &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchUserByToken &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::searchWebApp &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::searchWebApp &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendAuthenticationFirebaseSms &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendAuthenticationFirebaseSms &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendBotStartMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendBotStartMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendCallDebugInformation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendCallDebugInformation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendCallLog &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendCallLog &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendCallRating &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendCallRating &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendCallSignalingData &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendCallSignalingData &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendChatAction &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendChatAction &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendCustomRequest &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendCustomRequest &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendEmailAddressVerificationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendEmailAddressVerificationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendInlineQueryResultMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendInlineQueryResultMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendMessageAlbum &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendMessageAlbum &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendPassportAuthorizationForm &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendPassportAuthorizationForm &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendPaymentForm &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendPaymentForm &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendPhoneNumberConfirmationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendPhoneNumberConfirmationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendPhoneNumberVerificationCode &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendPhoneNumberVerificationCode &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendStory &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendStory &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sendWebAppData &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sendWebAppData &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setAccountTtl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setAccountTtl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setAlarm &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setAlarm &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setArchiveChatListSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setArchiveChatListSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setAuthenticationEmailAddress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setAuthenticationEmailAddress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setAuthenticationPhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setAuthenticationPhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setAutoDownloadSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setAutoDownloadSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setAutosaveSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setAutosaveSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setBackground &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setBackground &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setBio &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setBio &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setBotInfoDescription &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setBotInfoDescription &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setBotInfoShortDescription &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setBotInfoShortDescription &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setBotName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setBotName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setBotProfilePhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setBotProfilePhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setBotUpdatesStatus &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setBotUpdatesStatus &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatActiveStoriesList &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatActiveStoriesList &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatAvailableReactions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatAvailableReactions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatBackground &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatBackground &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatClientData &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatClientData &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatDescription &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatDescription &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatDiscussionGroup &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatDiscussionGroup &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatDraftMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatDraftMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatLocation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatLocation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatMemberStatus &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatMemberStatus &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatMessageAutoDeleteTime &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatMessageAutoDeleteTime &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatMessageSender &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatMessageSender &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatNotificationSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatNotificationSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatPermissions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatPermissions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatPhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatPhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatSlowModeDelay &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatSlowModeDelay &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatTheme &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatTheme &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setChatTitle &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setChatTitle &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setCloseFriends &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setCloseFriends &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setCommands &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setCommands &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setCustomEmojiStickerSetThumbnail &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setCustomEmojiStickerSetThumbnail &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setCustomLanguagePack &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setCustomLanguagePack &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setCustomLanguagePackString &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setCustomLanguagePackString &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setDatabaseEncryptionKey &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setDatabaseEncryptionKey &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setDefaultChannelAdministratorRights &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setDefaultChannelAdministratorRights &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setDefaultGroupAdministratorRights &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setDefaultGroupAdministratorRights &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setDefaultMessageAutoDeleteTime &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setDefaultMessageAutoDeleteTime &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setDefaultReactionType &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setDefaultReactionType &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setEmojiStatus &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setEmojiStatus &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setFileGenerationProgress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setFileGenerationProgress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setForumTopicNotificationSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setForumTopicNotificationSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setGameScore &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setGameScore &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setGroupCallParticipantIsSpeaking &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setGroupCallParticipantIsSpeaking &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setGroupCallParticipantVolumeLevel &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setGroupCallParticipantVolumeLevel &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setGroupCallTitle &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setGroupCallTitle &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setInactiveSessionTtl &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setInactiveSessionTtl &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setInlineGameScore &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setInlineGameScore &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setLocation &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setLocation &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setLogStream &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setLogStream &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setLogTagVerbosityLevel &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setLogTagVerbosityLevel &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setLogVerbosityLevel &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setLogVerbosityLevel &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setLoginEmailAddress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setLoginEmailAddress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setMenuButton &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setMenuButton &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setName &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setName &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setNetworkType &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setNetworkType &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setOption &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setOption &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setPassportElement &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setPassportElement &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setPassportElementErrors &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setPassportElementErrors &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setPassword &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setPassword &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setPinnedChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setPinnedChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setPinnedForumTopics &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setPinnedForumTopics &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setPollAnswer &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setPollAnswer &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setProfilePhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setProfilePhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setRecoveryEmailAddress &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setRecoveryEmailAddress &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setScopeNotificationSettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setScopeNotificationSettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setStickerEmojis &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setStickerEmojis &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setStickerKeywords &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setStickerKeywords &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setStickerMaskPosition &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setStickerMaskPosition &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setStickerPositionInSet &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setStickerPositionInSet &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setStickerSetThumbnail &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setStickerSetThumbnail &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setStickerSetTitle &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setStickerSetTitle &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setStoryPrivacySettings &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setStoryPrivacySettings &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setSupergroupStickerSet &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setSupergroupStickerSet &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setSupergroupUsername &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setSupergroupUsername &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setTdlibParameters &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setTdlibParameters &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setUserPersonalProfilePhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setUserPersonalProfilePhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setUserPrivacySettingRules &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setUserPrivacySettingRules &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setUserSupportInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setUserSupportInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setUsername &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setUsername &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::setVideoChatDefaultParticipant &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::setVideoChatDefaultParticipant &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::shareChatWithBot &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::shareChatWithBot &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::sharePhoneNumber &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::sharePhoneNumber &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::shareUserWithBot &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::shareUserWithBot &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::startGroupCallRecording &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::startGroupCallRecording &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::startGroupCallScreenSharing &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::startGroupCallScreenSharing &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::startScheduledGroupCall &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::startScheduledGroupCall &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::stopPoll &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::stopPoll &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::suggestUserProfilePhoto &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::suggestUserProfilePhoto &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::synchronizeLanguagePack &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::synchronizeLanguagePack &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::terminateAllOtherSessions &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::terminateAllOtherSessions &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::terminateSession &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::terminateSession &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testCallBytes &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testCallBytes &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testCallEmpty &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testCallEmpty &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testCallString &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testCallString &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testCallVectorInt &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testCallVectorInt &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testCallVectorIntObject &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testCallVectorIntObject &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testCallVectorString &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testCallVectorString &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testCallVectorStringObject &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testCallVectorStringObject &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testGetDifference &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testGetDifference &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testNetwork &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testNetwork &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testProxy &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testProxy &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testReturnError &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testReturnError &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testSquareInt &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testSquareInt &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::testUseUpdate &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::testUseUpdate &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleAllDownloadsArePaused &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleAllDownloadsArePaused &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleBotIsAddedToAttachmentMenu &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleBotIsAddedToAttachmentMenu &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleBotUsernameIsActive &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleBotUsernameIsActive &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleChatDefaultDisableNotification &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleChatDefaultDisableNotification &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleChatHasProtectedContent &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleChatHasProtectedContent &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleChatIsMarkedAsUnread &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleChatIsMarkedAsUnread &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleChatIsPinned &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleChatIsPinned &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleChatIsTranslatable &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleChatIsTranslatable &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleDownloadIsPaused &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleDownloadIsPaused &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleForumTopicIsClosed &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleForumTopicIsClosed &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleForumTopicIsPinned &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleForumTopicIsPinned &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleGeneralForumTopicIsHidden &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleGeneralForumTopicIsHidden &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleGroupCallEnabledStartNotification &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleGroupCallEnabledStartNotification &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleGroupCallIsMyVideoEnabled &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleGroupCallIsMyVideoEnabled &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleGroupCallIsMyVideoPaused &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleGroupCallIsMyVideoPaused &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleGroupCallMuteNewParticipants &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleGroupCallMuteNewParticipants &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleGroupCallParticipantIsHandRaised &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleGroupCallParticipantIsHandRaised &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleGroupCallParticipantIsMuted &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleGroupCallParticipantIsMuted &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleGroupCallScreenSharingIsPaused &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleGroupCallScreenSharingIsPaused &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleMessageSenderIsBlocked &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleMessageSenderIsBlocked &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSessionCanAcceptCalls &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSessionCanAcceptCalls &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSessionCanAcceptSecretChats &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSessionCanAcceptSecretChats &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleStoryIsPinned &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleStoryIsPinned &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSupergroupHasAggressiveAntiSpamEnabled &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSupergroupHasAggressiveAntiSpamEnabled &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSupergroupHasHiddenMembers &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSupergroupHasHiddenMembers &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSupergroupIsAllHistoryAvailable &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSupergroupIsAllHistoryAvailable &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSupergroupIsBroadcastGroup &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSupergroupIsBroadcastGroup &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSupergroupIsForum &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSupergroupIsForum &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSupergroupJoinByRequest &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSupergroupJoinByRequest &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSupergroupJoinToSendMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSupergroupJoinToSendMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSupergroupSignMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSupergroupSignMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleSupergroupUsernameIsActive &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleSupergroupUsernameIsActive &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::toggleUsernameIsActive &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::toggleUsernameIsActive &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::transferChatOwnership &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::transferChatOwnership &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::translateMessageText &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::translateMessageText &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::translateText &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::translateText &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::unpinAllChatMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::unpinAllChatMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::unpinAllMessageThreadMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::unpinAllMessageThreadMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::unpinChatMessage &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::unpinChatMessage &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::upgradeBasicGroupChatToSupergroupChat &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::upgradeBasicGroupChatToSupergroupChat &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::uploadStickerFile &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::uploadStickerFile &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::validateOrderInfo &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::validateOrderInfo &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::viewMessages &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::viewMessages &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::viewPremiumFeature &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::viewPremiumFeature &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::viewTrendingStickerSets &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::viewTrendingStickerSets &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+Status from_json(td_api::writeGeneratedFilePart &to, JsonObject &from);
+
+Result<bool> from_json_field(td_api::writeGeneratedFilePart &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields);
+
+void to_json(JsonValueScope &jv, const td_api::accountTtl &object);
+
+void to_json(JsonValueScope &jv, const td_api::actorStatistics &object);
+
+void to_json(JsonValueScope &jv, const td_api::addedReaction &object);
+
+void to_json(JsonValueScope &jv, const td_api::addedReactions &object);
+
+void to_json(JsonValueScope &jv, const td_api::address &object);
+
+void to_json(JsonValueScope &jv, const td_api::animatedChatPhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::animatedEmoji &object);
+
+void to_json(JsonValueScope &jv, const td_api::animation &object);
+
+void to_json(JsonValueScope &jv, const td_api::animations &object);
+
+void to_json(JsonValueScope &jv, const td_api::archiveChatListSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::attachmentMenuBot &object);
+
+void to_json(JsonValueScope &jv, const td_api::attachmentMenuBotColor &object);
+
+void to_json(JsonValueScope &jv, const td_api::audio &object);
+
+void to_json(JsonValueScope &jv, const td_api::authenticationCodeInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::AuthenticationCodeType &object);
+
+void to_json(JsonValueScope &jv, const td_api::authenticationCodeTypeTelegramMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::authenticationCodeTypeSms &object);
+
+void to_json(JsonValueScope &jv, const td_api::authenticationCodeTypeCall &object);
+
+void to_json(JsonValueScope &jv, const td_api::authenticationCodeTypeFlashCall &object);
+
+void to_json(JsonValueScope &jv, const td_api::authenticationCodeTypeMissedCall &object);
+
+void to_json(JsonValueScope &jv, const td_api::authenticationCodeTypeFragment &object);
+
+void to_json(JsonValueScope &jv, const td_api::authenticationCodeTypeFirebaseAndroid &object);
+
+void to_json(JsonValueScope &jv, const td_api::authenticationCodeTypeFirebaseIos &object);
+
+void to_json(JsonValueScope &jv, const td_api::AuthorizationState &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateWaitTdlibParameters &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateWaitPhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateWaitEmailAddress &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateWaitEmailCode &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateWaitCode &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateWaitOtherDeviceConfirmation &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateWaitRegistration &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateWaitPassword &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateReady &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateLoggingOut &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateClosing &object);
+
+void to_json(JsonValueScope &jv, const td_api::authorizationStateClosed &object);
+
+void to_json(JsonValueScope &jv, const td_api::autoDownloadSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::autoDownloadSettingsPresets &object);
+
+void to_json(JsonValueScope &jv, const td_api::autosaveSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::autosaveSettingsException &object);
+
+void to_json(JsonValueScope &jv, const td_api::AutosaveSettingsScope &object);
+
+void to_json(JsonValueScope &jv, const td_api::autosaveSettingsScopePrivateChats &object);
+
+void to_json(JsonValueScope &jv, const td_api::autosaveSettingsScopeGroupChats &object);
+
+void to_json(JsonValueScope &jv, const td_api::autosaveSettingsScopeChannelChats &object);
+
+void to_json(JsonValueScope &jv, const td_api::autosaveSettingsScopeChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::availableReaction &object);
+
+void to_json(JsonValueScope &jv, const td_api::availableReactions &object);
+
+void to_json(JsonValueScope &jv, const td_api::background &object);
+
+void to_json(JsonValueScope &jv, const td_api::BackgroundFill &object);
+
+void to_json(JsonValueScope &jv, const td_api::backgroundFillSolid &object);
+
+void to_json(JsonValueScope &jv, const td_api::backgroundFillGradient &object);
+
+void to_json(JsonValueScope &jv, const td_api::backgroundFillFreeformGradient &object);
+
+void to_json(JsonValueScope &jv, const td_api::BackgroundType &object);
+
+void to_json(JsonValueScope &jv, const td_api::backgroundTypeWallpaper &object);
+
+void to_json(JsonValueScope &jv, const td_api::backgroundTypePattern &object);
+
+void to_json(JsonValueScope &jv, const td_api::backgroundTypeFill &object);
+
+void to_json(JsonValueScope &jv, const td_api::backgrounds &object);
+
+void to_json(JsonValueScope &jv, const td_api::bankCardActionOpenUrl &object);
+
+void to_json(JsonValueScope &jv, const td_api::bankCardInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::basicGroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::basicGroupFullInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::botCommand &object);
+
+void to_json(JsonValueScope &jv, const td_api::botCommands &object);
+
+void to_json(JsonValueScope &jv, const td_api::botInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::botMenuButton &object);
+
+void to_json(JsonValueScope &jv, const td_api::call &object);
+
+void to_json(JsonValueScope &jv, const td_api::CallDiscardReason &object);
+
+void to_json(JsonValueScope &jv, const td_api::callDiscardReasonEmpty &object);
+
+void to_json(JsonValueScope &jv, const td_api::callDiscardReasonMissed &object);
+
+void to_json(JsonValueScope &jv, const td_api::callDiscardReasonDeclined &object);
+
+void to_json(JsonValueScope &jv, const td_api::callDiscardReasonDisconnected &object);
+
+void to_json(JsonValueScope &jv, const td_api::callDiscardReasonHungUp &object);
+
+void to_json(JsonValueScope &jv, const td_api::callId &object);
+
+void to_json(JsonValueScope &jv, const td_api::callProtocol &object);
+
+void to_json(JsonValueScope &jv, const td_api::callServer &object);
+
+void to_json(JsonValueScope &jv, const td_api::CallServerType &object);
+
+void to_json(JsonValueScope &jv, const td_api::callServerTypeTelegramReflector &object);
+
+void to_json(JsonValueScope &jv, const td_api::callServerTypeWebrtc &object);
+
+void to_json(JsonValueScope &jv, const td_api::CallState &object);
+
+void to_json(JsonValueScope &jv, const td_api::callStatePending &object);
+
+void to_json(JsonValueScope &jv, const td_api::callStateExchangingKeys &object);
+
+void to_json(JsonValueScope &jv, const td_api::callStateReady &object);
+
+void to_json(JsonValueScope &jv, const td_api::callStateHangingUp &object);
+
+void to_json(JsonValueScope &jv, const td_api::callStateDiscarded &object);
+
+void to_json(JsonValueScope &jv, const td_api::callStateError &object);
+
+void to_json(JsonValueScope &jv, const td_api::callbackQueryAnswer &object);
+
+void to_json(JsonValueScope &jv, const td_api::CallbackQueryPayload &object);
+
+void to_json(JsonValueScope &jv, const td_api::callbackQueryPayloadData &object);
+
+void to_json(JsonValueScope &jv, const td_api::callbackQueryPayloadDataWithPassword &object);
+
+void to_json(JsonValueScope &jv, const td_api::callbackQueryPayloadGame &object);
+
+void to_json(JsonValueScope &jv, const td_api::CanTransferOwnershipResult &object);
+
+void to_json(JsonValueScope &jv, const td_api::canTransferOwnershipResultOk &object);
+
+void to_json(JsonValueScope &jv, const td_api::canTransferOwnershipResultPasswordNeeded &object);
+
+void to_json(JsonValueScope &jv, const td_api::canTransferOwnershipResultPasswordTooFresh &object);
+
+void to_json(JsonValueScope &jv, const td_api::canTransferOwnershipResultSessionTooFresh &object);
+
+void to_json(JsonValueScope &jv, const td_api::chat &object);
+
+void to_json(JsonValueScope &jv, const td_api::ChatAction &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionTyping &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionRecordingVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionUploadingVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionRecordingVoiceNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionUploadingVoiceNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionUploadingPhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionUploadingDocument &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionChoosingSticker &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionChoosingLocation &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionChoosingContact &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionStartPlayingGame &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionRecordingVideoNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionUploadingVideoNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionWatchingAnimations &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionCancel &object);
+
+void to_json(JsonValueScope &jv, const td_api::ChatActionBar &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionBarReportSpam &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionBarReportUnrelatedLocation &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionBarInviteMembers &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionBarReportAddBlock &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionBarAddContact &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionBarSharePhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActionBarJoinRequest &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatActiveStories &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatAdministrator &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatAdministratorRights &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatAdministrators &object);
+
+void to_json(JsonValueScope &jv, const td_api::ChatAvailableReactions &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatAvailableReactionsAll &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatAvailableReactionsSome &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatBackground &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEvent &object);
+
+void to_json(JsonValueScope &jv, const td_api::ChatEventAction &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMessageEdited &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMessageDeleted &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMessagePinned &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMessageUnpinned &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventPollStopped &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMemberJoined &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMemberJoinedByInviteLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMemberJoinedByRequest &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMemberInvited &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMemberLeft &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMemberPromoted &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMemberRestricted &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventAvailableReactionsChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventDescriptionChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventLinkedChatChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventLocationChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventMessageAutoDeleteTimeChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventPermissionsChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventPhotoChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventSlowModeDelayChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventStickerSetChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventTitleChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventUsernameChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventActiveUsernamesChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventHasProtectedContentToggled &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventInvitesToggled &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventIsAllHistoryAvailableToggled &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventHasAggressiveAntiSpamEnabledToggled &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventSignMessagesToggled &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventInviteLinkEdited &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventInviteLinkRevoked &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventInviteLinkDeleted &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventVideoChatCreated &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventVideoChatEnded &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventVideoChatMuteNewParticipantsToggled &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventVideoChatParticipantIsMutedToggled &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventVideoChatParticipantVolumeLevelChanged &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventIsForumToggled &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventForumTopicCreated &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventForumTopicEdited &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventForumTopicToggleIsClosed &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventForumTopicToggleIsHidden &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventForumTopicDeleted &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEventForumTopicPinned &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatEvents &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatFolder &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatFolderIcon &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatFolderInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatFolderInviteLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatFolderInviteLinkInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatFolderInviteLinks &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatInviteLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatInviteLinkCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatInviteLinkCounts &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatInviteLinkInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatInviteLinkMember &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatInviteLinkMembers &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatInviteLinks &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatJoinRequest &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatJoinRequests &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatJoinRequestsInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::ChatList &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatListMain &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatListArchive &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatListFolder &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatLists &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatLocation &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatMember &object);
+
+void to_json(JsonValueScope &jv, const td_api::ChatMemberStatus &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatMemberStatusCreator &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatMemberStatusAdministrator &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatMemberStatusMember &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatMemberStatusRestricted &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatMemberStatusLeft &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatMemberStatusBanned &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatMembers &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatMessageSender &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatMessageSenders &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatNearby &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatNotificationSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatPermissions &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatPhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatPhotoInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatPhotoSticker &object);
+
+void to_json(JsonValueScope &jv, const td_api::ChatPhotoStickerType &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatPhotoStickerTypeRegularOrMask &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatPhotoStickerTypeCustomEmoji &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatPhotos &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatPosition &object);
+
+void to_json(JsonValueScope &jv, const td_api::ChatSource &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatSourceMtprotoProxy &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatSourcePublicServiceAnnouncement &object);
+
+void to_json(JsonValueScope &jv, const td_api::ChatStatistics &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatStatisticsSupergroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatStatisticsChannel &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatStatisticsAdministratorActionsInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatStatisticsInviterInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatStatisticsMessageInteractionInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatStatisticsMessageSenderInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatTheme &object);
+
+void to_json(JsonValueScope &jv, const td_api::ChatType &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatTypePrivate &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatTypeBasicGroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatTypeSupergroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatTypeSecret &object);
+
+void to_json(JsonValueScope &jv, const td_api::chats &object);
+
+void to_json(JsonValueScope &jv, const td_api::chatsNearby &object);
+
+void to_json(JsonValueScope &jv, const td_api::CheckChatUsernameResult &object);
+
+void to_json(JsonValueScope &jv, const td_api::checkChatUsernameResultOk &object);
+
+void to_json(JsonValueScope &jv, const td_api::checkChatUsernameResultUsernameInvalid &object);
+
+void to_json(JsonValueScope &jv, const td_api::checkChatUsernameResultUsernameOccupied &object);
+
+void to_json(JsonValueScope &jv, const td_api::checkChatUsernameResultUsernamePurchasable &object);
+
+void to_json(JsonValueScope &jv, const td_api::checkChatUsernameResultPublicChatsTooMany &object);
+
+void to_json(JsonValueScope &jv, const td_api::checkChatUsernameResultPublicGroupsUnavailable &object);
+
+void to_json(JsonValueScope &jv, const td_api::CheckStickerSetNameResult &object);
+
+void to_json(JsonValueScope &jv, const td_api::checkStickerSetNameResultOk &object);
+
+void to_json(JsonValueScope &jv, const td_api::checkStickerSetNameResultNameInvalid &object);
+
+void to_json(JsonValueScope &jv, const td_api::checkStickerSetNameResultNameOccupied &object);
+
+void to_json(JsonValueScope &jv, const td_api::closedVectorPath &object);
+
+void to_json(JsonValueScope &jv, const td_api::connectedWebsite &object);
+
+void to_json(JsonValueScope &jv, const td_api::connectedWebsites &object);
+
+void to_json(JsonValueScope &jv, const td_api::ConnectionState &object);
+
+void to_json(JsonValueScope &jv, const td_api::connectionStateWaitingForNetwork &object);
+
+void to_json(JsonValueScope &jv, const td_api::connectionStateConnectingToProxy &object);
+
+void to_json(JsonValueScope &jv, const td_api::connectionStateConnecting &object);
+
+void to_json(JsonValueScope &jv, const td_api::connectionStateUpdating &object);
+
+void to_json(JsonValueScope &jv, const td_api::connectionStateReady &object);
+
+void to_json(JsonValueScope &jv, const td_api::contact &object);
+
+void to_json(JsonValueScope &jv, const td_api::count &object);
+
+void to_json(JsonValueScope &jv, const td_api::countries &object);
+
+void to_json(JsonValueScope &jv, const td_api::countryInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::customRequestResult &object);
+
+void to_json(JsonValueScope &jv, const td_api::databaseStatistics &object);
+
+void to_json(JsonValueScope &jv, const td_api::date &object);
+
+void to_json(JsonValueScope &jv, const td_api::dateRange &object);
+
+void to_json(JsonValueScope &jv, const td_api::datedFile &object);
+
+void to_json(JsonValueScope &jv, const td_api::deepLinkInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::DiceStickers &object);
+
+void to_json(JsonValueScope &jv, const td_api::diceStickersRegular &object);
+
+void to_json(JsonValueScope &jv, const td_api::diceStickersSlotMachine &object);
+
+void to_json(JsonValueScope &jv, const td_api::document &object);
+
+void to_json(JsonValueScope &jv, const td_api::downloadedFileCounts &object);
+
+void to_json(JsonValueScope &jv, const td_api::draftMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::emailAddressAuthenticationCodeInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::EmailAddressResetState &object);
+
+void to_json(JsonValueScope &jv, const td_api::emailAddressResetStateAvailable &object);
+
+void to_json(JsonValueScope &jv, const td_api::emailAddressResetStatePending &object);
+
+void to_json(JsonValueScope &jv, const td_api::emojiCategories &object);
+
+void to_json(JsonValueScope &jv, const td_api::emojiCategory &object);
+
+void to_json(JsonValueScope &jv, const td_api::emojiReaction &object);
+
+void to_json(JsonValueScope &jv, const td_api::emojiStatus &object);
+
+void to_json(JsonValueScope &jv, const td_api::emojiStatuses &object);
+
+void to_json(JsonValueScope &jv, const td_api::emojis &object);
+
+void to_json(JsonValueScope &jv, const td_api::encryptedCredentials &object);
+
+void to_json(JsonValueScope &jv, const td_api::encryptedPassportElement &object);
+
+void to_json(JsonValueScope &jv, const td_api::error &object);
+
+void to_json(JsonValueScope &jv, const td_api::file &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileDownload &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileDownloadedPrefixSize &object);
+
+void to_json(JsonValueScope &jv, const td_api::filePart &object);
+
+void to_json(JsonValueScope &jv, const td_api::FileType &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeNone &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeAnimation &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeAudio &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeDocument &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeNotificationSound &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypePhotoStory &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeProfilePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeSecret &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeSecretThumbnail &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeSecure &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeSticker &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeThumbnail &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeUnknown &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeVideoNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeVideoStory &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeVoiceNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::fileTypeWallpaper &object);
+
+void to_json(JsonValueScope &jv, const td_api::formattedText &object);
+
+void to_json(JsonValueScope &jv, const td_api::forumTopic &object);
+
+void to_json(JsonValueScope &jv, const td_api::forumTopicIcon &object);
+
+void to_json(JsonValueScope &jv, const td_api::forumTopicInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::forumTopics &object);
+
+void to_json(JsonValueScope &jv, const td_api::foundChatMessages &object);
+
+void to_json(JsonValueScope &jv, const td_api::foundFileDownloads &object);
+
+void to_json(JsonValueScope &jv, const td_api::foundMessages &object);
+
+void to_json(JsonValueScope &jv, const td_api::foundWebApp &object);
+
+void to_json(JsonValueScope &jv, const td_api::game &object);
+
+void to_json(JsonValueScope &jv, const td_api::gameHighScore &object);
+
+void to_json(JsonValueScope &jv, const td_api::gameHighScores &object);
+
+void to_json(JsonValueScope &jv, const td_api::groupCall &object);
+
+void to_json(JsonValueScope &jv, const td_api::groupCallId &object);
+
+void to_json(JsonValueScope &jv, const td_api::groupCallParticipant &object);
+
+void to_json(JsonValueScope &jv, const td_api::groupCallParticipantVideoInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::groupCallRecentSpeaker &object);
+
+void to_json(JsonValueScope &jv, const td_api::groupCallStream &object);
+
+void to_json(JsonValueScope &jv, const td_api::groupCallStreams &object);
+
+void to_json(JsonValueScope &jv, const td_api::groupCallVideoSourceGroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::hashtags &object);
+
+void to_json(JsonValueScope &jv, const td_api::httpUrl &object);
+
+void to_json(JsonValueScope &jv, const td_api::identityDocument &object);
+
+void to_json(JsonValueScope &jv, const td_api::importedContacts &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineKeyboardButton &object);
+
+void to_json(JsonValueScope &jv, const td_api::InlineKeyboardButtonType &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineKeyboardButtonTypeUrl &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineKeyboardButtonTypeLoginUrl &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineKeyboardButtonTypeWebApp &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineKeyboardButtonTypeCallback &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineKeyboardButtonTypeCallbackWithPassword &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineKeyboardButtonTypeCallbackGame &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineKeyboardButtonTypeSwitchInline &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineKeyboardButtonTypeBuy &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineKeyboardButtonTypeUser &object);
+
+void to_json(JsonValueScope &jv, const td_api::InlineQueryResult &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultArticle &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultContact &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultLocation &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultVenue &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultGame &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultAnimation &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultAudio &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultDocument &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultPhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultSticker &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultVoiceNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResults &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultsButton &object);
+
+void to_json(JsonValueScope &jv, const td_api::InlineQueryResultsButtonType &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultsButtonTypeStartBot &object);
+
+void to_json(JsonValueScope &jv, const td_api::inlineQueryResultsButtonTypeWebApp &object);
+
+void to_json(JsonValueScope &jv, const td_api::InputFile &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputFileId &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputFileRemote &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputFileLocal &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputFileGenerated &object);
+
+void to_json(JsonValueScope &jv, const td_api::InputMessageContent &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageText &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageAnimation &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageAudio &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageDocument &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessagePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageSticker &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageVideoNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageVoiceNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageLocation &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageVenue &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageContact &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageDice &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageGame &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageInvoice &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessagePoll &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageStory &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputMessageForwarded &object);
+
+void to_json(JsonValueScope &jv, const td_api::inputThumbnail &object);
+
+void to_json(JsonValueScope &jv, const td_api::InternalLinkType &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeActiveSessions &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeAttachmentMenuBot &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeAuthenticationCode &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeBackground &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeBotAddToChannel &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeBotStart &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeBotStartInGroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeChangePhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeChatFolderInvite &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeChatFolderSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeChatInvite &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeDefaultMessageAutoDeleteTimerSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeEditProfileSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeGame &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeInstantView &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeInvoice &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeLanguagePack &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeLanguageSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeMessageDraft &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypePassportDataRequest &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypePhoneNumberConfirmation &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypePremiumFeatures &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypePrivacyAndSecuritySettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeProxy &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypePublicChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeQrCodeAuthentication &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeRestorePurchases &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeStickerSet &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeStory &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeTheme &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeThemeSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeUnknownDeepLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeUnsupportedProxy &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeUserPhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeUserToken &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeVideoChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::internalLinkTypeWebApp &object);
+
+void to_json(JsonValueScope &jv, const td_api::invoice &object);
+
+void to_json(JsonValueScope &jv, const td_api::jsonObjectMember &object);
+
+void to_json(JsonValueScope &jv, const td_api::JsonValue &object);
+
+void to_json(JsonValueScope &jv, const td_api::jsonValueNull &object);
+
+void to_json(JsonValueScope &jv, const td_api::jsonValueBoolean &object);
+
+void to_json(JsonValueScope &jv, const td_api::jsonValueNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::jsonValueString &object);
+
+void to_json(JsonValueScope &jv, const td_api::jsonValueArray &object);
+
+void to_json(JsonValueScope &jv, const td_api::jsonValueObject &object);
+
+void to_json(JsonValueScope &jv, const td_api::keyboardButton &object);
+
+void to_json(JsonValueScope &jv, const td_api::KeyboardButtonType &object);
+
+void to_json(JsonValueScope &jv, const td_api::keyboardButtonTypeText &object);
+
+void to_json(JsonValueScope &jv, const td_api::keyboardButtonTypeRequestPhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::keyboardButtonTypeRequestLocation &object);
+
+void to_json(JsonValueScope &jv, const td_api::keyboardButtonTypeRequestPoll &object);
+
+void to_json(JsonValueScope &jv, const td_api::keyboardButtonTypeRequestUser &object);
+
+void to_json(JsonValueScope &jv, const td_api::keyboardButtonTypeRequestChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::keyboardButtonTypeWebApp &object);
+
+void to_json(JsonValueScope &jv, const td_api::labeledPricePart &object);
+
+void to_json(JsonValueScope &jv, const td_api::languagePackInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::languagePackString &object);
+
+void to_json(JsonValueScope &jv, const td_api::LanguagePackStringValue &object);
+
+void to_json(JsonValueScope &jv, const td_api::languagePackStringValueOrdinary &object);
+
+void to_json(JsonValueScope &jv, const td_api::languagePackStringValuePluralized &object);
+
+void to_json(JsonValueScope &jv, const td_api::languagePackStringValueDeleted &object);
+
+void to_json(JsonValueScope &jv, const td_api::languagePackStrings &object);
+
+void to_json(JsonValueScope &jv, const td_api::localFile &object);
+
+void to_json(JsonValueScope &jv, const td_api::localizationTargetInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::location &object);
+
+void to_json(JsonValueScope &jv, const td_api::LogStream &object);
+
+void to_json(JsonValueScope &jv, const td_api::logStreamDefault &object);
+
+void to_json(JsonValueScope &jv, const td_api::logStreamFile &object);
+
+void to_json(JsonValueScope &jv, const td_api::logStreamEmpty &object);
+
+void to_json(JsonValueScope &jv, const td_api::logTags &object);
+
+void to_json(JsonValueScope &jv, const td_api::logVerbosityLevel &object);
+
+void to_json(JsonValueScope &jv, const td_api::LoginUrlInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::loginUrlInfoOpen &object);
+
+void to_json(JsonValueScope &jv, const td_api::loginUrlInfoRequestConfirmation &object);
+
+void to_json(JsonValueScope &jv, const td_api::MaskPoint &object);
+
+void to_json(JsonValueScope &jv, const td_api::maskPointForehead &object);
+
+void to_json(JsonValueScope &jv, const td_api::maskPointEyes &object);
+
+void to_json(JsonValueScope &jv, const td_api::maskPointMouth &object);
+
+void to_json(JsonValueScope &jv, const td_api::maskPointChin &object);
+
+void to_json(JsonValueScope &jv, const td_api::maskPosition &object);
+
+void to_json(JsonValueScope &jv, const td_api::message &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageAutoDeleteTime &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageCalendar &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageCalendarDay &object);
+
+void to_json(JsonValueScope &jv, const td_api::MessageContent &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageText &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageAnimation &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageAudio &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageDocument &object);
+
+void to_json(JsonValueScope &jv, const td_api::messagePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageExpiredPhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSticker &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageExpiredVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageVideoNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageVoiceNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageLocation &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageVenue &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageContact &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageAnimatedEmoji &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageDice &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageGame &object);
+
+void to_json(JsonValueScope &jv, const td_api::messagePoll &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageStory &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageInvoice &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageCall &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageVideoChatScheduled &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageVideoChatStarted &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageVideoChatEnded &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageInviteVideoChatParticipants &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageBasicGroupChatCreate &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSupergroupChatCreate &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatChangeTitle &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatChangePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatDeletePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatAddMembers &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatJoinByLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatJoinByRequest &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatDeleteMember &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatUpgradeTo &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatUpgradeFrom &object);
+
+void to_json(JsonValueScope &jv, const td_api::messagePinMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageScreenshotTaken &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatSetBackground &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatSetTheme &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatSetMessageAutoDeleteTime &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageForumTopicCreated &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageForumTopicEdited &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageForumTopicIsClosedToggled &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageForumTopicIsHiddenToggled &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSuggestProfilePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageCustomServiceAction &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageGameScore &object);
+
+void to_json(JsonValueScope &jv, const td_api::messagePaymentSuccessful &object);
+
+void to_json(JsonValueScope &jv, const td_api::messagePaymentSuccessfulBot &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageGiftedPremium &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageContactRegistered &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageUserShared &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageChatShared &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageWebsiteConnected &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageBotWriteAccessAllowed &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageWebAppDataSent &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageWebAppDataReceived &object);
+
+void to_json(JsonValueScope &jv, const td_api::messagePassportDataSent &object);
+
+void to_json(JsonValueScope &jv, const td_api::messagePassportDataReceived &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageProximityAlertTriggered &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageUnsupported &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageCopyOptions &object);
+
+void to_json(JsonValueScope &jv, const td_api::MessageExtendedMedia &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageExtendedMediaPreview &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageExtendedMediaPhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageExtendedMediaVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageExtendedMediaUnsupported &object);
+
+void to_json(JsonValueScope &jv, const td_api::MessageFileType &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageFileTypePrivate &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageFileTypeGroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageFileTypeUnknown &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageForwardInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::MessageForwardOrigin &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageForwardOriginUser &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageForwardOriginChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageForwardOriginHiddenUser &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageForwardOriginChannel &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageForwardOriginMessageImport &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageInteractionInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageLinkInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::messagePosition &object);
+
+void to_json(JsonValueScope &jv, const td_api::messagePositions &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageReaction &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageReplyInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::MessageReplyTo &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageReplyToMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageReplyToStory &object);
+
+void to_json(JsonValueScope &jv, const td_api::MessageSchedulingState &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSchedulingStateSendAtDate &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSchedulingStateSendWhenOnline &object);
+
+void to_json(JsonValueScope &jv, const td_api::MessageSender &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSenderUser &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSenderChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSenders &object);
+
+void to_json(JsonValueScope &jv, const td_api::MessageSendingState &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSendingStatePending &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSendingStateFailed &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSponsor &object);
+
+void to_json(JsonValueScope &jv, const td_api::MessageSponsorType &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSponsorTypeBot &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSponsorTypePublicChannel &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSponsorTypePrivateChannel &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageSponsorTypeWebsite &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageStatistics &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageThreadInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageViewer &object);
+
+void to_json(JsonValueScope &jv, const td_api::messageViewers &object);
+
+void to_json(JsonValueScope &jv, const td_api::messages &object);
+
+void to_json(JsonValueScope &jv, const td_api::minithumbnail &object);
+
+void to_json(JsonValueScope &jv, const td_api::networkStatistics &object);
+
+void to_json(JsonValueScope &jv, const td_api::NetworkStatisticsEntry &object);
+
+void to_json(JsonValueScope &jv, const td_api::networkStatisticsEntryFile &object);
+
+void to_json(JsonValueScope &jv, const td_api::networkStatisticsEntryCall &object);
+
+void to_json(JsonValueScope &jv, const td_api::NetworkType &object);
+
+void to_json(JsonValueScope &jv, const td_api::networkTypeNone &object);
+
+void to_json(JsonValueScope &jv, const td_api::networkTypeMobile &object);
+
+void to_json(JsonValueScope &jv, const td_api::networkTypeMobileRoaming &object);
+
+void to_json(JsonValueScope &jv, const td_api::networkTypeWiFi &object);
+
+void to_json(JsonValueScope &jv, const td_api::networkTypeOther &object);
+
+void to_json(JsonValueScope &jv, const td_api::notification &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationGroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::NotificationGroupType &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationGroupTypeMessages &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationGroupTypeMentions &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationGroupTypeSecretChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationGroupTypeCalls &object);
+
+void to_json(JsonValueScope &jv, const td_api::NotificationSettingsScope &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationSettingsScopePrivateChats &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationSettingsScopeGroupChats &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationSettingsScopeChannelChats &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationSound &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationSounds &object);
+
+void to_json(JsonValueScope &jv, const td_api::NotificationType &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationTypeNewMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationTypeNewSecretChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationTypeNewCall &object);
+
+void to_json(JsonValueScope &jv, const td_api::notificationTypeNewPushMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::ok &object);
+
+void to_json(JsonValueScope &jv, const td_api::OptionValue &object);
+
+void to_json(JsonValueScope &jv, const td_api::optionValueBoolean &object);
+
+void to_json(JsonValueScope &jv, const td_api::optionValueEmpty &object);
+
+void to_json(JsonValueScope &jv, const td_api::optionValueInteger &object);
+
+void to_json(JsonValueScope &jv, const td_api::optionValueString &object);
+
+void to_json(JsonValueScope &jv, const td_api::orderInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::PageBlock &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockTitle &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockSubtitle &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockAuthorDate &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockHeader &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockSubheader &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockKicker &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockParagraph &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockPreformatted &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockFooter &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockDivider &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockAnchor &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockList &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockBlockQuote &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockPullQuote &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockAnimation &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockAudio &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockPhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockVoiceNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockCover &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockEmbedded &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockEmbeddedPost &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockCollage &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockSlideshow &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockChatLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockTable &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockDetails &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockRelatedArticles &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockMap &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockCaption &object);
+
+void to_json(JsonValueScope &jv, const td_api::PageBlockHorizontalAlignment &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockHorizontalAlignmentLeft &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockHorizontalAlignmentCenter &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockHorizontalAlignmentRight &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockListItem &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockRelatedArticle &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockTableCell &object);
+
+void to_json(JsonValueScope &jv, const td_api::PageBlockVerticalAlignment &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockVerticalAlignmentTop &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockVerticalAlignmentMiddle &object);
+
+void to_json(JsonValueScope &jv, const td_api::pageBlockVerticalAlignmentBottom &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportAuthorizationForm &object);
+
+void to_json(JsonValueScope &jv, const td_api::PassportElement &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementPersonalDetails &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementPassport &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementDriverLicense &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementIdentityCard &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementInternalPassport &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementAddress &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementUtilityBill &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementBankStatement &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementRentalAgreement &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementPassportRegistration &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTemporaryRegistration &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementPhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementEmailAddress &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementError &object);
+
+void to_json(JsonValueScope &jv, const td_api::PassportElementErrorSource &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementErrorSourceUnspecified &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementErrorSourceDataField &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementErrorSourceFrontSide &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementErrorSourceReverseSide &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementErrorSourceSelfie &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementErrorSourceTranslationFile &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementErrorSourceTranslationFiles &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementErrorSourceFile &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementErrorSourceFiles &object);
+
+void to_json(JsonValueScope &jv, const td_api::PassportElementType &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypePersonalDetails &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypePassport &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypeDriverLicense &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypeIdentityCard &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypeInternalPassport &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypeAddress &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypeUtilityBill &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypeBankStatement &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypeRentalAgreement &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypePassportRegistration &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypeTemporaryRegistration &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypePhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementTypeEmailAddress &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElements &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportElementsWithErrors &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportRequiredElement &object);
+
+void to_json(JsonValueScope &jv, const td_api::passportSuitableElement &object);
+
+void to_json(JsonValueScope &jv, const td_api::passwordState &object);
+
+void to_json(JsonValueScope &jv, const td_api::paymentForm &object);
+
+void to_json(JsonValueScope &jv, const td_api::paymentOption &object);
+
+void to_json(JsonValueScope &jv, const td_api::PaymentProvider &object);
+
+void to_json(JsonValueScope &jv, const td_api::paymentProviderSmartGlocal &object);
+
+void to_json(JsonValueScope &jv, const td_api::paymentProviderStripe &object);
+
+void to_json(JsonValueScope &jv, const td_api::paymentProviderOther &object);
+
+void to_json(JsonValueScope &jv, const td_api::paymentReceipt &object);
+
+void to_json(JsonValueScope &jv, const td_api::paymentResult &object);
+
+void to_json(JsonValueScope &jv, const td_api::personalDetails &object);
+
+void to_json(JsonValueScope &jv, const td_api::personalDocument &object);
+
+void to_json(JsonValueScope &jv, const td_api::phoneNumberInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::photo &object);
+
+void to_json(JsonValueScope &jv, const td_api::photoSize &object);
+
+void to_json(JsonValueScope &jv, const td_api::point &object);
+
+void to_json(JsonValueScope &jv, const td_api::poll &object);
+
+void to_json(JsonValueScope &jv, const td_api::pollOption &object);
+
+void to_json(JsonValueScope &jv, const td_api::PollType &object);
+
+void to_json(JsonValueScope &jv, const td_api::pollTypeRegular &object);
+
+void to_json(JsonValueScope &jv, const td_api::pollTypeQuiz &object);
+
+void to_json(JsonValueScope &jv, const td_api::PremiumFeature &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureIncreasedLimits &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureIncreasedUploadFileSize &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureImprovedDownloadSpeed &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureVoiceRecognition &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureDisabledAds &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureUniqueReactions &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureUniqueStickers &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureCustomEmoji &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureAdvancedChatManagement &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureProfileBadge &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureEmojiStatus &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureAnimatedProfilePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureForumTopicIcon &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureAppIcons &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatureRealTimeChatTranslation &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeaturePromotionAnimation &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumFeatures &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimit &object);
+
+void to_json(JsonValueScope &jv, const td_api::PremiumLimitType &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeSupergroupCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypePinnedChatCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeCreatedPublicChatCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeSavedAnimationCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeFavoriteStickerCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeChatFolderCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeChatFolderChosenChatCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypePinnedArchivedChatCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeCaptionLength &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeBioLength &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeChatFolderInviteLinkCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeShareableChatFolderCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumLimitTypeActiveStoryCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumPaymentOption &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumState &object);
+
+void to_json(JsonValueScope &jv, const td_api::premiumStatePaymentOption &object);
+
+void to_json(JsonValueScope &jv, const td_api::profilePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::proxies &object);
+
+void to_json(JsonValueScope &jv, const td_api::proxy &object);
+
+void to_json(JsonValueScope &jv, const td_api::ProxyType &object);
+
+void to_json(JsonValueScope &jv, const td_api::proxyTypeSocks5 &object);
+
+void to_json(JsonValueScope &jv, const td_api::proxyTypeHttp &object);
+
+void to_json(JsonValueScope &jv, const td_api::proxyTypeMtproto &object);
+
+void to_json(JsonValueScope &jv, const td_api::PushMessageContent &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentHidden &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentAnimation &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentAudio &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentContact &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentContactRegistered &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentDocument &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentGame &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentGameScore &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentInvoice &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentLocation &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentPhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentPoll &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentScreenshotTaken &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentSticker &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentStory &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentText &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentVideoNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentVoiceNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentBasicGroupChatCreate &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentChatAddMembers &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentChatChangePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentChatChangeTitle &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentChatSetBackground &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentChatSetTheme &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentChatDeleteMember &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentChatJoinByLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentChatJoinByRequest &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentRecurringPayment &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentSuggestProfilePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentMessageForwards &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushMessageContentMediaAlbum &object);
+
+void to_json(JsonValueScope &jv, const td_api::pushReceiverId &object);
+
+void to_json(JsonValueScope &jv, const td_api::ReactionType &object);
+
+void to_json(JsonValueScope &jv, const td_api::reactionTypeEmoji &object);
+
+void to_json(JsonValueScope &jv, const td_api::reactionTypeCustomEmoji &object);
+
+void to_json(JsonValueScope &jv, const td_api::recommendedChatFolder &object);
+
+void to_json(JsonValueScope &jv, const td_api::recommendedChatFolders &object);
+
+void to_json(JsonValueScope &jv, const td_api::recoveryEmailAddress &object);
+
+void to_json(JsonValueScope &jv, const td_api::remoteFile &object);
+
+void to_json(JsonValueScope &jv, const td_api::ReplyMarkup &object);
+
+void to_json(JsonValueScope &jv, const td_api::replyMarkupRemoveKeyboard &object);
+
+void to_json(JsonValueScope &jv, const td_api::replyMarkupForceReply &object);
+
+void to_json(JsonValueScope &jv, const td_api::replyMarkupShowKeyboard &object);
+
+void to_json(JsonValueScope &jv, const td_api::replyMarkupInlineKeyboard &object);
+
+void to_json(JsonValueScope &jv, const td_api::ResetPasswordResult &object);
+
+void to_json(JsonValueScope &jv, const td_api::resetPasswordResultOk &object);
+
+void to_json(JsonValueScope &jv, const td_api::resetPasswordResultPending &object);
+
+void to_json(JsonValueScope &jv, const td_api::resetPasswordResultDeclined &object);
+
+void to_json(JsonValueScope &jv, const td_api::RichText &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextPlain &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextBold &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextItalic &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextUnderline &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextStrikethrough &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextFixed &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextUrl &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextEmailAddress &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextSubscript &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextSuperscript &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextMarked &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextPhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextIcon &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextReference &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextAnchor &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTextAnchorLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::richTexts &object);
+
+void to_json(JsonValueScope &jv, const td_api::rtmpUrl &object);
+
+void to_json(JsonValueScope &jv, const td_api::savedCredentials &object);
+
+void to_json(JsonValueScope &jv, const td_api::scopeAutosaveSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::scopeNotificationSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::seconds &object);
+
+void to_json(JsonValueScope &jv, const td_api::secretChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::SecretChatState &object);
+
+void to_json(JsonValueScope &jv, const td_api::secretChatStatePending &object);
+
+void to_json(JsonValueScope &jv, const td_api::secretChatStateReady &object);
+
+void to_json(JsonValueScope &jv, const td_api::secretChatStateClosed &object);
+
+void to_json(JsonValueScope &jv, const td_api::sentWebAppMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::session &object);
+
+void to_json(JsonValueScope &jv, const td_api::SessionType &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeAndroid &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeApple &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeBrave &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeChrome &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeEdge &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeFirefox &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeIpad &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeIphone &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeLinux &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeMac &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeOpera &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeSafari &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeUbuntu &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeUnknown &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeVivaldi &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeWindows &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessionTypeXbox &object);
+
+void to_json(JsonValueScope &jv, const td_api::sessions &object);
+
+void to_json(JsonValueScope &jv, const td_api::shippingOption &object);
+
+void to_json(JsonValueScope &jv, const td_api::SpeechRecognitionResult &object);
+
+void to_json(JsonValueScope &jv, const td_api::speechRecognitionResultPending &object);
+
+void to_json(JsonValueScope &jv, const td_api::speechRecognitionResultText &object);
+
+void to_json(JsonValueScope &jv, const td_api::speechRecognitionResultError &object);
+
+void to_json(JsonValueScope &jv, const td_api::sponsoredMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::sponsoredMessages &object);
+
+void to_json(JsonValueScope &jv, const td_api::StatisticalGraph &object);
+
+void to_json(JsonValueScope &jv, const td_api::statisticalGraphData &object);
+
+void to_json(JsonValueScope &jv, const td_api::statisticalGraphAsync &object);
+
+void to_json(JsonValueScope &jv, const td_api::statisticalGraphError &object);
+
+void to_json(JsonValueScope &jv, const td_api::statisticalValue &object);
+
+void to_json(JsonValueScope &jv, const td_api::sticker &object);
+
+void to_json(JsonValueScope &jv, const td_api::StickerFormat &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerFormatWebp &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerFormatTgs &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerFormatWebm &object);
+
+void to_json(JsonValueScope &jv, const td_api::StickerFullType &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerFullTypeRegular &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerFullTypeMask &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerFullTypeCustomEmoji &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerSet &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerSetInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerSets &object);
+
+void to_json(JsonValueScope &jv, const td_api::StickerType &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerTypeRegular &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerTypeMask &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickerTypeCustomEmoji &object);
+
+void to_json(JsonValueScope &jv, const td_api::stickers &object);
+
+void to_json(JsonValueScope &jv, const td_api::storageStatistics &object);
+
+void to_json(JsonValueScope &jv, const td_api::storageStatisticsByChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::storageStatisticsByFileType &object);
+
+void to_json(JsonValueScope &jv, const td_api::storageStatisticsFast &object);
+
+void to_json(JsonValueScope &jv, const td_api::stories &object);
+
+void to_json(JsonValueScope &jv, const td_api::story &object);
+
+void to_json(JsonValueScope &jv, const td_api::StoryContent &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyContentPhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyContentVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyContentUnsupported &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyInteractionInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::StoryList &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyListMain &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyListArchive &object);
+
+void to_json(JsonValueScope &jv, const td_api::StoryPrivacySettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyPrivacySettingsEveryone &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyPrivacySettingsContacts &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyPrivacySettingsCloseFriends &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyPrivacySettingsSelectedContacts &object);
+
+void to_json(JsonValueScope &jv, const td_api::storyVideo &object);
+
+void to_json(JsonValueScope &jv, const td_api::SuggestedAction &object);
+
+void to_json(JsonValueScope &jv, const td_api::suggestedActionEnableArchiveAndMuteNewChats &object);
+
+void to_json(JsonValueScope &jv, const td_api::suggestedActionCheckPassword &object);
+
+void to_json(JsonValueScope &jv, const td_api::suggestedActionCheckPhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::suggestedActionViewChecksHint &object);
+
+void to_json(JsonValueScope &jv, const td_api::suggestedActionConvertToBroadcastGroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::suggestedActionSetPassword &object);
+
+void to_json(JsonValueScope &jv, const td_api::suggestedActionUpgradePremium &object);
+
+void to_json(JsonValueScope &jv, const td_api::suggestedActionRestorePremium &object);
+
+void to_json(JsonValueScope &jv, const td_api::suggestedActionSubscribeToAnnualPremium &object);
+
+void to_json(JsonValueScope &jv, const td_api::supergroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::supergroupFullInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::tMeUrl &object);
+
+void to_json(JsonValueScope &jv, const td_api::TMeUrlType &object);
+
+void to_json(JsonValueScope &jv, const td_api::tMeUrlTypeUser &object);
+
+void to_json(JsonValueScope &jv, const td_api::tMeUrlTypeSupergroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::tMeUrlTypeChatInvite &object);
+
+void to_json(JsonValueScope &jv, const td_api::tMeUrlTypeStickerSet &object);
+
+void to_json(JsonValueScope &jv, const td_api::tMeUrls &object);
+
+void to_json(JsonValueScope &jv, const td_api::TargetChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::targetChatCurrent &object);
+
+void to_json(JsonValueScope &jv, const td_api::targetChatChosen &object);
+
+void to_json(JsonValueScope &jv, const td_api::targetChatInternalLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::temporaryPasswordState &object);
+
+void to_json(JsonValueScope &jv, const td_api::termsOfService &object);
+
+void to_json(JsonValueScope &jv, const td_api::testBytes &object);
+
+void to_json(JsonValueScope &jv, const td_api::testInt &object);
+
+void to_json(JsonValueScope &jv, const td_api::testString &object);
+
+void to_json(JsonValueScope &jv, const td_api::testVectorInt &object);
+
+void to_json(JsonValueScope &jv, const td_api::testVectorIntObject &object);
+
+void to_json(JsonValueScope &jv, const td_api::testVectorString &object);
+
+void to_json(JsonValueScope &jv, const td_api::testVectorStringObject &object);
+
+void to_json(JsonValueScope &jv, const td_api::text &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntities &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntity &object);
+
+void to_json(JsonValueScope &jv, const td_api::TextEntityType &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeMention &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeHashtag &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeCashtag &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeBotCommand &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeUrl &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeEmailAddress &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypePhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeBankCardNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeBold &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeItalic &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeUnderline &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeStrikethrough &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeSpoiler &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeCode &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypePre &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypePreCode &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeTextUrl &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeMentionName &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeCustomEmoji &object);
+
+void to_json(JsonValueScope &jv, const td_api::textEntityTypeMediaTimestamp &object);
+
+void to_json(JsonValueScope &jv, const td_api::themeSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::thumbnail &object);
+
+void to_json(JsonValueScope &jv, const td_api::ThumbnailFormat &object);
+
+void to_json(JsonValueScope &jv, const td_api::thumbnailFormatJpeg &object);
+
+void to_json(JsonValueScope &jv, const td_api::thumbnailFormatGif &object);
+
+void to_json(JsonValueScope &jv, const td_api::thumbnailFormatMpeg4 &object);
+
+void to_json(JsonValueScope &jv, const td_api::thumbnailFormatPng &object);
+
+void to_json(JsonValueScope &jv, const td_api::thumbnailFormatTgs &object);
+
+void to_json(JsonValueScope &jv, const td_api::thumbnailFormatWebm &object);
+
+void to_json(JsonValueScope &jv, const td_api::thumbnailFormatWebp &object);
+
+void to_json(JsonValueScope &jv, const td_api::trendingStickerSets &object);
+
+void to_json(JsonValueScope &jv, const td_api::unreadReaction &object);
+
+void to_json(JsonValueScope &jv, const td_api::Update &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateAuthorizationState &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageSendAcknowledged &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageSendSucceeded &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageSendFailed &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageContent &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageEdited &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageIsPinned &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageInteractionInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageContentOpened &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageMentionRead &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageUnreadReactions &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateMessageLiveLocationViewed &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatTitle &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatPhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatPermissions &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatLastMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatPosition &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatReadInbox &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatReadOutbox &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatActionBar &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatAvailableReactions &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatDraftMessage &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatMessageSender &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatMessageAutoDeleteTime &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatNotificationSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatPendingJoinRequests &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatReplyMarkup &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatBackground &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatTheme &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatUnreadMentionCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatUnreadReactionCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatVideoChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatDefaultDisableNotification &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatHasProtectedContent &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatIsTranslatable &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatIsMarkedAsUnread &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatIsBlocked &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatHasScheduledMessages &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatFolders &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatOnlineMemberCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateForumTopicInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateScopeNotificationSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNotification &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNotificationGroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateActiveNotifications &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateHavePendingNotifications &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateDeleteMessages &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatAction &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateUserStatus &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateUser &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateBasicGroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateSupergroup &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateSecretChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateUserFullInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateBasicGroupFullInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateSupergroupFullInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateServiceNotification &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateFile &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateFileGenerationStart &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateFileGenerationStop &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateFileDownloads &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateFileAddedToDownloads &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateFileDownload &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateFileRemovedFromDownloads &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateCall &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateGroupCall &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateGroupCallParticipant &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewCallSignalingData &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateUserPrivacySettingRules &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateUnreadMessageCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateUnreadChatCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateStory &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateStoryDeleted &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatActiveStories &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateStoryListChatCount &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateOption &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateStickerSet &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateInstalledStickerSets &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateTrendingStickerSets &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateRecentStickers &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateFavoriteStickers &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateSavedAnimations &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateSavedNotificationSounds &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateSelectedBackground &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatThemes &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateLanguagePackStrings &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateConnectionState &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateTermsOfService &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateUsersNearby &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateAttachmentMenuBots &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateWebAppMessageSent &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateActiveEmojiReactions &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateDefaultReactionType &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateDiceEmojis &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateAnimatedEmojiMessageClicked &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateAnimationSearchParameters &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateSuggestedActions &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateAddChatMembersPrivacyForbidden &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateAutosaveSettings &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewInlineQuery &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewChosenInlineResult &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewCallbackQuery &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewInlineCallbackQuery &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewShippingQuery &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewPreCheckoutQuery &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewCustomEvent &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewCustomQuery &object);
+
+void to_json(JsonValueScope &jv, const td_api::updatePoll &object);
+
+void to_json(JsonValueScope &jv, const td_api::updatePollAnswer &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateChatMember &object);
+
+void to_json(JsonValueScope &jv, const td_api::updateNewChatJoinRequest &object);
+
+void to_json(JsonValueScope &jv, const td_api::updates &object);
+
+void to_json(JsonValueScope &jv, const td_api::user &object);
+
+void to_json(JsonValueScope &jv, const td_api::userFullInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::userLink &object);
+
+void to_json(JsonValueScope &jv, const td_api::UserPrivacySetting &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingShowStatus &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingShowProfilePhoto &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingShowLinkInForwardedMessages &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingShowPhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingShowBio &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingAllowChatInvites &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingAllowCalls &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingAllowPeerToPeerCalls &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingAllowFindingByPhoneNumber &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingAllowPrivateVoiceAndVideoNoteMessages &object);
+
+void to_json(JsonValueScope &jv, const td_api::UserPrivacySettingRule &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingRuleAllowAll &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingRuleAllowContacts &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingRuleAllowUsers &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingRuleAllowChatMembers &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingRuleRestrictAll &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingRuleRestrictContacts &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingRuleRestrictUsers &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingRuleRestrictChatMembers &object);
+
+void to_json(JsonValueScope &jv, const td_api::userPrivacySettingRules &object);
+
+void to_json(JsonValueScope &jv, const td_api::UserStatus &object);
+
+void to_json(JsonValueScope &jv, const td_api::userStatusEmpty &object);
+
+void to_json(JsonValueScope &jv, const td_api::userStatusOnline &object);
+
+void to_json(JsonValueScope &jv, const td_api::userStatusOffline &object);
+
+void to_json(JsonValueScope &jv, const td_api::userStatusRecently &object);
+
+void to_json(JsonValueScope &jv, const td_api::userStatusLastWeek &object);
+
+void to_json(JsonValueScope &jv, const td_api::userStatusLastMonth &object);
+
+void to_json(JsonValueScope &jv, const td_api::userSupportInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::UserType &object);
+
+void to_json(JsonValueScope &jv, const td_api::userTypeRegular &object);
+
+void to_json(JsonValueScope &jv, const td_api::userTypeDeleted &object);
+
+void to_json(JsonValueScope &jv, const td_api::userTypeBot &object);
+
+void to_json(JsonValueScope &jv, const td_api::userTypeUnknown &object);
+
+void to_json(JsonValueScope &jv, const td_api::usernames &object);
+
+void to_json(JsonValueScope &jv, const td_api::users &object);
+
+void to_json(JsonValueScope &jv, const td_api::validatedOrderInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::VectorPathCommand &object);
+
+void to_json(JsonValueScope &jv, const td_api::vectorPathCommandLine &object);
+
+void to_json(JsonValueScope &jv, const td_api::vectorPathCommandCubicBezierCurve &object);
+
+void to_json(JsonValueScope &jv, const td_api::venue &object);
+
+void to_json(JsonValueScope &jv, const td_api::video &object);
+
+void to_json(JsonValueScope &jv, const td_api::videoChat &object);
+
+void to_json(JsonValueScope &jv, const td_api::videoNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::voiceNote &object);
+
+void to_json(JsonValueScope &jv, const td_api::webApp &object);
+
+void to_json(JsonValueScope &jv, const td_api::webAppInfo &object);
+
+void to_json(JsonValueScope &jv, const td_api::webPage &object);
+
+void to_json(JsonValueScope &jv, const td_api::webPageInstantView &object);
+
+}  // namespace td_api
+}  // namespace td
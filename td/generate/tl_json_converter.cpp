@@ -15,6 +15,7 @@
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/StringBuilder.h"
 
+#include <map>
 #include <utility>
 
 namespace td {
@@ -94,21 +95,94 @@ void gen_to_json(StringBuilder &sb, const tl::simple::Schema &schema, bool is_he
   }
 }
 
+// fields are matched by the length of their name first and then by the name itself
+template <class T>
+std::map<size_t, vector<const tl::simple::Arg *>> get_args_by_name_size(const T *constructor) {
+  std::map<size_t, vector<const tl::simple::Arg *>> result;
+  for (auto &arg : constructor->args) {
+    result[tl::simple::gen_cpp_name(arg.name).size()].push_back(&arg);
+  }
+  return result;
+}
+
+// a repeated field is ignored, so the first value wins as with get_json_object_field; already parsed fields are
+// tracked in a bit mask
+template <class T>
+string get_try_mark_field_parsed(const T *constructor, const tl::simple::Arg *arg) {
+  CHECK(constructor->args.size() <= 64);
+  return PSTRING() << "try_mark_json_field_parsed(parsed_fields, " << (arg - &constructor->args[0]) << ")";
+}
+
 template <class T>
 void gen_from_json_constructor(StringBuilder &sb, const T *constructor, bool is_header) {
   sb << "Status from_json(td_api::" << tl::simple::gen_cpp_name(constructor->name) << " &to, JsonObject &from)";
   if (is_header) {
     sb << ";\n\n";
-  } else {
-    sb << " {\n";
-    for (auto &arg : constructor->args) {
-      sb << "  TRY_STATUS(from_json" << (arg.type->type == tl::simple::Type::Bytes ? "_bytes" : "") << "(to."
-         << tl::simple::gen_cpp_field_name(arg.name) << ", get_json_object_field_force(from, \""
-         << tl::simple::gen_cpp_name(arg.name) << "\")));\n";
+    return;
+  }
+  sb << " {\n";
+  if (!constructor->args.empty()) {
+    sb << "  uint64 parsed_fields = 0;\n";
+    sb << "  for (auto &field_value : from) {\n";
+    sb << "    Slice field_name = field_value.first;\n";
+    sb << "    switch (field_name.size()) {\n";
+    for (auto &size_args : get_args_by_name_size(constructor)) {
+      sb << "      case " << size_args.first << ":\n";
+      sb << "        ";
+      for (auto *arg : size_args.second) {
+        if (arg != size_args.second[0]) {
+          sb << " else ";
+        }
+        sb << "if (field_name == \"" << tl::simple::gen_cpp_name(arg->name) << "\" && "
+           << get_try_mark_field_parsed(constructor, arg) << ") {\n";
+        sb << "          TRY_STATUS(from_json" << (arg->type->type == tl::simple::Type::Bytes ? "_bytes" : "") << "(to."
+           << tl::simple::gen_cpp_field_name(arg->name) << ", std::move(field_value.second)));\n";
+        sb << "        }";
+      }
+      sb << "\n";
+      sb << "        break;\n";
     }
-    sb << "  return Status::OK();\n";
-    sb << "}\n\n";
+    sb << "      default:\n";
+    sb << "        break;\n";
+    sb << "    }\n";
+    sb << "  }\n";
   }
+  sb << "  return Status::OK();\n";
+  sb << "}\n\n";
+}
+
+template <class T>
+void gen_from_json_field(StringBuilder &sb, const T *constructor, bool is_header) {
+  sb << "Result<bool> from_json_field(td_api::" << tl::simple::gen_cpp_name(constructor->name)
+     << " &to, Slice field_name, Parser &parser, int32 max_depth, uint64 &parsed_fields)";
+  if (is_header) {
+    sb << ";\n\n";
+    return;
+  }
+  sb << " {\n";
+  if (!constructor->args.empty()) {
+    sb << "  switch (field_name.size()) {\n";
+    for (auto &size_args : get_args_by_name_size(constructor)) {
+      sb << "    case " << size_args.first << ":\n";
+      sb << "      ";
+      for (auto *arg : size_args.second) {
+        sb << "if (field_name == \"" << tl::simple::gen_cpp_name(arg->name) << "\" && "
+           << get_try_mark_field_parsed(constructor, arg) << ") {\n";
+        sb << "        TRY_STATUS(td::from_json" << (arg->type->type == tl::simple::Type::Bytes ? "_bytes" : "")
+           << "(to." << tl::simple::gen_cpp_field_name(arg->name) << ", parser, max_depth));\n";
+        sb << "      } else ";
+      }
+      sb << "{\n";
+      sb << "        return false;\n";
+      sb << "      }\n";
+      sb << "      return true;\n";
+    }
+    sb << "    default:\n";
+    sb << "      break;\n";
+    sb << "  }\n";
+  }
+  sb << "  return false;\n";
+  sb << "}\n\n";
 }
 
 void gen_from_json(StringBuilder &sb, const tl::simple::Schema &schema, bool is_header, Mode mode) {
@@ -118,6 +192,7 @@ void gen_from_json(StringBuilder &sb, const tl::simple::Schema &schema, bool is_
     }
     for (auto *constructor : custom_type->constructors) {
       gen_from_json_constructor(sb, constructor, is_header);
+      gen_from_json_field(sb, constructor, is_header);
     }
   }
   if (mode == Mode::Client) {
@@ -125,12 +200,13 @@ void gen_from_json(StringBuilder &sb, const tl::simple::Schema &schema, bool is_
   }
   for (auto *function : schema.functions) {
     gen_from_json_constructor(sb, function, is_header);
+    gen_from_json_field(sb, function, is_header);
   }
 }
 
 using Vec = std::vector<std::pair<int32, std::string>>;
 void gen_tl_constructor_from_string(StringBuilder &sb, Slice name, const Vec &vec, bool is_header) {
-  sb << "Result<int32> tl_constructor_from_string(td_api::" << name << " *object, const std::string &str)";
+  sb << "Result<int32> tl_constructor_from_string(td_api::" << name << " *object, Slice str)";
   if (is_header) {
     sb << ";\n\n";
     return;
@@ -225,6 +301,7 @@ void gen_json_converter_file(const tl::simple::Schema &schema, const std::string
   if (is_header) {
     sb << "\nvoid to_json(JsonValueScope &jv, const tl_object_ptr<Object> &value);\n";
     sb << "\nStatus from_json(tl_object_ptr<Function> &to, td::JsonValue from);\n";
+    sb << "\nStatus from_json(tl_object_ptr<Function> &to, MutableSlice json, string &extra);\n";
     sb << "\nvoid to_json(JsonValueScope &jv, const Object &object);\n";
     sb << "\nvoid to_json(JsonValueScope &jv, const Function &object);\n\n";
   } else {
@@ -237,6 +314,31 @@ Status from_json(tl_object_ptr<Function> &to, td::JsonValue from) {
   return td::from_json(to, std::move(from));
 }
 
+Status from_json(tl_object_ptr<Function> &to, MutableSlice json, string &extra) {
+  if (!is_typed_json_object(json)) {
+    // the constructor isn't known before the fields are parsed, so the request is decoded through JsonValue
+    TRY_RESULT(value, json_decode(json));
+    if (value.type() != td::JsonValue::Type::Object) {
+      return Status::Error("Expected a JSON object");
+    }
+    if (has_json_object_field(value.get_object(), "@extra")) {
+      extra = json_encode<string>(
+          get_json_object_field(value.get_object(), "@extra", td::JsonValue::Type::Null).move_as_ok());
+    }
+    return td::from_json(to, std::move(value));
+  }
+
+  bool has_extra = false;
+  return td::from_json(to, json, [&](Slice field_name, Parser &parser, int32 max_depth) {
+    TRY_RESULT(value, do_json_decode(parser, max_depth));
+    if (!has_extra && field_name == "@extra") {
+      has_extra = true;
+      extra = json_encode<string>(value);
+    }
+    return Status::OK();
+  });
+}
+
 template <class T>
 auto lazy_to_json(JsonValueScope &jv, const T &t) -> decltype(td_api::to_json(jv, t)) {
   return td_api::to_json(jv, t);
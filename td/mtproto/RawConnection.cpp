@@ -164,36 +164,63 @@ class RawConnectionDefault final : public RawConnection {
     if (r.is_ok()) {
       on_read(r.ok(), callback);
     }
+    // read all available packets first to decrypt them at once
+    vector<BufferSlice> packets;
+    vector<uint32> quick_acks;
+    Status read_status;
     while (transport_->can_read()) {
       BufferSlice packet;
       uint32 quick_ack = 0;
-      TRY_RESULT(wait_size, transport_->read_next(&packet, &quick_ack));
+      auto r_wait_size = transport_->read_next(&packet, &quick_ack);
+      if (r_wait_size.is_error()) {
+        read_status = r_wait_size.move_as_error();
+        break;
+      }
+      auto wait_size = r_wait_size.ok();
       if (wait_size != 0) {
         constexpr size_t MAX_PACKET_SIZE = (1 << 22) + 1024;
         if (wait_size > MAX_PACKET_SIZE) {
-          return Status::Error(PSLICE() << "Expected packet size is too big: " << wait_size);
+          read_status = Status::Error(PSLICE() << "Expected packet size is too big: " << wait_size);
         }
         break;
       }
-      if (quick_ack != 0) {
-        TRY_STATUS(on_quick_ack(quick_ack, callback));
-        continue;
+      if (quick_ack == 0) {
+        auto old_pointer = packet.as_slice().ubegin();
+        if (!is_aligned_pointer<4>(old_pointer)) {
+          BufferSlice new_packet(packet.size());
+          new_packet.as_mutable_slice().copy_from(packet.as_slice());
+          packet = std::move(new_packet);
+        }
+        LOG_CHECK(is_aligned_pointer<4>(packet.as_slice().ubegin()))
+            << old_pointer << ' ' << packet.as_slice().ubegin() << ' ' << BufferSlice(0).as_slice().ubegin() << ' '
+            << packet.size() << ' ' << wait_size << ' ' << quick_ack;
       }
 
-      auto old_pointer = packet.as_slice().ubegin();
-      if (!is_aligned_pointer<4>(old_pointer)) {
-        BufferSlice new_packet(packet.size());
-        new_packet.as_mutable_slice().copy_from(packet.as_slice());
-        packet = std::move(new_packet);
+      packets.push_back(std::move(packet));
+      quick_acks.push_back(quick_ack);
+    }
+
+    vector<MutableSlice> messages;
+    vector<PacketInfo> infos;
+    for (size_t i = 0; i < packets.size(); i++) {
+      if (quick_acks[i] == 0) {
+        messages.push_back(packets[i].as_mutable_slice());
+        infos.emplace_back();
+        infos.back().version = 2;
       }
-      LOG_CHECK(is_aligned_pointer<4>(packet.as_slice().ubegin()))
-          << old_pointer << ' ' << packet.as_slice().ubegin() << ' ' << BufferSlice(0).as_slice().ubegin() << ' '
-          << packet.size() << ' ' << wait_size << ' ' << quick_ack;
+    }
+    auto read_results = Transport::read_batch(messages, auth_key, infos);
 
-      PacketInfo info;
-      info.version = 2;
+    size_t message_pos = 0;
+    for (size_t i = 0; i < packets.size(); i++) {
+      if (quick_acks[i] != 0) {
+        TRY_STATUS(on_quick_ack(quick_acks[i], callback));
+        continue;
+      }
 
-      TRY_RESULT(read_result, Transport::read(packet.as_mutable_slice(), auth_key, &info));
+      auto &info = infos[message_pos];
+      TRY_RESULT(read_result, std::move(read_results[message_pos]));
+      message_pos++;
       switch (read_result.type()) {
         case Transport::ReadResult::Quickack:
           TRY_STATUS(on_quick_ack(read_result.quick_ack(), callback));
@@ -209,7 +236,7 @@ class RawConnectionDefault final : public RawConnection {
             }
           }
 
-          TRY_STATUS(callback.on_raw_packet(info, packet.from_slice(read_result.packet())));
+          TRY_STATUS(callback.on_raw_packet(info, packets[i].from_slice(read_result.packet())));
           break;
         case Transport::ReadResult::Nop:
           break;
@@ -218,6 +245,7 @@ class RawConnectionDefault final : public RawConnection {
       }
     }
 
+    TRY_STATUS(std::move(read_status));
     TRY_STATUS(std::move(r));
     return Status::OK();
   }
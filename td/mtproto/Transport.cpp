@@ -216,9 +216,18 @@ Status Transport::read_no_crypto(MutableSlice message, PacketInfo *info, Mutable
   return Status::OK();
 }
 
+void Transport::calc_aes_key_and_iv(const AuthKey &auth_key, const UInt128 &message_key, int X, const PacketInfo *info,
+                                    UInt256 *aes_key, UInt256 *aes_iv) {
+  if (info->version == 1) {
+    KDF(auth_key.key(), message_key, X, aes_key, aes_iv);
+  } else {
+    KDF2(auth_key.key(), message_key, X, aes_key, aes_iv);
+  }
+}
+
 template <class HeaderT, class PrefixT>
 Status Transport::read_crypto_impl(int X, MutableSlice message, const AuthKey &auth_key, HeaderT **header_ptr,
-                                   PrefixT **prefix_ptr, MutableSlice *data, PacketInfo *info) {
+                                   PrefixT **prefix_ptr, MutableSlice *data, PacketInfo *info, bool is_decrypted) {
   if (message.size() < sizeof(HeaderT)) {
     return Status::Error(PSLICE() << "Invalid MTProto message: too small [message.size() = " << message.size()
                                   << "] < [sizeof(HeaderT) = " << sizeof(HeaderT) << "]");
@@ -235,16 +244,13 @@ Status Transport::read_crypto_impl(int X, MutableSlice message, const AuthKey &a
                                   << "] [expected = " << format::as_hex(auth_key.id()) << "]");
   }
 
-  UInt256 aes_key;
-  UInt256 aes_iv;
-  if (info->version == 1) {
-    KDF(auth_key.key(), header->message_key, X, &aes_key, &aes_iv);
-  } else {
-    KDF2(auth_key.key(), header->message_key, X, &aes_key, &aes_iv);
+  if (!is_decrypted) {
+    UInt256 aes_key;
+    UInt256 aes_iv;
+    calc_aes_key_and_iv(auth_key, header->message_key, X, info, &aes_key, &aes_iv);
+    aes_ige_decrypt(as_slice(aes_key), as_mutable_slice(aes_iv), to_decrypt, to_decrypt);
   }
 
-  aes_ige_decrypt(as_slice(aes_key), as_mutable_slice(aes_iv), to_decrypt, to_decrypt);
-
   size_t tail_size = message.end() - reinterpret_cast<char *>(header->data);
   if (tail_size < sizeof(PrefixT)) {
     return Status::Error("Too small encrypted part");
@@ -304,10 +310,11 @@ Status Transport::read_crypto_impl(int X, MutableSlice message, const AuthKey &a
   return Status::OK();
 }
 
-Status Transport::read_crypto(MutableSlice message, const AuthKey &auth_key, PacketInfo *info, MutableSlice *data) {
+Status Transport::read_crypto(MutableSlice message, const AuthKey &auth_key, PacketInfo *info, MutableSlice *data,
+                              bool is_decrypted) {
   CryptoHeader *header = nullptr;
   CryptoPrefix *prefix = nullptr;
-  TRY_STATUS(read_crypto_impl(8, message, auth_key, &header, &prefix, data, info));
+  TRY_STATUS(read_crypto_impl(8, message, auth_key, &header, &prefix, data, info, is_decrypted));
   CHECK(header != nullptr);
   CHECK(prefix != nullptr);
   CHECK(info != nullptr);
@@ -433,6 +440,46 @@ Result<uint64> Transport::read_auth_key_id(Slice message) {
 }
 
 Result<Transport::ReadResult> Transport::read(MutableSlice message, const AuthKey &auth_key, PacketInfo *info) {
+  return read_impl(message, auth_key, info, false);
+}
+
+vector<Result<Transport::ReadResult>> Transport::read_batch(Span<MutableSlice> messages, const AuthKey &auth_key,
+                                                            MutableSpan<PacketInfo> infos) {
+  CHECK(messages.size() == infos.size());
+  // decrypt all packets, which will be read by read_crypto, at once; all checks are done later
+  vector<UInt256> aes_keys(messages.size());
+  vector<UInt256> aes_ivs(messages.size());
+  vector<AesIgeBuffer> buffers;
+  vector<bool> is_decrypted(messages.size(), false);
+  for (size_t i = 0; i < messages.size(); i++) {
+    auto message = messages[i];
+    auto *info = &infos[i];
+    if (info->type == PacketInfo::EndToEnd || auth_key.empty() || message.size() < sizeof(CryptoHeader)) {
+      continue;
+    }
+    auto *header = reinterpret_cast<CryptoHeader *>(message.begin());
+    if (header->auth_key_id == 0 || header->auth_key_id != auth_key.id()) {
+      continue;
+    }
+    auto to_decrypt = MutableSlice(header->encrypt_begin(), message.uend());
+    to_decrypt.remove_suffix(to_decrypt.size() & 15);
+
+    calc_aes_key_and_iv(auth_key, header->message_key, 8, info, &aes_keys[i], &aes_ivs[i]);
+    buffers.push_back({as_slice(aes_keys[i]), as_mutable_slice(aes_ivs[i]), to_decrypt, to_decrypt});
+    is_decrypted[i] = true;
+  }
+  aes_ige_decrypt_multi(buffers);
+
+  vector<Result<ReadResult>> results;
+  results.reserve(messages.size());
+  for (size_t i = 0; i < messages.size(); i++) {
+    results.push_back(read_impl(messages[i], auth_key, &infos[i], is_decrypted[i]));
+  }
+  return results;
+}
+
+Result<Transport::ReadResult> Transport::read_impl(MutableSlice message, const AuthKey &auth_key, PacketInfo *info,
+                                                   bool is_decrypted) {
   if (message.size() < 12) {
     if (message.size() < 4) {
       return Status::Error(PSLICE() << "Invalid MTProto message: smaller than 4 bytes [size = " << message.size()
@@ -460,7 +507,7 @@ Result<Transport::ReadResult> Transport::read(MutableSlice message, const AuthKe
     if (auth_key.empty()) {
       return Status::Error("Failed to decrypt MTProto message: auth key is empty");
     }
-    TRY_STATUS(read_crypto(message, auth_key, info, &data));
+    TRY_STATUS(read_crypto(message, auth_key, info, &data, is_decrypted));
   }
   return ReadResult::make_packet(data);
 }
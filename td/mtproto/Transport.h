@@ -11,6 +11,7 @@
 #include "td/utils/common.h"
 #include "td/utils/logging.h"
 #include "td/utils/Slice.h"
+#include "td/utils/Span.h"
 #include "td/utils/Status.h"
 #include "td/utils/StorerBase.h"
 #include "td/utils/UInt.h"
@@ -88,6 +89,11 @@ class Transport {
   // If auth_key is nonempty, encryption will be used.
   static Result<ReadResult> read(MutableSlice message, const AuthKey &auth_key, PacketInfo *info) TD_WARN_UNUSED_RESULT;
 
+  // Reads several MTProto packets like read does, but decrypts all of them at once.
+  // [infos] must contain PacketInfo for each message.
+  static vector<Result<ReadResult>> read_batch(Span<MutableSlice> messages, const AuthKey &auth_key,
+                                               MutableSpan<PacketInfo> infos) TD_WARN_UNUSED_RESULT;
+
   static size_t write(const Storer &storer, const AuthKey &auth_key, PacketInfo *info,
                       MutableSlice dest = MutableSlice());
 
@@ -107,13 +113,20 @@ class Transport {
 
   static Status read_no_crypto(MutableSlice message, PacketInfo *info, MutableSlice *data) TD_WARN_UNUSED_RESULT;
 
-  static Status read_crypto(MutableSlice message, const AuthKey &auth_key, PacketInfo *info,
-                            MutableSlice *data) TD_WARN_UNUSED_RESULT;
+  static Result<ReadResult> read_impl(MutableSlice message, const AuthKey &auth_key, PacketInfo *info,
+                                      bool is_decrypted) TD_WARN_UNUSED_RESULT;
+
+  static Status read_crypto(MutableSlice message, const AuthKey &auth_key, PacketInfo *info, MutableSlice *data,
+                            bool is_decrypted) TD_WARN_UNUSED_RESULT;
   static Status read_e2e_crypto(MutableSlice message, const AuthKey &auth_key, PacketInfo *info,
                                 MutableSlice *data) TD_WARN_UNUSED_RESULT;
   template <class HeaderT, class PrefixT>
   static Status read_crypto_impl(int X, MutableSlice message, const AuthKey &auth_key, HeaderT **header_ptr,
-                                 PrefixT **prefix_ptr, MutableSlice *data, PacketInfo *info) TD_WARN_UNUSED_RESULT;
+                                 PrefixT **prefix_ptr, MutableSlice *data, PacketInfo *info,
+                                 bool is_decrypted = false) TD_WARN_UNUSED_RESULT;
+
+  static void calc_aes_key_and_iv(const AuthKey &auth_key, const UInt128 &message_key, int X, const PacketInfo *info,
+                                  UInt256 *aes_key, UInt256 *aes_iv);
 
   static size_t write_no_crypto(const Storer &storer, PacketInfo *info, MutableSlice dest);
 
@@ -125,7 +125,8 @@ class ClientManager::Impl final {
 
         CHECK(concurrent_scheduler_ != nullptr);
         auto guard = concurrent_scheduler_->get_main_guard();
-        send_closure_later(it->second, &Td::request, request.id, std::move(request.request));
+        auto priority = Td::get_request_priority(request.request.get());
+        send_closure_later_with_priority(it->second, priority, &Td::request, request.id, std::move(request.request));
       }
       requests_.clear();
     }
@@ -256,7 +257,8 @@ class MultiTd final : public Actor {
             td_api::object_ptr<td_api::Function> &&request) {
     auto &td = tds_[client_id];
     CHECK(!td.empty());
-    send_closure(td, &Td::request, request_id, std::move(request));
+    auto priority = Td::get_request_priority(request.get());
+    send_closure_with_priority(td, priority, &Td::request, request_id, std::move(request));
   }
 
   void close(int32 td_id) {
@@ -23,7 +23,8 @@ void ClientActor::start_up() {
 }
 
 void ClientActor::request(uint64 id, td_api::object_ptr<td_api::Function> request) {
-  send_closure_later(td_, &Td::request, id, std::move(request));
+  auto priority = Td::get_request_priority(request.get());
+  send_closure_later_with_priority(td_, priority, &Td::request, id, std::move(request));
 }
 
 ClientActor::~ClientActor() = default;
@@ -28,28 +28,11 @@ static td_api::object_ptr<td_api::Function> get_return_error_function(Slice erro
 
 static std::pair<td_api::object_ptr<td_api::Function>, string> to_request(Slice request) {
   auto request_str = request.str();
-  auto r_json_value = json_decode(request_str);
-  if (r_json_value.is_error()) {
-    return {get_return_error_function(PSLICE()
-                                      << "Failed to parse request as JSON object: " << r_json_value.error().message()),
-            string()};
-  }
-  auto json_value = r_json_value.move_as_ok();
-  if (json_value.type() != JsonValue::Type::Object) {
-    return {get_return_error_function("Expected a JSON object"), string()};
-  }
-
-  string extra;
-  if (has_json_object_field(json_value.get_object(), "@extra")) {
-    extra = json_encode<string>(
-        get_json_object_field(json_value.get_object(), "@extra", JsonValue::Type::Null).move_as_ok());
-  }
-
   td_api::object_ptr<td_api::Function> func;
-  auto status = from_json(func, std::move(json_value));
+  string extra;
+  auto status = td_api::from_json(func, request_str, extra);
   if (status.is_error()) {
-    return {get_return_error_function(PSLICE() << "Failed to parse JSON object as TDLib request: " << status.message()),
-            std::move(extra)};
+    return {get_return_error_function(PSLICE() << "Failed to parse request: " << status.message()), std::move(extra)};
   }
   return std::make_pair(std::move(func), std::move(extra));
 }
@@ -4161,6 +4161,7 @@ ContactsManager::ContactsManager(Td *td, ActorShared<> parent) : td_(td), parent
 
   user_online_timeout_.set_callback(on_user_online_timeout_callback);
   user_online_timeout_.set_callback_data(static_cast<void *>(this));
+  user_online_timeout_.set_timer_wheel_precision(0.01);
 
   user_emoji_status_timeout_.set_callback(on_user_emoji_status_timeout_callback);
   user_emoji_status_timeout_.set_callback_data(static_cast<void *>(this));
@@ -8548,7 +8549,7 @@ void ContactsManager::report_channel_spam(ChannelId channel_id, const vector<Mes
     return promise.set_value(Unit());
   }
 
-  MultiPromiseActorSafe mpas{"ReportSupergroupSpamMultiPromiseActor"};
+  MultiPromiseJoin mpas{"ReportSupergroupSpamMultiPromiseJoin"};
   mpas.add_promise(std::move(promise));
   auto lock_promise = mpas.get_promise();
 
@@ -9779,7 +9780,7 @@ void ContactsManager::on_get_inactive_channels(vector<tl_object_ptr<telegram_api
                                                Promise<Unit> &&promise) {
   auto channel_ids = get_channel_ids(std::move(chats), "on_get_inactive_channels");
 
-  MultiPromiseActorSafe mpas{"GetInactiveChannelsMultiPromiseActor"};
+  MultiPromiseJoin mpas{"GetInactiveChannelsMultiPromiseJoin"};
   mpas.add_promise(PromiseCreator::lambda([actor_id = actor_id(this), channel_ids,
                                            promise = std::move(promise)](Unit) mutable {
     send_closure(actor_id, &ContactsManager::on_create_inactive_channels, std::move(channel_ids), std::move(promise));
@@ -18330,7 +18331,7 @@ void ContactsManager::on_load_dialog_administrators_from_database(
   LOG(INFO) << "Successfully loaded " << administrators.size() << " administrators in " << dialog_id
             << " from database";
 
-  MultiPromiseActorSafe load_users_multipromise{"LoadUsersMultiPromiseActor"};
+  MultiPromiseJoin load_users_multipromise{"LoadUsersMultiPromiseJoin"};
   load_users_multipromise.add_promise(
       PromiseCreator::lambda([actor_id = actor_id(this), dialog_id, administrators,
                               promise = std::move(promise)](Result<Unit> result) mutable {
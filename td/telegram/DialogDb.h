@@ -12,6 +12,7 @@
 #include "td/telegram/NotificationGroupKey.h"
 
 #include "td/db/KeyValueSyncInterface.h"
+#include "td/db/SqliteWriteBatcher.h"
 
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
@@ -95,6 +96,8 @@ class DialogDbAsyncInterface {
   virtual void close(Promise<Unit> promise) = 0;
 
   virtual void force_flush() = 0;
+
+  virtual SqliteWriteBatcher::Statistics get_write_statistics() const = 0;
 };
 
 Status init_dialog_db(SqliteDb &db, int version, KeyValueSyncInterface &binlog_pmc,
@@ -105,6 +108,7 @@ std::shared_ptr<DialogDbSyncSafeInterface> create_dialog_db_sync(
     std::shared_ptr<SqliteConnectionSafe> sqlite_connection);
 
 std::shared_ptr<DialogDbAsyncInterface> create_dialog_db_async(std::shared_ptr<DialogDbSyncSafeInterface> sync_db,
-                                                               int32 scheduler_id = -1);
+                                                               int32 scheduler_id = -1,
+                                                               vector<int32> reader_scheduler_ids = {});
 
 }  // namespace td
@@ -12,6 +12,7 @@
 
 #include "td/db/SqliteConnectionSafe.h"
 #include "td/db/SqliteDb.h"
+#include "td/db/SqliteReaderPool.h"
 #include "td/db/SqliteStatement.h"
 
 #include "td/actor/actor.h"
@@ -24,7 +25,6 @@
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/StackAllocator.h"
 #include "td/utils/StringBuilder.h"
-#include "td/utils/Time.h"
 #include "td/utils/tl_helpers.h"
 #include "td/utils/unicode.h"
 #include "td/utils/utf8.h"
@@ -226,12 +226,6 @@ class MessageDbImpl final : public MessageDbSyncInterface {
                                         "ORDER BY rowid DESC LIMIT ?3) ORDER BY search_id DESC"));
 
     for (int32 i = 0; i < MESSAGE_DB_INDEX_COUNT; i++) {
-      TRY_RESULT_ASSIGN(
-          get_message_ids_stmts_[i],
-          db_.get_statement(
-              PSLICE() << "SELECT message_id FROM messages WHERE dialog_id = ?1 AND message_id < ?2 AND (index_mask & "
-                       << (1 << i) << ") != 0 ORDER BY message_id DESC LIMIT 1000000"));
-
       TRY_RESULT_ASSIGN(
           get_messages_from_index_stmts_[i].desc_stmt_,
           db_.get_statement(
@@ -623,10 +617,12 @@ class MessageDbImpl final : public MessageDbSyncInterface {
 
   Result<MessageDbMessagePositions> get_dialog_sparse_message_positions(
       MessageDbGetDialogSparseMessagePositionsQuery query) final {
-    auto &stmt = get_message_ids_stmts_[message_search_filter_index(query.filter)];
-    SCOPE_EXIT {
-      stmt.reset();
-    };
+    // the query is rare, so the statement is prepared on demand
+    TRY_RESULT(stmt, db_.get_cached_statement(
+                         PSLICE() << "SELECT message_id FROM messages WHERE dialog_id = ?1 AND message_id < ?2 AND "
+                                     "(index_mask & "
+                                  << (1 << message_search_filter_index(query.filter))
+                                  << ") != 0 ORDER BY message_id DESC LIMIT 1000000"));
     stmt.bind_int64(1, query.dialog_id.get()).ensure();
     stmt.bind_int64(2, query.from_message_id.get()).ensure();
 
@@ -845,7 +841,6 @@ class MessageDbImpl final : public MessageDbSyncInterface {
   SqliteStatement get_scheduled_messages_stmt_;
   SqliteStatement get_messages_from_notification_id_stmt_;
 
-  std::array<SqliteStatement, MESSAGE_DB_INDEX_COUNT> get_message_ids_stmts_;
   std::array<GetMessagesStmt, MESSAGE_DB_INDEX_COUNT> get_messages_from_index_stmts_;
   std::array<SqliteStatement, 2> get_calls_stmts_;
 
@@ -984,8 +979,10 @@ std::shared_ptr<MessageDbSyncSafeInterface> create_message_db_sync(
 
 class MessageDbAsync final : public MessageDbAsyncInterface {
  public:
-  MessageDbAsync(std::shared_ptr<MessageDbSyncSafeInterface> sync_db, int32 scheduler_id) {
-    impl_ = create_actor_on_scheduler<Impl>("MessageDbActor", scheduler_id, std::move(sync_db));
+  MessageDbAsync(std::shared_ptr<MessageDbSyncSafeInterface> sync_db, int32 scheduler_id,
+                 vector<int32> reader_scheduler_ids) {
+    impl_ = create_actor_on_scheduler<Impl>("MessageDbActor", scheduler_id, std::move(sync_db),
+                                            std::move(reader_scheduler_ids), write_batcher_);
   }
 
   void add_message(FullMessageId full_message_id, ServerMessageId unique_message_id, DialogId sender_dialog_id,
@@ -1063,10 +1060,18 @@ class MessageDbAsync final : public MessageDbAsyncInterface {
     send_closure_later(impl_, &Impl::force_flush);
   }
 
+  SqliteWriteBatcher::Statistics get_write_statistics() const final {
+    return write_batcher_->get_statistics();
+  }
+
  private:
   class Impl final : public Actor {
    public:
-    explicit Impl(std::shared_ptr<MessageDbSyncSafeInterface> sync_db_safe) : sync_db_safe_(std::move(sync_db_safe)) {
+    Impl(std::shared_ptr<MessageDbSyncSafeInterface> sync_db_safe, vector<int32> reader_scheduler_ids,
+         std::shared_ptr<SqliteWriteBatcher> write_batcher)
+        : sync_db_safe_(std::move(sync_db_safe))
+        , reader_scheduler_ids_(std::move(reader_scheduler_ids))
+        , write_batcher_(std::move(write_batcher)) {
     }
     void add_message(FullMessageId full_message_id, ServerMessageId unique_message_id, DialogId sender_dialog_id,
                      int64 random_id, int32 ttl_expires_at, int32 index_mask, int64 search_id, string text,
@@ -1131,14 +1136,18 @@ class MessageDbAsync final : public MessageDbAsyncInterface {
     }
 
     void get_dialog_message_calendar(MessageDbDialogCalendarQuery query, Promise<MessageDbCalendar> promise) {
-      add_read_query();
-      promise.set_value(sync_db_->get_dialog_message_calendar(std::move(query)));
+      add_concurrent_read_query(std::move(promise),
+                                [query = std::move(query)](MessageDbSyncInterface &sync_db) mutable {
+                                  return sync_db.get_dialog_message_calendar(std::move(query));
+                                });
     }
 
     void get_dialog_sparse_message_positions(MessageDbGetDialogSparseMessagePositionsQuery query,
                                              Promise<MessageDbMessagePositions> promise) {
-      add_read_query();
-      promise.set_result(sync_db_->get_dialog_sparse_message_positions(std::move(query)));
+      add_concurrent_read_query(std::move(promise),
+                                [query = std::move(query)](MessageDbSyncInterface &sync_db) mutable {
+                                  return sync_db.get_dialog_sparse_message_positions(std::move(query));
+                                });
     }
 
     void get_messages(MessageDbMessagesQuery query, Promise<vector<MessageDbDialogMessage>> promise) {
@@ -1155,12 +1164,16 @@ class MessageDbAsync final : public MessageDbAsyncInterface {
       promise.set_value(sync_db_->get_messages_from_notification_id(dialog_id, from_notification_id, limit));
     }
     void get_calls(MessageDbCallsQuery query, Promise<MessageDbCallsResult> promise) {
-      add_read_query();
-      promise.set_value(sync_db_->get_calls(std::move(query)));
+      add_concurrent_read_query(std::move(promise),
+                                [query = std::move(query)](MessageDbSyncInterface &sync_db) mutable {
+                                  return sync_db.get_calls(std::move(query));
+                                });
     }
     void get_messages_fts(MessageDbFtsQuery query, Promise<MessageDbFtsResult> promise) {
-      add_read_query();
-      promise.set_value(sync_db_->get_messages_fts(std::move(query)));
+      add_concurrent_read_query(std::move(promise),
+                                [query = std::move(query)](MessageDbSyncInterface &sync_db) mutable {
+                                  return sync_db.get_messages_fts(std::move(query));
+                                });
     }
     void get_expiring_messages(int32 expires_till, int32 limit, Promise<vector<MessageDbMessage>> promise) {
       add_read_query();
@@ -1171,7 +1184,8 @@ class MessageDbAsync final : public MessageDbAsyncInterface {
       do_flush();
       sync_db_safe_.reset();
       sync_db_ = nullptr;
-      promise.set_value(Unit());
+      // the readers can still use the database, so wait for them
+      reader_pool_.close(std::move(promise));
       stop();
     }
 
@@ -1183,38 +1197,48 @@ class MessageDbAsync final : public MessageDbAsyncInterface {
    private:
     std::shared_ptr<MessageDbSyncSafeInterface> sync_db_safe_;
     MessageDbSyncInterface *sync_db_ = nullptr;
+    vector<int32> reader_scheduler_ids_;
+    SqliteReaderPool reader_pool_;
 
-    static constexpr size_t MAX_PENDING_QUERIES_COUNT{50};
-    static constexpr double MAX_PENDING_QUERIES_DELAY{0.01};
+    std::shared_ptr<SqliteWriteBatcher> write_batcher_;
 
     //NB: order is important, destructor of pending_writes_ will change finished_writes_
     vector<Promise<Unit>> finished_writes_;
     vector<Promise<Unit>> pending_writes_;  // TODO use Action
-    double wakeup_at_ = 0;
 
     template <class F>
     void add_write_query(F &&f) {
       pending_writes_.push_back(PromiseCreator::lambda(std::forward<F>(f)));
-      if (pending_writes_.size() > MAX_PENDING_QUERIES_COUNT) {
+      if (write_batcher_->add_query()) {
         do_flush();
-        wakeup_at_ = 0;
-      } else if (wakeup_at_ == 0) {
-        wakeup_at_ = Time::now_cached() + MAX_PENDING_QUERIES_DELAY;
-      }
-      if (wakeup_at_ != 0) {
-        set_timeout_at(wakeup_at_);
+      } else if (write_batcher_->get_pending_query_count() == 1) {
+        set_timeout_at(write_batcher_->get_commit_time());
       }
     }
     void add_read_query() {
       do_flush();
     }
+    // long read-only queries are executed by the reader pool to not block writes and other reads
+    template <class T, class F>
+    void add_concurrent_read_query(Promise<T> promise, F &&f) {
+      add_read_query();
+      if (reader_pool_.empty()) {
+        promise.set_result(f(*sync_db_));
+        return;
+      }
+      reader_pool_.run([sync_db_safe = sync_db_safe_, f = std::forward<F>(f), promise = std::move(promise)]() mutable {
+        promise.set_result(f(sync_db_safe->get()));
+      });
+    }
     void do_flush() {
       if (pending_writes_.empty()) {
         return;
       }
-      sync_db_->begin_write_transaction().ensure();
-      set_promises(pending_writes_);
-      sync_db_->commit_transaction().ensure();
+      write_batcher_->commit([&] {
+        sync_db_->begin_write_transaction().ensure();
+        set_promises(pending_writes_);
+        sync_db_->commit_transaction().ensure();
+      });
       set_promises(finished_writes_);
       cancel_timeout();
     }
@@ -1224,14 +1248,17 @@ class MessageDbAsync final : public MessageDbAsyncInterface {
 
     void start_up() final {
       sync_db_ = &sync_db_safe_->get();
+      reader_pool_ = SqliteReaderPool(reader_scheduler_ids_);
     }
   };
+  std::shared_ptr<SqliteWriteBatcher> write_batcher_ = std::make_shared<SqliteWriteBatcher>();
   ActorOwn<Impl> impl_;
 };
 
 std::shared_ptr<MessageDbAsyncInterface> create_message_db_async(std::shared_ptr<MessageDbSyncSafeInterface> sync_db,
-                                                                 int32 scheduler_id) {
-  return std::make_shared<MessageDbAsync>(std::move(sync_db), scheduler_id);
+                                                                 int32 scheduler_id,
+                                                                 vector<int32> reader_scheduler_ids) {
+  return std::make_shared<MessageDbAsync>(std::move(sync_db), scheduler_id, std::move(reader_scheduler_ids));
 }
 
 }  // namespace td
@@ -13,6 +13,8 @@
 #include "td/telegram/NotificationId.h"
 #include "td/telegram/ServerMessageId.h"
 
+#include "td/db/SqliteWriteBatcher.h"
+
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
 #include "td/utils/Promise.h"
@@ -191,6 +193,8 @@ class MessageDbAsyncInterface {
 
   virtual void close(Promise<> promise) = 0;
   virtual void force_flush() = 0;
+
+  virtual SqliteWriteBatcher::Statistics get_write_statistics() const = 0;
 };
 
 Status init_message_db(SqliteDb &db, int version) TD_WARN_UNUSED_RESULT;
@@ -200,6 +204,7 @@ std::shared_ptr<MessageDbSyncSafeInterface> create_message_db_sync(
     std::shared_ptr<SqliteConnectionSafe> sqlite_connection);
 
 std::shared_ptr<MessageDbAsyncInterface> create_message_db_async(std::shared_ptr<MessageDbSyncSafeInterface> sync_db,
-                                                                 int32 scheduler_id = -1);
+                                                                 int32 scheduler_id = -1,
+                                                                 vector<int32> reader_scheduler_ids = {});
 
 }  // namespace td
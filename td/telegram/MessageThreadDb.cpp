@@ -19,7 +19,6 @@
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
 #include "td/utils/ScopeGuard.h"
-#include "td/utils/Time.h"
 
 namespace td {
 // NB: must happen inside a transaction
@@ -190,7 +189,7 @@ std::shared_ptr<MessageThreadDbSyncSafeInterface> create_message_thread_db_sync(
 class MessageThreadDbAsync final : public MessageThreadDbAsyncInterface {
  public:
   MessageThreadDbAsync(std::shared_ptr<MessageThreadDbSyncSafeInterface> sync_db, int32 scheduler_id) {
-    impl_ = create_actor_on_scheduler<Impl>("MessageThreadDbActor", scheduler_id, std::move(sync_db));
+    impl_ = create_actor_on_scheduler<Impl>("MessageThreadDbActor", scheduler_id, std::move(sync_db), write_batcher_);
   }
 
   void add_message_thread(DialogId dialog_id, MessageId top_thread_message_id, int64 order, BufferSlice data,
@@ -224,11 +223,16 @@ class MessageThreadDbAsync final : public MessageThreadDbAsyncInterface {
     send_closure_later(impl_, &Impl::force_flush);
   }
 
+  SqliteWriteBatcher::Statistics get_write_statistics() const final {
+    return write_batcher_->get_statistics();
+  }
+
  private:
   class Impl final : public Actor {
    public:
-    explicit Impl(std::shared_ptr<MessageThreadDbSyncSafeInterface> sync_db_safe)
-        : sync_db_safe_(std::move(sync_db_safe)) {
+    Impl(std::shared_ptr<MessageThreadDbSyncSafeInterface> sync_db_safe,
+         std::shared_ptr<SqliteWriteBatcher> write_batcher)
+        : sync_db_safe_(std::move(sync_db_safe)), write_batcher_(std::move(write_batcher)) {
     }
 
     void add_message_thread(DialogId dialog_id, MessageId top_thread_message_id, int64 order, BufferSlice data,
@@ -287,25 +291,19 @@ class MessageThreadDbAsync final : public MessageThreadDbAsyncInterface {
     std::shared_ptr<MessageThreadDbSyncSafeInterface> sync_db_safe_;
     MessageThreadDbSyncInterface *sync_db_ = nullptr;
 
-    static constexpr size_t MAX_PENDING_QUERIES_COUNT{50};
-    static constexpr double MAX_PENDING_QUERIES_DELAY{0.01};
+    std::shared_ptr<SqliteWriteBatcher> write_batcher_;
 
     //NB: order is important, destructor of pending_writes_ will change finished_writes_
     vector<Promise<Unit>> finished_writes_;
     vector<Promise<Unit>> pending_writes_;  // TODO use Action
-    double wakeup_at_ = 0;
 
     template <class F>
     void add_write_query(F &&f) {
       pending_writes_.push_back(PromiseCreator::lambda(std::forward<F>(f)));
-      if (pending_writes_.size() > MAX_PENDING_QUERIES_COUNT) {
+      if (write_batcher_->add_query()) {
         do_flush();
-        wakeup_at_ = 0;
-      } else if (wakeup_at_ == 0) {
-        wakeup_at_ = Time::now_cached() + MAX_PENDING_QUERIES_DELAY;
-      }
-      if (wakeup_at_ != 0) {
-        set_timeout_at(wakeup_at_);
+      } else if (write_batcher_->get_pending_query_count() == 1) {
+        set_timeout_at(write_batcher_->get_commit_time());
       }
     }
 
@@ -317,9 +315,11 @@ class MessageThreadDbAsync final : public MessageThreadDbAsyncInterface {
       if (pending_writes_.empty()) {
         return;
       }
-      sync_db_->begin_write_transaction().ensure();
-      set_promises(pending_writes_);
-      sync_db_->commit_transaction().ensure();
+      write_batcher_->commit([&] {
+        sync_db_->begin_write_transaction().ensure();
+        set_promises(pending_writes_);
+        sync_db_->commit_transaction().ensure();
+      });
       set_promises(finished_writes_);
       cancel_timeout();
     }
@@ -332,6 +332,7 @@ class MessageThreadDbAsync final : public MessageThreadDbAsyncInterface {
       sync_db_ = &sync_db_safe_->get();
     }
   };
+  std::shared_ptr<SqliteWriteBatcher> write_batcher_ = std::make_shared<SqliteWriteBatcher>();
   ActorOwn<Impl> impl_;
 };
 
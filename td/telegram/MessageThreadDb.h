@@ -9,6 +9,8 @@
 #include "td/telegram/DialogId.h"
 #include "td/telegram/MessageId.h"
 
+#include "td/db/SqliteWriteBatcher.h"
+
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
 #include "td/utils/Promise.h"
@@ -83,6 +85,8 @@ class MessageThreadDbAsyncInterface {
   virtual void close(Promise<Unit> promise) = 0;
 
   virtual void force_flush() = 0;
+
+  virtual SqliteWriteBatcher::Statistics get_write_statistics() const = 0;
 };
 
 Status init_message_thread_db(SqliteDb &db, int version) TD_WARN_UNUSED_RESULT;
@@ -5887,6 +5887,7 @@ MessagesManager::MessagesManager(Td *td, ActorShared<> parent)
 
   pending_unload_dialog_timeout_.set_callback(on_pending_unload_dialog_timeout_callback);
   pending_unload_dialog_timeout_.set_callback_data(static_cast<void *>(this));
+  pending_unload_dialog_timeout_.set_timer_wheel_precision(0.01);
 
   dialog_unmute_timeout_.set_callback(on_dialog_unmute_timeout_callback);
   dialog_unmute_timeout_.set_callback_data(static_cast<void *>(this));
@@ -5896,6 +5897,7 @@ MessagesManager::MessagesManager(Td *td, ActorShared<> parent)
 
   active_dialog_action_timeout_.set_callback(on_active_dialog_action_timeout_callback);
   active_dialog_action_timeout_.set_callback_data(static_cast<void *>(this));
+  active_dialog_action_timeout_.set_timer_wheel_precision(0.01);
 
   update_dialog_online_member_count_timeout_.set_callback(on_update_dialog_online_member_count_timeout_callback);
   update_dialog_online_member_count_timeout_.set_callback_data(static_cast<void *>(this));
@@ -9732,7 +9734,7 @@ void MessagesManager::get_channel_difference_if_needed(DialogId dialog_id, Messa
 }
 
 void MessagesManager::get_channel_differences_if_needed(MessagesInfo &&messages_info, Promise<MessagesInfo> &&promise) {
-  MultiPromiseActorSafe mpas{"GetChannelDifferencesIfNeededMultiPromiseActor"};
+  MultiPromiseJoin mpas{"GetChannelDifferencesIfNeededMultiPromiseJoin"};
   mpas.add_promise(Promise<Unit>());
   mpas.set_ignore_errors(true);
   auto lock = mpas.get_promise();
@@ -11143,7 +11145,7 @@ void MessagesManager::delete_messages_on_server(DialogId dialog_id, vector<Messa
     log_event_id = save_delete_messages_on_server_log_event(dialog_id, message_ids, revoke);
   }
 
-  MultiPromiseActorSafe mpas{"DeleteMessagesOnServerMultiPromiseActor"};
+  MultiPromiseJoin mpas{"DeleteMessagesOnServerMultiPromiseJoin"};
   mpas.add_promise(std::move(promise));
   if (log_event_id != 0) {
     mpas.add_promise(PromiseCreator::lambda([actor_id = actor_id(this), log_event_id](Unit) {
@@ -42,6 +42,7 @@
 #include "td/utils/port/Clocks.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
+#include "td/utils/Tracer.h"
 
 #include <cmath>
 #include <functional>
@@ -124,6 +125,15 @@ OptionManager::OptionManager(Td *td)
   set_option_empty("forum_member_count_min");
   set_option_empty("themed_emoji_statuses_sticker_set_id");
   set_option_empty("themed_premium_statuses_sticker_set_id");
+
+  update_binlog_group_commit_delay();
+  update_sqlite_options();
+  if (get_option_boolean("use_actor_profiling")) {
+    update_actor_profiling();
+  }
+  if (!get_option_string("trace_file_name").empty()) {
+    update_tracing();
+  }
 }
 
 OptionManager::~OptionManager() = default;
@@ -234,6 +244,44 @@ td_api::object_ptr<td_api::OptionValue> OptionManager::get_unix_time_option_valu
   return td_api::make_object<td_api::optionValueInteger>(G()->unix_time());
 }
 
+void OptionManager::update_binlog_group_commit_delay() {
+  // in milliseconds; 3 milliseconds by default
+  auto delay = get_option_integer("binlog_group_commit_delay", 3);
+  G()->td_db()->set_binlog_group_commit_delay(static_cast<double>(delay) * 1e-3);
+}
+
+void OptionManager::update_sqlite_options() {
+  // the options are applied to the main database connection and to connections opened after the change
+  auto mmap_size = get_option_integer("sqlite_mmap_size", -1);
+  auto cache_size = get_option_integer("sqlite_cache_size", 0);
+  auto wal_autocheckpoint = static_cast<int32>(get_option_integer("sqlite_wal_autocheckpoint", -1));
+  G()->td_db()->set_sqlite_options(mmap_size, cache_size, wal_autocheckpoint);
+}
+
+void OptionManager::update_actor_profiling() {
+  // profiling is process-wide, so the last changed value wins if there are several clients
+  Scheduler::set_profiling_enabled(get_option_boolean("use_actor_profiling"));
+}
+
+void OptionManager::update_tracing() {
+  // tracing is process-wide; events recorded so far are saved to the previous path and a new trace is started
+  if (!trace_file_path_.empty()) {
+    Tracer::stop();
+    auto status = Tracer::dump(trace_file_path_);
+    if (status.is_error()) {
+      LOG(ERROR) << "Failed to save trace to " << trace_file_path_ << ": " << status;
+    }
+  }
+  auto trace_file_name = get_option_string("trace_file_name");
+  if (trace_file_name.empty()) {
+    trace_file_path_.clear();
+  } else {
+    // the trace is saved only to the database directory to not overwrite arbitrary files
+    trace_file_path_ = PSTRING() << G()->get_dir() << trace_file_name;
+    Tracer::start();
+  }
+}
+
 void OptionManager::send_unix_time_update() {
   last_sent_server_time_difference_ = G()->get_server_time_difference();
   td_->send_update(td_api::make_object<td_api::updateOption>("unix_time", get_unix_time_option_value_object()));
@@ -351,6 +399,9 @@ void OptionManager::on_option_updated(Slice name) {
       if (name == "base_language_pack_version") {
         send_closure(td_->language_pack_manager_, &LanguagePackManager::on_language_pack_version_changed, true, -1);
       }
+      if (name == "binlog_group_commit_delay") {
+        update_binlog_group_commit_delay();
+      }
       break;
     case 'c':
       if (name == "connection_parameters") {
@@ -457,8 +508,19 @@ void OptionManager::on_option_updated(Slice name) {
         G()->net_query_dispatcher().update_session_count();
         td_->updates_manager_->init_sessions(false);
       }
+      if (name == "sqlite_cache_size" || name == "sqlite_mmap_size" || name == "sqlite_wal_autocheckpoint") {
+        update_sqlite_options();
+      }
+      break;
+    case 't':
+      if (name == "trace_file_name") {
+        update_tracing();
+      }
       break;
     case 'u':
+      if (name == "use_actor_profiling") {
+        update_actor_profiling();
+      }
       if (name == "use_pfs") {
         G()->net_query_dispatcher().update_use_pfs();
       }
@@ -634,6 +696,11 @@ void OptionManager::set_option(const string &name, td_api::object_ptr<td_api::Op
         return;
       }
       break;
+    case 'b':
+      if (set_integer_option("binlog_group_commit_delay", 0, 1000)) {
+        return;
+      }
+      break;
     case 'c':
       if (!is_bot && set_string_option("connection_parameters", [](Slice value) {
             string value_copy = value.str();
@@ -772,6 +839,15 @@ void OptionManager::set_option(const string &name, td_api::object_ptr<td_api::Op
       }
       break;
     case 's':
+      if (set_integer_option("sqlite_cache_size", 0, 256 << 10)) {
+        return;
+      }
+      if (set_integer_option("sqlite_mmap_size", 0, static_cast<int64>(1) << 30)) {
+        return;
+      }
+      if (set_integer_option("sqlite_wal_autocheckpoint", 1, 1000000)) {
+        return;
+      }
       if (set_integer_option("storage_max_files_size")) {
         return;
       }
@@ -792,8 +868,17 @@ void OptionManager::set_option(const string &name, td_api::object_ptr<td_api::Op
       if (set_boolean_option("test_flood_wait")) {
         return;
       }
+      if (set_string_option("trace_file_name", [](Slice value) {
+            return value.size() <= 64 && value[0] != '.' && ends_with(value, ".json") &&
+                   value.find('/') == Slice::npos && value.find('\\') == Slice::npos;
+          })) {
+        return;
+      }
       break;
     case 'u':
+      if (set_boolean_option("use_actor_profiling")) {
+        return;
+      }
       if (set_boolean_option("use_pfs")) {
         return;
       }
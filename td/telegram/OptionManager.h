@@ -82,6 +82,14 @@ class OptionManager {
 
   void send_unix_time_update();
 
+  void update_binlog_group_commit_delay();
+
+  void update_sqlite_options();
+
+  void update_actor_profiling();
+
+  void update_tracing();
+
   Td *td_;
   bool is_td_inited_ = false;
   vector<std::pair<string, Promise<td_api::object_ptr<td_api::OptionValue>>>> pending_get_options_;
@@ -90,6 +98,8 @@ class OptionManager {
   unique_ptr<TsSeqKeyValue> options_;
   std::shared_ptr<KeyValueSyncInterface> option_pmc_;
 
+  string trace_file_path_;
+
   std::atomic<double> last_sent_server_time_difference_{1e100};
 };
 
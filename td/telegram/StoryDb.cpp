@@ -11,6 +11,7 @@
 
 #include "td/db/SqliteConnectionSafe.h"
 #include "td/db/SqliteDb.h"
+#include "td/db/SqliteReaderPool.h"
 #include "td/db/SqliteStatement.h"
 
 #include "td/actor/actor.h"
@@ -20,7 +21,6 @@
 #include "td/utils/logging.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/StringBuilder.h"
-#include "td/utils/Time.h"
 
 #include <utility>
 
@@ -358,8 +358,10 @@ std::shared_ptr<StoryDbSyncSafeInterface> create_story_db_sync(
 
 class StoryDbAsync final : public StoryDbAsyncInterface {
  public:
-  StoryDbAsync(std::shared_ptr<StoryDbSyncSafeInterface> sync_db, int32 scheduler_id) {
-    impl_ = create_actor_on_scheduler<Impl>("StoryDbActor", scheduler_id, std::move(sync_db));
+  StoryDbAsync(std::shared_ptr<StoryDbSyncSafeInterface> sync_db, int32 scheduler_id,
+               vector<int32> reader_scheduler_ids) {
+    impl_ = create_actor_on_scheduler<Impl>("StoryDbActor", scheduler_id, std::move(sync_db),
+                                            std::move(reader_scheduler_ids), write_batcher_);
   }
 
   void add_story(StoryFullId story_full_id, int32 expires_at, NotificationId notification_id, BufferSlice data,
@@ -421,10 +423,18 @@ class StoryDbAsync final : public StoryDbAsyncInterface {
     send_closure_later(impl_, &Impl::force_flush);
   }
 
+  SqliteWriteBatcher::Statistics get_write_statistics() const final {
+    return write_batcher_->get_statistics();
+  }
+
  private:
   class Impl final : public Actor {
    public:
-    explicit Impl(std::shared_ptr<StoryDbSyncSafeInterface> sync_db_safe) : sync_db_safe_(std::move(sync_db_safe)) {
+    Impl(std::shared_ptr<StoryDbSyncSafeInterface> sync_db_safe, vector<int32> reader_scheduler_ids,
+         std::shared_ptr<SqliteWriteBatcher> write_batcher)
+        : sync_db_safe_(std::move(sync_db_safe))
+        , reader_scheduler_ids_(std::move(reader_scheduler_ids))
+        , write_batcher_(std::move(write_batcher)) {
     }
     void add_story(StoryFullId story_full_id, int32 expires_at, NotificationId notification_id, BufferSlice data,
                    Promise<Unit> promise) {
@@ -486,8 +496,10 @@ class StoryDbAsync final : public StoryDbAsyncInterface {
 
     void get_active_story_list(StoryListId story_list_id, int64 order, DialogId dialog_id, int32 limit,
                                Promise<StoryDbGetActiveStoryListResult> promise) {
-      add_read_query();
-      promise.set_value(sync_db_->get_active_story_list(story_list_id, order, dialog_id, limit));
+      add_concurrent_read_query(std::move(promise),
+                                [story_list_id, order, dialog_id, limit](StoryDbSyncInterface &sync_db) {
+                                  return sync_db.get_active_story_list(story_list_id, order, dialog_id, limit);
+                                });
     }
 
     void add_active_story_list_state(StoryListId story_list_id, BufferSlice data, Promise<Unit> promise) {
@@ -506,7 +518,8 @@ class StoryDbAsync final : public StoryDbAsyncInterface {
       do_flush();
       sync_db_safe_.reset();
       sync_db_ = nullptr;
-      promise.set_value(Unit());
+      // the readers can still use the database, so wait for them
+      reader_pool_.close(std::move(promise));
       stop();
     }
 
@@ -518,38 +531,48 @@ class StoryDbAsync final : public StoryDbAsyncInterface {
    private:
     std::shared_ptr<StoryDbSyncSafeInterface> sync_db_safe_;
     StoryDbSyncInterface *sync_db_ = nullptr;
+    vector<int32> reader_scheduler_ids_;
+    SqliteReaderPool reader_pool_;
 
-    static constexpr size_t MAX_PENDING_QUERIES_COUNT{50};
-    static constexpr double MAX_PENDING_QUERIES_DELAY{0.01};
+    std::shared_ptr<SqliteWriteBatcher> write_batcher_;
 
     //NB: order is important, destructor of pending_writes_ will change finished_writes_
     vector<Promise<Unit>> finished_writes_;
     vector<Promise<Unit>> pending_writes_;  // TODO use Action
-    double wakeup_at_ = 0;
 
     template <class F>
     void add_write_query(F &&f) {
       pending_writes_.push_back(PromiseCreator::lambda(std::forward<F>(f)));
-      if (pending_writes_.size() > MAX_PENDING_QUERIES_COUNT) {
+      if (write_batcher_->add_query()) {
         do_flush();
-        wakeup_at_ = 0;
-      } else if (wakeup_at_ == 0) {
-        wakeup_at_ = Time::now_cached() + MAX_PENDING_QUERIES_DELAY;
-      }
-      if (wakeup_at_ != 0) {
-        set_timeout_at(wakeup_at_);
+      } else if (write_batcher_->get_pending_query_count() == 1) {
+        set_timeout_at(write_batcher_->get_commit_time());
       }
     }
     void add_read_query() {
       do_flush();
     }
+    // long read-only queries are executed by the reader pool to not block writes and other reads
+    template <class T, class F>
+    void add_concurrent_read_query(Promise<T> promise, F &&f) {
+      add_read_query();
+      if (reader_pool_.empty()) {
+        promise.set_result(f(*sync_db_));
+        return;
+      }
+      reader_pool_.run([sync_db_safe = sync_db_safe_, f = std::forward<F>(f), promise = std::move(promise)]() mutable {
+        promise.set_result(f(sync_db_safe->get()));
+      });
+    }
     void do_flush() {
       if (pending_writes_.empty()) {
         return;
       }
-      sync_db_->begin_write_transaction().ensure();
-      set_promises(pending_writes_);
-      sync_db_->commit_transaction().ensure();
+      write_batcher_->commit([&] {
+        sync_db_->begin_write_transaction().ensure();
+        set_promises(pending_writes_);
+        sync_db_->commit_transaction().ensure();
+      });
       set_promises(finished_writes_);
       cancel_timeout();
     }
@@ -559,14 +582,16 @@ class StoryDbAsync final : public StoryDbAsyncInterface {
 
     void start_up() final {
       sync_db_ = &sync_db_safe_->get();
+      reader_pool_ = SqliteReaderPool(reader_scheduler_ids_);
     }
   };
+  std::shared_ptr<SqliteWriteBatcher> write_batcher_ = std::make_shared<SqliteWriteBatcher>();
   ActorOwn<Impl> impl_;
 };
 
 std::shared_ptr<StoryDbAsyncInterface> create_story_db_async(std::shared_ptr<StoryDbSyncSafeInterface> sync_db,
-                                                             int32 scheduler_id) {
-  return std::make_shared<StoryDbAsync>(std::move(sync_db), scheduler_id);
+                                                             int32 scheduler_id, vector<int32> reader_scheduler_ids) {
+  return std::make_shared<StoryDbAsync>(std::move(sync_db), scheduler_id, std::move(reader_scheduler_ids));
 }
 
 }  // namespace td
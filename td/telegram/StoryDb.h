@@ -11,6 +11,8 @@
 #include "td/telegram/StoryFullId.h"
 #include "td/telegram/StoryListId.h"
 
+#include "td/db/SqliteWriteBatcher.h"
+
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
 #include "td/utils/Promise.h"
@@ -120,6 +122,8 @@ class StoryDbAsyncInterface {
 
   virtual void close(Promise<Unit> promise) = 0;
   virtual void force_flush() = 0;
+
+  virtual SqliteWriteBatcher::Statistics get_write_statistics() const = 0;
 };
 
 Status init_story_db(SqliteDb &db, int version) TD_WARN_UNUSED_RESULT;
@@ -128,6 +132,7 @@ Status drop_story_db(SqliteDb &db, int version) TD_WARN_UNUSED_RESULT;
 std::shared_ptr<StoryDbSyncSafeInterface> create_story_db_sync(std::shared_ptr<SqliteConnectionSafe> sqlite_connection);
 
 std::shared_ptr<StoryDbAsyncInterface> create_story_db_async(std::shared_ptr<StoryDbSyncSafeInterface> sync_db,
-                                                             int32 scheduler_id = -1);
+                                                             int32 scheduler_id = -1,
+                                                             vector<int32> reader_scheduler_ids = {});
 
 }  // namespace td
@@ -170,6 +170,7 @@
 #include "td/utils/Status.h"
 #include "td/utils/Timer.h"
 #include "td/utils/tl_parsers.h"
+#include "td/utils/Tracer.h"
 #include "td/utils/utf8.h"
 
 #include <limits>
@@ -2858,6 +2859,7 @@ bool Td::is_preauthentication_request(int32 id) {
     case td_api::getStorageStatistics::ID:
     case td_api::getStorageStatisticsFast::ID:
     case td_api::getDatabaseStatistics::ID:
+    case td_api::getActorStatistics::ID:
     case td_api::setNetworkType::ID:
     case td_api::getNetworkStatistics::ID:
     case td_api::addNetworkStatistics::ID:
@@ -2883,6 +2885,44 @@ bool Td::is_preauthentication_request(int32 id) {
   }
 }
 
+EventPriority Td::get_request_priority(const td_api::Function *function) {
+  if (function == nullptr) {
+    return EventPriority::Normal;
+  }
+  auto id = function->get_id();
+  switch (id) {
+    // cheap requests, which are expected to be answered immediately
+    case td_api::getOption::ID:
+    case td_api::setOption::ID:
+    case td_api::openChat::ID:
+    case td_api::closeChat::ID:
+    case td_api::viewMessages::ID:
+      return EventPriority::High;
+    // expensive requests, which can wait for cheaper requests
+    case td_api::getChatHistory::ID:
+    case td_api::getMessageThreadHistory::ID:
+    case td_api::searchChatMessages::ID:
+    case td_api::searchSecretMessages::ID:
+    case td_api::searchMessages::ID:
+    case td_api::searchCallMessages::ID:
+    case td_api::getChatSparseMessagePositions::ID:
+    case td_api::getChatMessageCalendar::ID:
+    case td_api::getChatMessagePosition::ID:
+    case td_api::getStorageStatistics::ID:
+    case td_api::optimizeStorage::ID:
+    case td_api::getDatabaseStatistics::ID:
+      return EventPriority::Low;
+    // requests, which must not overtake previously sent requests
+    case td_api::deleteAccount::ID:
+    case td_api::logOut::ID:
+    case td_api::close::ID:
+    case td_api::destroy::ID:
+      return EventPriority::Normal;
+    default:
+      return is_authentication_request(id) ? EventPriority::High : EventPriority::Normal;
+  }
+}
+
 td_api::object_ptr<td_api::AuthorizationState> Td::get_fake_authorization_state_object() const {
   switch (state_) {
     case State::WaitParameters:
@@ -2921,6 +2961,10 @@ DbKey Td::as_db_key(string key) {
   return DbKey::raw_key(std::move(key));
 }
 
+static string get_request_trace_name(int32 function_id) {
+  return PSTRING() << "request " << format::as_hex(function_id);
+}
+
 void Td::request(uint64 id, tl_object_ptr<td_api::Function> function) {
   if (id == 0) {
     LOG(ERROR) << "Ignore request with ID == 0: " << to_string(function);
@@ -2933,6 +2977,9 @@ void Td::request(uint64 id, tl_object_ptr<td_api::Function> function) {
 
   VLOG(td_requests) << "Receive request " << id << ": " << to_string(function);
   request_set_.emplace(id, function->get_id());
+  if (unlikely(Tracer::is_enabled())) {
+    Tracer::async_begin("td_request", get_request_trace_name(function->get_id()), id);
+  }
   if (is_synchronous_request(function.get())) {
     // send response synchronously
     return send_result(id, static_request(std::move(function)));
@@ -4044,6 +4091,9 @@ void Td::send_result(uint64 id, tl_object_ptr<td_api::Object> object) {
       object = make_tl_object<td_api::error>(404, "Not Found");
     }
     VLOG(td_requests) << "Sending result for request " << id << ": " << to_string(object);
+    if (unlikely(Tracer::is_enabled())) {
+      Tracer::async_end("td_request", get_request_trace_name(it->second), id);
+    }
     request_set_.erase(it);
     callback_->on_result(id, std::move(object));
   }
@@ -4058,6 +4108,9 @@ void Td::send_error_impl(uint64 id, tl_object_ptr<td_api::error> error) {
       LOG(FATAL) << "Lost promise for query " << id << " of type " << it->second << " in close state " << close_flag_;
     }
     VLOG(td_requests) << "Sending error for request " << id << ": " << oneline(to_string(error));
+    if (unlikely(Tracer::is_enabled())) {
+      Tracer::async_end("td_request", get_request_trace_name(it->second), id);
+    }
     request_set_.erase(it);
     callback_->on_error(id, std::move(error));
   }
@@ -4844,6 +4897,18 @@ void Td::on_request(uint64 id, td_api::getDatabaseStatistics &request) {
   send_closure(storage_manager_, &StorageManager::get_database_stats, std::move(query_promise));
 }
 
+void Td::on_request(uint64 id, const td_api::getActorStatistics &request) {
+  if (!Scheduler::is_profiling_enabled()) {
+    return send_error_raw(id, 400, "Actor profiling is disabled");
+  }
+  CREATE_REQUEST_PROMISE();
+  string statistics;
+  for (auto &profile : Scheduler::get_profiles()) {
+    statistics += PSTRING() << profile << '\n';
+  }
+  promise.set_value(td_api::make_object<td_api::actorStatistics>(std::move(statistics)));
+}
+
 void Td::on_request(uint64 id, td_api::optimizeStorage &request) {
   std::vector<FileType> file_types;
   for (auto &file_type : request.file_types_) {
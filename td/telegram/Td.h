@@ -115,6 +115,9 @@ class Td final : public Actor {
 
   void request(uint64 id, tl_object_ptr<td_api::Function> function);
 
+  // returns priority with which the request must be sent to Td
+  static EventPriority get_request_priority(const td_api::Function *function);
+
   void destroy();
 
   void schedule_get_terms_of_service(int32 expires_in);
@@ -600,6 +603,8 @@ class Td final : public Actor {
 
   void on_request(uint64 id, td_api::getDatabaseStatistics &request);
 
+  void on_request(uint64 id, const td_api::getActorStatistics &request);
+
   void on_request(uint64 id, td_api::optimizeStorage &request);
 
   void on_request(uint64 id, td_api::getNetworkStatistics &request);
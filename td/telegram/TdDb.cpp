@@ -20,6 +20,7 @@
 #include "td/db/binlog/Binlog.h"
 #include "td/db/binlog/ConcurrentBinlog.h"
 #include "td/db/BinlogKeyValue.h"
+#include "td/db/SqliteCheckpointer.h"
 #include "td/db/SqliteConnectionSafe.h"
 #include "td/db/SqliteDb.h"
 #include "td/db/SqliteKeyValue.h"
@@ -55,6 +56,31 @@ std::string get_sqlite_path(const TdDb::Parameters &parameters) {
   return parameters.database_directory_ + db_name + ".sqlite";
 }
 
+// read-only SQLite queries are executed on the schedulers following the database scheduler, i.e. on the file GC and
+// the slow network schedulers; no dedicated scheduler is created, because all clients of a ClientManager share
+// a fixed set of threads, and the shared schedulers are idle most of the time; file GC and slow network queries
+// aren't latency-sensitive, so they can wait for a reader query to finish, and the pool sends each query
+// to the reader with the least number of pending queries
+vector<int32> get_sqlite_reader_scheduler_ids() {
+  constexpr int32 MAX_SQLITE_READER_COUNT = 2;
+  auto scheduler_id = Scheduler::instance()->sched_id();
+  auto scheduler_count = Scheduler::instance()->sched_count();
+  vector<int32> result;
+  for (int32 i = 1; i <= MAX_SQLITE_READER_COUNT && scheduler_id + i < scheduler_count; i++) {
+    result.push_back(scheduler_id + i);
+  }
+  return result;
+}
+
+// the scheduler after the database scheduler is used for garbage collection and is mostly idle
+int32 get_sqlite_checkpoint_scheduler_id() {
+  auto scheduler_id = Scheduler::instance()->sched_id();
+  if (scheduler_id + 1 < Scheduler::instance()->sched_count()) {
+    return scheduler_id + 1;
+  }
+  return -1;
+}
+
 Status init_binlog(Binlog &binlog, string path, BinlogKeyValue<Binlog> &binlog_pmc, BinlogKeyValue<Binlog> &config_pmc,
                    TdDb::OpenedDatabase &events, DbKey key) {
   auto r_binlog_stat = stat(path);
@@ -242,6 +268,40 @@ StoryDbAsyncInterface *TdDb::get_story_db_async() {
   return story_db_async_.get();
 }
 
+void TdDb::set_binlog_group_commit_delay(double delay) {
+  CHECK(binlog_);
+  binlog_->set_group_commit_delay(delay);
+}
+
+void TdDb::set_sqlite_options(int64 mmap_size, int64 cache_size, int32 wal_autocheckpoint) {
+  if (sql_connection_ == nullptr) {
+    return;
+  }
+  constexpr int64 MAX_SQLITE_MMAP_SIZE = static_cast<int64>(1) << 30;
+  constexpr int64 MAX_SQLITE_CACHE_SIZE = 256 << 10;
+  constexpr int32 MAX_SQLITE_WAL_AUTOCHECKPOINT = 1000000;
+  auto options = sql_connection_->get_options();
+  options.mmap_size = mmap_size < 0 ? -1 : min(mmap_size, MAX_SQLITE_MMAP_SIZE);
+  options.cache_size = clamp(cache_size, static_cast<int64>(0), MAX_SQLITE_CACHE_SIZE);
+  options.wal_autocheckpoint = wal_autocheckpoint < 0 ? -1 : min(wal_autocheckpoint, MAX_SQLITE_WAL_AUTOCHECKPOINT);
+  if (options.mmap_size != mmap_size || options.cache_size != cache_size ||
+      options.wal_autocheckpoint != wal_autocheckpoint) {
+    LOG(WARNING) << "Clamp SQLite options " << mmap_size << ' ' << cache_size << ' ' << wal_autocheckpoint << " to "
+                 << options.mmap_size << ' ' << options.cache_size << ' ' << options.wal_autocheckpoint;
+  }
+  sql_connection_->set_options(options);
+
+  // the database is opened before the options are loaded, so the main connection must be updated explicitly;
+  // connections on other schedulers are opened later with the new options
+  Scheduler::instance()->run_on_scheduler(
+      database_scheduler_id_, PromiseCreator::lambda([connection = sql_connection_](Unit) {
+        auto status = connection->apply_options(connection->get());
+        if (status.is_error()) {
+          LOG(ERROR) << "Failed to apply SQLite options: " << status;
+        }
+      }));
+}
+
 void TdDb::flush_all() {
   LOG(INFO) << "Flush all databases";
   if (message_db_async_) {
@@ -286,6 +346,11 @@ void TdDb::do_close(Promise<> on_finished, bool destroy_flag) {
       }));
   auto lock = mpas.get_promise();
 
+  if (sqlite_checkpointer_) {
+    sqlite_checkpointer_->close(mpas.get_promise());
+    sqlite_checkpointer_.reset();
+  }
+
   if (file_db_) {
     file_db_->close(mpas.get_promise());
     file_db_.reset();
@@ -357,10 +422,15 @@ Status TdDb::init_sqlite(const Parameters &parameters, const DbKey &key, const D
 
   TRY_RESULT(db_instance, SqliteDb::change_key(sql_database_path, true, key, old_key));
   sql_connection_ = std::make_shared<SqliteConnectionSafe>(sql_database_path, key, db_instance.get_cipher_version());
+  SqliteConnectionSafe::Options options;
+  options.use_background_checkpoint = true;
+  sql_connection_->set_options(options);
   sql_connection_->set(std::move(db_instance));
+  database_scheduler_id_ = Scheduler::instance()->sched_id();
   auto &db = sql_connection_->get();
   TRY_STATUS(db.exec("PRAGMA journal_mode=WAL"));
   TRY_STATUS(db.exec("PRAGMA secure_delete=1"));
+  TRY_STATUS(sql_connection_->apply_options(db));
 
   // Init databases
   // Do initialization once and before everything else to avoid "database is locked" error.
@@ -449,7 +519,7 @@ Status TdDb::init_sqlite(const Parameters &parameters, const DbKey &key, const D
 
   if (use_dialog_db) {
     dialog_db_sync_safe_ = create_dialog_db_sync(sql_connection_);
-    dialog_db_async_ = create_dialog_db_async(dialog_db_sync_safe_);
+    dialog_db_async_ = create_dialog_db_async(dialog_db_sync_safe_, -1, get_sqlite_reader_scheduler_ids());
   }
 
   if (use_message_thread_db) {
@@ -459,14 +529,16 @@ Status TdDb::init_sqlite(const Parameters &parameters, const DbKey &key, const D
 
   if (use_message_database) {
     message_db_sync_safe_ = create_message_db_sync(sql_connection_);
-    message_db_async_ = create_message_db_async(message_db_sync_safe_);
+    message_db_async_ = create_message_db_async(message_db_sync_safe_, -1, get_sqlite_reader_scheduler_ids());
   }
 
   if (use_story_database) {
     story_db_sync_safe_ = create_story_db_sync(sql_connection_);
-    story_db_async_ = create_story_db_async(story_db_sync_safe_);
+    story_db_async_ = create_story_db_async(story_db_sync_safe_, -1, get_sqlite_reader_scheduler_ids());
   }
 
+  sqlite_checkpointer_ = td::make_unique<SqliteCheckpointer>(sql_connection_, get_sqlite_checkpoint_scheduler_id());
+
   return Status::OK();
 }
 
@@ -723,7 +795,27 @@ Result<string> TdDb::get_stats() {
   }
   sb << "Max file database depth out of " << prev.size() << '/' << count
      << " elements: " << *std::max_element(prev.begin(), prev.end()) << "\n";
-  sb << "Have " << bad_count << " forward references with maximum reference to " << max_bad_to;
+  sb << "Have " << bad_count << " forward references with maximum reference to " << max_bad_to << "\n";
+  sb << binlog_->get_sync_statistics() << '\n';
+  sb << sql.get_statement_cache_statistics() << '\n';
+  if (sqlite_checkpointer_ != nullptr) {
+    sb << sqlite_checkpointer_->get_statistics() << '\n';
+  }
+  if (common_kv_async_ != nullptr) {
+    sb << "common: " << common_kv_async_->get_write_statistics() << '\n';
+  }
+  if (message_db_async_ != nullptr) {
+    sb << "messages: " << message_db_async_->get_write_statistics() << '\n';
+  }
+  if (message_thread_db_async_ != nullptr) {
+    sb << "message threads: " << message_thread_db_async_->get_write_statistics() << '\n';
+  }
+  if (dialog_db_async_ != nullptr) {
+    sb << "dialogs: " << dialog_db_async_->get_write_statistics() << '\n';
+  }
+  if (story_db_async_ != nullptr) {
+    sb << "stories: " << story_db_async_->get_write_statistics() << '\n';
+  }
 
   return sb.as_cslice().str();
 }
@@ -34,6 +34,7 @@ class MessageDbAsyncInterface;
 class MessageThreadDbSyncInterface;
 class MessageThreadDbSyncSafeInterface;
 class MessageThreadDbAsyncInterface;
+class SqliteCheckpointer;
 class SqliteConnectionSafe;
 class SqliteKeyValueSafe;
 class SqliteKeyValueAsyncInterface;
@@ -132,6 +133,10 @@ class TdDb {
 
   void flush_all();
 
+  void set_binlog_group_commit_delay(double delay);
+
+  void set_sqlite_options(int64 mmap_size, int64 cache_size, int32 wal_autocheckpoint);
+
   void close_all(Promise<> on_finished);
   void close_and_destroy_all(Promise<> on_finished);
 
@@ -159,6 +164,8 @@ class TdDb {
   bool was_dialog_db_created_ = false;
 
   std::shared_ptr<SqliteConnectionSafe> sql_connection_;
+  int32 database_scheduler_id_ = 0;
+  unique_ptr<SqliteCheckpointer> sqlite_checkpointer_;
 
   std::shared_ptr<FileDbInterface> file_db_;
 
@@ -15,6 +15,7 @@
 #include "td/utils/misc.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Time.h"
+#include "td/utils/Tracer.h"
 
 #include <algorithm>
 
@@ -25,6 +26,9 @@ int VERBOSITY_NAME(net_query) = VERBOSITY_NAME(INFO);
 void NetQuery::debug(string state, bool may_be_lost) {
   may_be_lost_ = may_be_lost;
   VLOG(net_query) << *this << " " << tag("state", state);
+  if (unlikely(is_traced_)) {
+    Tracer::async_instant("net_query", state, id_);
+  }
   {
     auto guard = lock();
     auto &data = get_data_unsafe();
@@ -56,6 +60,10 @@ NetQuery::NetQuery(State state, uint64 id, BufferSlice &&query, BufferSlice &&an
   data.my_id_ = G()->get_option_integer("my_id");
   data.start_timestamp_ = data.state_timestamp_ = Time::now();
   LOG(INFO) << *this;
+  if (unlikely(Tracer::is_enabled())) {
+    is_traced_ = true;
+    Tracer::async_begin("net_query", get_trace_name(), id_);
+  }
   if (stats) {
     nq_counter_ = stats->register_query(this);
   }
@@ -75,6 +83,14 @@ void NetQuery::on_net_read(size_t size) {
   }
 }
 
+string NetQuery::get_trace_name() const {
+  return PSTRING() << "query " << format::as_hex(tl_constructor_);
+}
+
+void NetQuery::finish_trace() {
+  Tracer::async_end("net_query", get_trace_name(), id_);
+}
+
 int32 NetQuery::tl_magic(const BufferSlice &buffer_slice) {
   auto slice = buffer_slice.as_slice();
   if (slice.size() < 4) {
@@ -224,6 +224,9 @@ class NetQuery final : public TsListNode<NetQueryDebug> {
       LOG(ERROR) << "Destroy not ready query " << *this << " " << tag("state", get_data_unsafe().state_);
     }
     // TODO: CHECK if net_query is lost here
+    if (unlikely(is_traced_)) {
+      finish_trace();
+    }
     cancel_slot_.close();
     *this = NetQuery();
   }
@@ -297,6 +300,7 @@ class NetQuery final : public TsListNode<NetQueryDebug> {
 
   bool in_sequence_dispacher_ = false;
   bool may_be_lost_ = false;
+  bool is_traced_ = false;
   int8 priority_{0};
 
   template <class T>
@@ -331,6 +335,10 @@ class NetQuery final : public TsListNode<NetQueryDebug> {
 
   static int32 tl_magic(const BufferSlice &buffer_slice);
 
+  string get_trace_name() const;
+
+  void finish_trace();
+
  public:
   int32 next_timeout_ = 1;          // for NetQueryDelayer
   int32 total_timeout_ = 0;         // for NetQueryDelayer/SequenceDispatcher
@@ -13,6 +13,7 @@
 #include "td/utils/format.h"
 #include "td/utils/JsonBuilder.h"
 #include "td/utils/misc.h"
+#include "td/utils/Parser.h"
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
@@ -150,6 +151,28 @@ Status from_json(std::vector<T> &to, JsonValue from) {
   return Status::OK();
 }
 
+// returns false if the field has already been parsed; repeated fields of TL objects are ignored, so the first value
+// wins as with get_json_object_field
+inline bool try_mark_json_field_parsed(uint64 &parsed_fields, int32 field_index) {
+  auto mask = static_cast<uint64>(1) << field_index;
+  if ((parsed_fields & mask) != 0) {
+    return false;
+  }
+  parsed_fields |= mask;
+  return true;
+}
+
+template <class T>
+Result<int32> tl_constructor_from_json(T *object, const JsonValue &constructor_value) {
+  if (constructor_value.type() == JsonValue::Type::Number) {
+    return to_integer<int32>(constructor_value.get_number());
+  }
+  if (constructor_value.type() == JsonValue::Type::String) {
+    return tl_constructor_from_string(object, constructor_value.get_string());
+  }
+  return Status::Error(PSLICE() << "Expected String or Integer, but receive " << constructor_value.type());
+}
+
 template <class T>
 std::enable_if_t<!std::is_constructible<T>::value, Status> from_json(tl_object_ptr<T> &to, JsonValue from) {
   if (from.type() != JsonValue::Type::Object) {
@@ -162,14 +185,7 @@ std::enable_if_t<!std::is_constructible<T>::value, Status> from_json(tl_object_p
 
   auto &object = from.get_object();
   TRY_RESULT(constructor_value, get_json_object_field(object, "@type", JsonValue::Type::Null, false));
-  int32 constructor = 0;
-  if (constructor_value.type() == JsonValue::Type::Number) {
-    constructor = to_integer<int32>(constructor_value.get_number());
-  } else if (constructor_value.type() == JsonValue::Type::String) {
-    TRY_RESULT_ASSIGN(constructor, tl_constructor_from_string(to.get(), constructor_value.get_string().str()));
-  } else {
-    return Status::Error(PSLICE() << "Expected String or Integer, but receive " << constructor_value.type());
-  }
+  TRY_RESULT(constructor, tl_constructor_from_json(to.get(), constructor_value));
 
   TlDowncastHelper<T> helper(constructor);
   Status status;
@@ -199,4 +215,192 @@ std::enable_if_t<std::is_constructible<T>::value, Status> from_json(tl_object_pt
   return from_json(*to, from.get_object());
 }
 
+// Decoding of TL objects directly from JSON text without creation of intermediate JsonValue. On success, the result
+// is the same as after decoding of the text with do_json_decode and from_json, but returned errors can differ.
+// Objects, which don't start with the field "@type", are decoded through JsonValue.
+
+template <class T>
+std::enable_if_t<!std::is_constructible<T>::value, Status> from_json(tl_object_ptr<T> &to, Parser &parser,
+                                                                     int32 max_depth);
+
+template <class T>
+std::enable_if_t<std::is_constructible<T>::value, Status> from_json(tl_object_ptr<T> &to, Parser &parser,
+                                                                    int32 max_depth);
+
+template <class T>
+Status from_json(T &to, Parser &parser, int32 max_depth) {
+  TRY_RESULT(value, do_json_decode(parser, max_depth));
+  return from_json(to, std::move(value));
+}
+
+inline Status from_json_bytes(string &to, Parser &parser, int32 max_depth) {
+  TRY_RESULT(value, do_json_decode(parser, max_depth));
+  return from_json_bytes(to, std::move(value));
+}
+
+template <class T>
+Status from_json(std::vector<T> &to, Parser &parser, int32 max_depth) {
+  parser.skip_whitespaces();
+  if (max_depth < 0 || parser.peek_char() != '[') {
+    TRY_RESULT(value, do_json_decode(parser, max_depth));
+    return from_json(to, std::move(value));
+  }
+  parser.skip('[');
+  parser.skip_whitespaces();
+  std::vector<T> result;
+  if (!parser.try_skip(']')) {
+    while (true) {
+      if (parser.empty()) {
+        return Status::Error("Unexpected string end");
+      }
+      result.emplace_back();
+      TRY_STATUS(from_json(result.back(), parser, max_depth - 1));
+
+      parser.skip_whitespaces();
+      if (parser.try_skip(']')) {
+        break;
+      }
+      if (!parser.try_skip(',')) {
+        return Status::Error("Unexpected symbol while parsing JSON Array");
+      }
+      parser.skip_whitespaces();
+    }
+  }
+  to = std::move(result);
+  return Status::OK();
+}
+
+inline Status skip_json_field(Slice field_name, Parser &parser, int32 max_depth) {
+  auto r_value = do_json_decode(parser, max_depth);
+  if (r_value.is_error()) {
+    return r_value.move_as_error();
+  }
+  return Status::OK();
+}
+
+// parses the remaining fields of a JSON object after its opening brace or after value of an already parsed field
+template <class T, class F>
+Status from_json_fields(T &to, Parser &parser, int32 max_depth, bool has_parsed_fields, F &&parse_unknown_field) {
+  parser.skip_whitespaces();
+  if (parser.try_skip('}')) {
+    return Status::OK();
+  }
+  if (has_parsed_fields) {
+    if (!parser.try_skip(',')) {
+      return Status::Error("Unexpected symbol while parsing JSON Object");
+    }
+    parser.skip_whitespaces();
+  }
+  uint64 parsed_fields = 0;
+  while (true) {
+    if (parser.empty()) {
+      return Status::Error("Unexpected string end");
+    }
+    TRY_RESULT(field_name, json_string_decode(parser));
+    parser.skip_whitespaces();
+    if (!parser.try_skip(':')) {
+      return Status::Error("':' expected");
+    }
+    TRY_RESULT(is_parsed_field, from_json_field(to, field_name, parser, max_depth - 1, parsed_fields));
+    if (!is_parsed_field) {
+      TRY_STATUS(parse_unknown_field(field_name, parser, max_depth - 1));
+    }
+
+    parser.skip_whitespaces();
+    if (parser.try_skip('}')) {
+      return Status::OK();
+    }
+    if (!parser.try_skip(',')) {
+      return Status::Error("Unexpected symbol while parsing JSON Object");
+    }
+    parser.skip_whitespaces();
+  }
+}
+
+// skips the beginning of a JSON object till value of its first field "@type"; returns false and skips nothing
+// if the next value isn't an object or doesn't start with the field
+inline bool try_skip_json_object_type_field_name(Parser &parser) {
+  Parser object_parser(parser.data());
+  object_parser.skip_whitespaces();
+  if (!object_parser.try_skip('{')) {
+    return false;
+  }
+  object_parser.skip_whitespaces();
+  if (!object_parser.try_skip("\"@type\"")) {
+    return false;
+  }
+  object_parser.skip_whitespaces();
+  if (!object_parser.try_skip(':')) {
+    return false;
+  }
+  parser = std::move(object_parser);
+  return true;
+}
+
+inline bool is_typed_json_object(MutableSlice json) {
+  Parser parser(json);
+  return try_skip_json_object_type_field_name(parser);
+}
+
+// parses a JSON object after name of its first field "@type"
+template <class T, class F>
+Status from_json_typed_object(tl_object_ptr<T> &to, Parser &parser, int32 max_depth, F &&parse_unknown_field) {
+  TRY_RESULT(constructor_value, do_json_decode(parser, max_depth - 1));
+  TRY_RESULT(constructor, tl_constructor_from_json(to.get(), constructor_value));
+
+  TlDowncastHelper<T> helper(constructor);
+  Status status;
+  bool ok = downcast_call(static_cast<T &>(helper), [&](auto &dummy) {
+    auto result = make_tl_object<std::decay_t<decltype(dummy)>>();
+    status = from_json_fields(*result, parser, max_depth, true, parse_unknown_field);
+    to = std::move(result);
+  });
+  TRY_STATUS(std::move(status));
+  if (!ok) {
+    return Status::Error(PSLICE() << "Unknown constructor " << format::as_hex(constructor));
+  }
+
+  return Status::OK();
+}
+
+template <class T>
+std::enable_if_t<!std::is_constructible<T>::value, Status> from_json(tl_object_ptr<T> &to, Parser &parser,
+                                                                     int32 max_depth) {
+  if (max_depth < 0 || !try_skip_json_object_type_field_name(parser)) {
+    TRY_RESULT(value, do_json_decode(parser, max_depth));
+    return from_json(to, std::move(value));
+  }
+  return from_json_typed_object(to, parser, max_depth, skip_json_field);
+}
+
+template <class T>
+std::enable_if_t<std::is_constructible<T>::value, Status> from_json(tl_object_ptr<T> &to, Parser &parser,
+                                                                    int32 max_depth) {
+  parser.skip_whitespaces();
+  if (max_depth < 0 || parser.peek_char() != '{') {
+    TRY_RESULT(value, do_json_decode(parser, max_depth));
+    return from_json(to, std::move(value));
+  }
+  parser.skip('{');
+  to = make_tl_object<T>();
+  return from_json_fields(*to, parser, max_depth, false, skip_json_field);
+}
+
+// decodes a TL object from the whole JSON text; unknown and repeated fields of the top-level object are passed to
+// parse_unknown_field; objects, which don't start with the field "@type", aren't supported at the top level
+template <class T, class F>
+Status from_json(tl_object_ptr<T> &to, MutableSlice json, F &&parse_unknown_field) {
+  Parser parser(json);
+  const int32 DEFAULT_MAX_DEPTH = 100;
+  if (!try_skip_json_object_type_field_name(parser)) {
+    return Status::Error("Expected Object with the first field \"@type\"");
+  }
+  TRY_STATUS(from_json_typed_object(to, parser, DEFAULT_MAX_DEPTH, parse_unknown_field));
+  parser.skip_whitespaces();
+  if (!parser.empty()) {
+    return Status::Error("Expected string end");
+  }
+  return Status::OK();
+}
+
 }  // namespace td
@@ -78,6 +78,51 @@ thread::id ConcurrentScheduler::get_scheduler_thread_id(int32 sched_id) {
 }
 #endif
 
+void ConcurrentScheduler::enable_work_stealing() {
+  CHECK(state_ == State::Start);
+  if (work_stealing_context_ != nullptr) {
+    return;
+  }
+  // the extra scheduler isn't run in its own thread, so it can't steal work
+  auto sched_count = static_cast<int32>(schedulers_.size()) - extra_scheduler_;
+  if (sched_count < 2) {
+    return;
+  }
+  work_stealing_context_ = std::make_shared<WorkStealingContext>(sched_count);
+  for (int32 i = 0; i < sched_count; i++) {
+    schedulers_[i]->set_work_stealing_context(work_stealing_context_);
+  }
+}
+
+uint64 ConcurrentScheduler::get_stolen_actor_count() const {
+  if (work_stealing_context_ == nullptr) {
+    return 0;
+  }
+  return work_stealing_context_->get_moved_actor_count();
+}
+
+OutboundEventStats ConcurrentScheduler::get_outbound_event_stats() const {
+  OutboundEventStats stats;
+  for (auto &sched : schedulers_) {
+    stats += sched->get_outbound_event_stats();
+  }
+  return stats;
+}
+
+void ConcurrentScheduler::set_timer_wheel_precision(double precision) {
+  CHECK(state_ == State::Start);
+  for (auto &sched : schedulers_) {
+    sched->set_timer_wheel_precision(precision);
+  }
+}
+
+void ConcurrentScheduler::set_busy_poll_duration(double duration) {
+  CHECK(state_ == State::Start);
+  for (auto &sched : schedulers_) {
+    sched->set_busy_poll_duration(duration);
+  }
+}
+
 void ConcurrentScheduler::start() {
   CHECK(state_ == State::Start);
   is_finished_.store(false, std::memory_order_relaxed);
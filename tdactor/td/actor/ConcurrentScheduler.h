@@ -19,6 +19,7 @@
 
 #include <atomic>
 #include <functional>
+#include <memory>
 #include <mutex>
 #include <utility>
 
@@ -58,6 +59,22 @@ class ConcurrentScheduler final : private Scheduler::Callback {
   thread::id get_scheduler_thread_id(int32 sched_id);
 #endif
 
+  // allows idle schedulers to execute ready migratable actors of busy schedulers; must be called before start()
+  void enable_work_stealing();
+
+  // returns the number of actors moved from busy schedulers to idle ones
+  uint64 get_stolen_actor_count() const;
+
+  // returns statistics of events sent between schedulers
+  OutboundEventStats get_outbound_event_stats() const;
+
+  // stores actor timeouts of all schedulers in timer wheels with the given precision; must be called before start()
+  void set_timer_wheel_precision(double precision);
+
+  // makes all schedulers spin for at most the given duration before blocking, if they recently received events
+  // from other schedulers; must be called before start()
+  void set_busy_poll_duration(double duration);
+
   void start();
 
   bool run_main(double timeout) {
@@ -97,6 +114,7 @@ class ConcurrentScheduler final : private Scheduler::Callback {
   std::mutex at_finish_mutex_;
   vector<std::function<void()>> at_finish_;  // can be used during destruction by Scheduler destructors
   vector<unique_ptr<Scheduler>> schedulers_;
+  std::shared_ptr<WorkStealingContext> work_stealing_context_;
   std::atomic<bool> is_finished_{false};
 #if !TD_THREAD_UNSUPPORTED && !TD_EVENTFD_UNSUPPORTED
   vector<td::thread> threads_;
@@ -0,0 +1,227 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/config.h"
+
+// Optional C++20 coroutine support. It is available only if TDLib was configured with TD_ENABLE_COROUTINES,
+// which compiles the whole project as C++20; TD_HAVE_ACTOR_COROUTINES is defined to 1 in this case.
+//
+// Task<T> is a lazily started coroutine, which returns Result<T> via co_return. It can be started with a Promise<T>,
+// which will receive the result, or awaited from another coroutine.
+// co_await wait_promise<T>(function) passes a Promise<T> to the function, suspends the coroutine until the promise
+// is set and returns Result<T>. co_await co_send_closure(actor_id, &ActorT::func, args...) does the same for
+// a member function, which accepts Promise<T> as its last parameter.
+// Suspended coroutines are resumed on the actor, which was running when they were suspended. If the actor is closed
+// before that, the coroutine is destroyed without resumption.
+
+#if TD_HAVE_COROUTINES && defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && defined(__has_include)
+#if __has_include(<coroutine>)
+#define TD_HAVE_ACTOR_COROUTINES 1
+#endif
+#endif
+
+#if TD_HAVE_ACTOR_COROUTINES
+
+#include "td/actor/actor.h"
+
+#include "td/utils/common.h"
+#include "td/utils/Promise.h"
+#include "td/utils/Status.h"
+
+#include <atomic>
+#include <coroutine>
+#include <exception>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace td {
+namespace detail {
+
+// resumes a suspended coroutine; destroys it instead if the resumption event is dropped
+class CoroutineResumer {
+ public:
+  explicit CoroutineResumer(std::coroutine_handle<> handle) : handle_(handle) {
+  }
+  CoroutineResumer(const CoroutineResumer &) = delete;
+  CoroutineResumer &operator=(const CoroutineResumer &) = delete;
+  CoroutineResumer(CoroutineResumer &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {
+  }
+  CoroutineResumer &operator=(CoroutineResumer &&) = delete;
+  ~CoroutineResumer() {
+    if (handle_) {
+      handle_.destroy();
+    }
+  }
+
+  void operator()() {
+    std::exchange(handle_, nullptr).resume();
+  }
+
+ private:
+  std::coroutine_handle<> handle_;
+};
+
+template <class T, class FunctionT>
+class PromiseAwaiter {
+ public:
+  explicit PromiseAwaiter(FunctionT &&function) : function_(std::move(function)) {
+  }
+
+  bool await_ready() const noexcept {
+    return false;
+  }
+
+  bool await_suspend(std::coroutine_handle<> handle) {
+    handle_ = handle;
+    auto scheduler = Scheduler::instance();
+    if (scheduler != nullptr) {
+      actor_id_ = scheduler->get_current_actor_id();
+    }
+    function_(Promise<T>([this](Result<T> result) {
+      result_ = std::move(result);
+      if (state_.exchange(State::Ready, std::memory_order_acq_rel) == State::Suspended) {
+        resume();
+      }
+    }));
+
+    // don't suspend if the promise has already been set
+    auto state = State::Waiting;
+    return state_.compare_exchange_strong(state, State::Suspended, std::memory_order_acq_rel);
+  }
+
+  Result<T> await_resume() {
+    return std::move(result_);
+  }
+
+ private:
+  enum class State : int32 { Waiting, Suspended, Ready };
+
+  FunctionT function_;
+  Result<T> result_;
+  ActorId<> actor_id_;
+  std::coroutine_handle<> handle_;
+  std::atomic<State> state_{State::Waiting};
+
+  void resume() {
+    if (actor_id_.empty()) {
+      return handle_.resume();
+    }
+    send_lambda(actor_id_, CoroutineResumer(handle_));
+  }
+};
+
+template <class T>
+struct PromiseValue;
+
+template <class T>
+struct PromiseValue<Promise<T>> {
+  using type = T;
+};
+
+template <class FunctionT>
+struct ClosurePromiseValue;
+
+template <class ActorT, class ResultT, class... ArgsT>
+struct ClosurePromiseValue<ResultT (ActorT::*)(ArgsT...)> {
+  static_assert(sizeof...(ArgsT) > 0, "The last parameter must be a Promise");
+  using type =
+      typename PromiseValue<std::decay_t<std::tuple_element_t<sizeof...(ArgsT) - 1, std::tuple<ArgsT...>>>>::type;
+};
+
+}  // namespace detail
+
+template <class T, class FunctionT>
+auto wait_promise(FunctionT &&function) {
+  return detail::PromiseAwaiter<T, std::decay_t<FunctionT>>(std::forward<FunctionT>(function));
+}
+
+template <class ActorIdT, class FunctionT, class... ArgsT>
+auto co_send_closure(ActorIdT &&actor_id, FunctionT function, ArgsT &&...args) {
+  using T = typename detail::ClosurePromiseValue<FunctionT>::type;
+  return wait_promise<T>([actor_id = std::forward<ActorIdT>(actor_id), function,
+                          ... args = std::forward<ArgsT>(args)](Promise<T> &&promise) mutable {
+    send_closure(std::move(actor_id), function, std::move(args)..., std::move(promise));
+  });
+}
+
+template <class T = Unit>
+class Task {
+ public:
+  class promise_type {
+   public:
+    Task get_return_object() noexcept {
+      return Task(std::coroutine_handle<promise_type>::from_promise(*this));
+    }
+
+    std::suspend_always initial_suspend() noexcept {
+      return {};
+    }
+
+    std::suspend_never final_suspend() noexcept {
+      return {};
+    }
+
+    void return_value(Result<T> &&result) {
+      promise_.set_result(std::move(result));
+    }
+
+    void unhandled_exception() noexcept {
+      std::terminate();
+    }
+
+   private:
+    Promise<T> promise_;
+
+    friend class Task;
+  };
+
+  Task(const Task &) = delete;
+  Task &operator=(const Task &) = delete;
+  Task(Task &&other) noexcept : handle_(std::exchange(other.handle_, nullptr)) {
+  }
+  Task &operator=(Task &&other) noexcept {
+    if (this != &other) {
+      reset();
+      handle_ = std::exchange(other.handle_, nullptr);
+    }
+    return *this;
+  }
+  ~Task() {
+    reset();
+  }
+
+  // runs the coroutine until its first suspension; the result will be passed to the promise
+  void start(Promise<T> promise) && {
+    CHECK(handle_);
+    auto handle = std::exchange(handle_, nullptr);
+    handle.promise().promise_ = std::move(promise);
+    handle.resume();
+  }
+
+  auto operator co_await() && {
+    return wait_promise<T>(
+        [task = std::move(*this)](Promise<T> &&promise) mutable { std::move(task).start(std::move(promise)); });
+  }
+
+ private:
+  std::coroutine_handle<promise_type> handle_;
+
+  explicit Task(std::coroutine_handle<promise_type> handle) : handle_(handle) {
+  }
+
+  void reset() {
+    if (handle_) {
+      std::exchange(handle_, nullptr).destroy();
+    }
+  }
+};
+
+}  // namespace td
+
+#endif
@@ -102,4 +102,85 @@ MultiPromiseActorSafe::~MultiPromiseActorSafe() {
   }
 }
 
+void MultiPromiseJoin::State::on_result(Result<Unit> &&result) {
+  if (result.is_error()) {
+    std::lock_guard<std::mutex> guard(mutex);
+    if (!ignore_errors && error.is_ok()) {
+      error = result.move_as_error();
+    }
+  }
+  if (pending_count.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+    return;
+  }
+
+  vector<Promise<Unit>> promises_copy;
+  Status error_copy;
+  {
+    std::lock_guard<std::mutex> guard(mutex);
+    // a new promise could have been requested after the counter had dropped to zero
+    if (is_finished || pending_count.load(std::memory_order_relaxed) != 0) {
+      return;
+    }
+    is_finished = true;
+    promises_copy = std::move(promises);
+    promises.clear();
+    error_copy = std::move(error);
+  }
+  LOG(DEBUG) << "Set result for " << promises_copy.size() << " promises in " << name;
+
+  if (error_copy.is_error()) {
+    fail_promises(promises_copy, std::move(error_copy));
+  } else {
+    set_promises(promises_copy);
+  }
+}
+
+MultiPromiseJoin::State &MultiPromiseJoin::get_state() {
+  if (state_ != nullptr) {
+    std::lock_guard<std::mutex> guard(state_->mutex);
+    if (!state_->is_finished) {
+      return *state_;
+    }
+  }
+  state_ = std::make_shared<State>();
+  state_->name = name_;
+  state_->ignore_errors = ignore_errors_;
+  return *state_;
+}
+
+void MultiPromiseJoin::add_promise(Promise<Unit> &&promise) {
+  auto &state = get_state();
+  std::lock_guard<std::mutex> guard(state.mutex);
+  state.promises.push_back(std::move(promise));
+  LOG(DEBUG) << "Add promise #" << state.promises.size() << " to " << name_;
+}
+
+Promise<Unit> MultiPromiseJoin::get_promise() {
+  auto &state = get_state();
+  {
+    std::lock_guard<std::mutex> guard(state.mutex);
+    CHECK(!state.promises.empty());
+    state.pending_count.fetch_add(1, std::memory_order_relaxed);
+  }
+  return [state = state_](Result<Unit> result) {
+    state->on_result(std::move(result));
+  };
+}
+
+void MultiPromiseJoin::set_ignore_errors(bool ignore_errors) {
+  ignore_errors_ = ignore_errors;
+  if (state_ != nullptr) {
+    std::lock_guard<std::mutex> guard(state_->mutex);
+    state_->ignore_errors = ignore_errors;
+  }
+}
+
+size_t MultiPromiseJoin::promise_count() const {
+  if (state_ == nullptr) {
+    return 0;
+  }
+  std::lock_guard<std::mutex> guard(state_->mutex);
+  return state_->is_finished ? 0 : state_->promises.size();
+}
+
 }  // namespace td
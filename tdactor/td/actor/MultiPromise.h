@@ -13,6 +13,10 @@
 #include "td/utils/Promise.h"
 #include "td/utils/Status.h"
 
+#include <atomic>
+#include <memory>
+#include <mutex>
+
 namespace td {
 
 class MultiPromiseInterface {
@@ -117,4 +121,37 @@ class MultiPromiseActorSafe final : public MultiPromiseInterface {
   unique_ptr<MultiPromiseActor> multi_promise_;
 };
 
+// Lightweight replacement for MultiPromiseActorSafe, which doesn't create an actor and counts completions atomically.
+// Unlike MultiPromiseActorSafe, the added promises are set immediately by the last completed promise returned by
+// get_promise, so the last of them (usually, a lock promise) must be set when all other work is done.
+// add_promise and get_promise must be called from a single thread, but the returned promises can be set from any thread.
+class MultiPromiseJoin final : public MultiPromiseInterface {
+ public:
+  void add_promise(Promise<Unit> &&promise) final;
+  Promise<Unit> get_promise() final;
+  void set_ignore_errors(bool ignore_errors) final;
+  size_t promise_count() const final;
+  explicit MultiPromiseJoin(const char *name) : name_(name) {
+  }
+
+ private:
+  struct State {
+    const char *name = nullptr;
+    std::atomic<size_t> pending_count{0};
+    std::mutex mutex;
+    vector<Promise<Unit>> promises;
+    Status error;
+    bool ignore_errors = false;
+    bool is_finished = false;
+
+    void on_result(Result<Unit> &&result);
+  };
+
+  const char *name_;
+  std::shared_ptr<State> state_;
+  bool ignore_errors_ = false;
+
+  State &get_state();
+};
+
 }  // namespace td
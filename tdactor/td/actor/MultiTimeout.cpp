@@ -14,9 +14,33 @@ bool MultiTimeout::has_timeout(int64 key) const {
   return items_.count(Item(key)) > 0;
 }
 
+void MultiTimeout::set_timer_wheel_precision(double precision) {
+  CHECK(items_.empty());
+  timer_wheel_ = make_unique<TimerWheel>(precision);
+}
+
+void MultiTimeout::set_timer_wheel_timeout_at(Item *item, double timeout) {
+  TimerWheelNode *timer_wheel_node = item;
+  if (timer_wheel_node->in_timer_wheel()) {
+    timer_wheel_->fix(timeout, timer_wheel_node, Time::now());
+  } else {
+    timer_wheel_->insert(timeout, timer_wheel_node, Time::now());
+  }
+  // the actor timeout is only moved earlier; later wakeups are rescheduled in timeout_expired
+  if (!Actor::has_timeout() || timeout < timer_wheel_wakeup_at_) {
+    timer_wheel_wakeup_at_ = timeout;
+    Actor::set_timeout_at(timeout);
+  }
+}
+
 void MultiTimeout::set_timeout_at(int64 key, double timeout) {
   LOG(DEBUG) << "Set " << get_name() << " for " << key << " in " << timeout - Time::now();
   auto item = items_.emplace(key);
+  if (timer_wheel_ != nullptr) {
+    CHECK(item.second == !static_cast<const TimerWheelNode &>(*item.first).in_timer_wheel());
+    set_timer_wheel_timeout_at(const_cast<Item *>(&*item.first), timeout);
+    return;
+  }
   auto heap_node = static_cast<HeapNode *>(const_cast<Item *>(&*item.first));
   if (heap_node->in_heap()) {
     CHECK(!item.second);
@@ -37,6 +61,12 @@ void MultiTimeout::set_timeout_at(int64 key, double timeout) {
 void MultiTimeout::add_timeout_at(int64 key, double timeout) {
   LOG(DEBUG) << "Add " << get_name() << " for " << key << " in " << timeout - Time::now();
   auto item = items_.emplace(key);
+  if (timer_wheel_ != nullptr) {
+    if (item.second) {
+      set_timer_wheel_timeout_at(const_cast<Item *>(&*item.first), timeout);
+    }
+    return;
+  }
   auto heap_node = static_cast<HeapNode *>(const_cast<Item *>(&*item.first));
   if (heap_node->in_heap()) {
     CHECK(!item.second);
@@ -52,7 +82,15 @@ void MultiTimeout::add_timeout_at(int64 key, double timeout) {
 void MultiTimeout::cancel_timeout(int64 key, const char *source) {
   LOG(DEBUG) << "Cancel " << get_name() << " for " << key;
   auto item = items_.find(Item(key));
-  if (item != items_.end()) {
+  if (item != items_.end() && timer_wheel_ != nullptr) {
+    timer_wheel_->erase(const_cast<Item *>(&*item));
+    items_.erase(item);
+
+    // a spurious wakeup is cheaper than a search for the next timeout
+    if (items_.empty()) {
+      update_timeout(source);
+    }
+  } else if (item != items_.end()) {
     auto heap_node = static_cast<HeapNode *>(const_cast<Item *>(&*item));
     CHECK(heap_node->in_heap());
     bool need_update_timeout = heap_node->is_top();
@@ -68,7 +106,8 @@ void MultiTimeout::cancel_timeout(int64 key, const char *source) {
 void MultiTimeout::update_timeout(const char *source) {
   if (items_.empty()) {
     LOG(DEBUG) << "Cancel timeout of " << get_name();
-    LOG_CHECK(timeout_queue_.empty()) << get_name() << ' ' << source;
+    LOG_CHECK(timeout_queue_.empty() && (timer_wheel_ == nullptr || timer_wheel_->empty()))
+        << get_name() << ' ' << source;
     if (!Actor::has_timeout()) {
       bool has_pending_timeout = false;
       for (auto &event : get_info()->mailbox_) {
@@ -80,6 +119,10 @@ void MultiTimeout::update_timeout(const char *source) {
     } else {
       Actor::cancel_timeout();
     }
+  } else if (timer_wheel_ != nullptr) {
+    timer_wheel_wakeup_at_ = timer_wheel_->get_next_timeout();
+    LOG(DEBUG) << "Set timeout of " << get_name() << " in " << timer_wheel_wakeup_at_ - Time::now_cached();
+    Actor::set_timeout_at(timer_wheel_wakeup_at_);
   } else {
     LOG(DEBUG) << "Set timeout of " << get_name() << " in " << timeout_queue_.top_key() - Time::now_cached();
     Actor::set_timeout_at(timeout_queue_.top_key());
@@ -88,6 +131,18 @@ void MultiTimeout::update_timeout(const char *source) {
 
 vector<int64> MultiTimeout::get_expired_keys(double now) {
   vector<int64> expired_keys;
+  if (timer_wheel_ != nullptr) {
+    while (true) {
+      auto *node = timer_wheel_->pop_expired(now);
+      if (node == nullptr) {
+        break;
+      }
+      int64 key = static_cast<Item *>(node)->key;
+      items_.erase(Item(key));
+      expired_keys.push_back(key);
+    }
+    return expired_keys;
+  }
   while (!timeout_queue_.empty() && timeout_queue_.top_key() < now) {
     int64 key = static_cast<Item *>(timeout_queue_.pop())->key;
     items_.erase(Item(key));
@@ -12,6 +12,7 @@
 #include "td/utils/Heap.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Time.h"
+#include "td/utils/TimerWheel.h"
 
 #include <set>
 
@@ -19,7 +20,9 @@ namespace td {
 
 // TODO optimize
 class MultiTimeout final : public Actor {
-  struct Item final : public HeapNode {
+  struct Item final
+      : public HeapNode
+      , public TimerWheelNode {
     int64 key;
 
     explicit Item(int64 key) : key(key) {
@@ -44,6 +47,10 @@ class MultiTimeout final : public Actor {
     data_ = data;
   }
 
+  // stores timeouts in a timer wheel with the given precision instead of a heap, which is faster for a lot of
+  // frequently changed timeouts; must be called when there are no timeouts
+  void set_timer_wheel_precision(double precision);
+
   bool has_timeout(int64 key) const;
 
   void set_timeout_in(int64 key, double timeout) {
@@ -71,6 +78,11 @@ class MultiTimeout final : public Actor {
   KHeap<double> timeout_queue_;
   std::set<Item> items_;
 
+  unique_ptr<TimerWheel> timer_wheel_;
+  double timer_wheel_wakeup_at_ = 0.0;
+
+  void set_timer_wheel_timeout_at(Item *item, double timeout);
+
   void update_timeout(const char *source);
 
   void timeout_expired() final;
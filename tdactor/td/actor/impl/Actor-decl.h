@@ -74,6 +74,12 @@ class Actor : public ObserverBase {
   void migrate(int32 sched_id);
   void do_migrate(int32 sched_id);
 
+  // allows the scheduler to move the actor to an idle scheduler between events, if work stealing is enabled
+  // the actor must not depend on the thread it is run on and must not have subscribed file descriptors
+  // actors with a pending timeout are never moved
+  void set_migratable(bool is_migratable);
+  bool is_migratable() const;
+
   uint64 get_link_token();
   std::weak_ptr<ActorContext> get_context_weak_ptr() const;
   std::shared_ptr<ActorContext> set_context(std::shared_ptr<ActorContext> context);
@@ -52,7 +52,7 @@ inline void Actor::do_stop() {
   CHECK(empty());
 }
 inline bool Actor::has_timeout() const {
-  return get_info()->get_heap_node()->in_heap();
+  return get_info()->has_timeout();
 }
 inline double Actor::get_timeout() const {
   return Scheduler::instance()->get_actor_timeout(this);
@@ -72,6 +72,12 @@ inline void Actor::migrate(int32 sched_id) {
 inline void Actor::do_migrate(int32 sched_id) {
   Scheduler::instance()->do_migrate_actor(this, sched_id);
 }
+inline void Actor::set_migratable(bool is_migratable) {
+  info_->set_migratable(is_migratable);
+}
+inline bool Actor::is_migratable() const {
+  return info_->is_migratable();
+}
 
 template <class ActorType>
 std::enable_if_t<std::is_base_of<Actor, ActorType>::value> start_migrate(ActorType &obj, int32 sched_id) {
@@ -15,6 +15,7 @@
 #include "td/utils/ObjectPool.h"
 #include "td/utils/Slice.h"
 #include "td/utils/StringBuilder.h"
+#include "td/utils/TimerWheel.h"
 
 #include <atomic>
 #include <memory>
@@ -49,7 +50,8 @@ class ActorContext {
 
 class ActorInfo final
     : private ListNode
-    , private HeapNode {
+    , private HeapNode
+    , private TimerWheelNode {
  public:
   enum class Deleter : uint8 { Destroy, None };
 
@@ -95,6 +97,12 @@ class ActorInfo final
   const HeapNode *get_heap_node() const;
   static ActorInfo *from_heap_node(HeapNode *node);
 
+  TimerWheelNode *get_timer_wheel_node();
+  const TimerWheelNode *get_timer_wheel_node() const;
+  static ActorInfo *from_timer_wheel_node(TimerWheelNode *node);
+
+  bool has_timeout() const;
+
   ListNode *get_list_node();
   const ListNode *get_list_node() const;
   static ActorInfo *from_list_node(ListNode *node);
@@ -104,15 +112,20 @@ class ActorInfo final
   void finish_run();
 
   vector<Event> mailbox_;
+  bool need_mailbox_reorder_ = false;  // mailbox_ may contain events with non-default priority in wrong order
 
   bool need_context() const;
   bool need_start_up() const;
 
+  void set_migratable(bool is_migratable);
+  bool is_migratable() const;
+
  private:
   Deleter deleter_ = Deleter::None;
   bool need_context_ = true;
   bool need_start_up_ = true;
   bool is_running_ = false;
+  bool is_migratable_ = false;
 
   std::atomic<int32> sched_id_{0};
   Actor *actor_ = nullptr;
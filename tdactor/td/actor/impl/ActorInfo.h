@@ -50,6 +50,7 @@ inline void ActorInfo::init(int32 sched_id, Slice name, ObjectPool<ActorInfo>::O
   need_context_ = need_context;
   need_start_up_ = need_start_up;
   is_running_ = false;
+  is_migratable_ = false;
 }
 
 inline bool ActorInfo::need_context() const {
@@ -60,6 +61,14 @@ inline bool ActorInfo::need_start_up() const {
   return need_start_up_;
 }
 
+inline void ActorInfo::set_migratable(bool is_migratable) {
+  is_migratable_ = is_migratable;
+}
+
+inline bool ActorInfo::is_migratable() const {
+  return is_migratable_;
+}
+
 inline void ActorInfo::on_actor_moved(Actor *actor_new_ptr) {
   actor_ = actor_new_ptr;
 }
@@ -196,6 +205,18 @@ inline const HeapNode *ActorInfo::get_heap_node() const {
 inline ActorInfo *ActorInfo::from_heap_node(HeapNode *node) {
   return static_cast<ActorInfo *>(node);
 }
+inline TimerWheelNode *ActorInfo::get_timer_wheel_node() {
+  return this;
+}
+inline const TimerWheelNode *ActorInfo::get_timer_wheel_node() const {
+  return this;
+}
+inline ActorInfo *ActorInfo::from_timer_wheel_node(TimerWheelNode *node) {
+  return static_cast<ActorInfo *>(node);
+}
+inline bool ActorInfo::has_timeout() const {
+  return get_heap_node()->in_heap() || get_timer_wheel_node()->in_timer_wheel();
+}
 inline ListNode *ActorInfo::get_list_node() {
   return this;
 }
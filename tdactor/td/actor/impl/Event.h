@@ -10,6 +10,7 @@
 #include "td/utils/common.h"
 #include "td/utils/StringBuilder.h"
 
+#include <new>
 #include <type_traits>
 #include <utility>
 
@@ -19,7 +20,7 @@ class Actor;
 
 // Events
 //
-// Small structure (up to 16 bytes) used to send events between actors.
+// Small structure (64 bytes) used to send events between actors.
 //
 // There are some predefined types of events:
 // NoType -- unitialized event
@@ -30,6 +31,8 @@ class Actor;
 // Hangup -- hang up called
 // Raw -- just pass 8 bytes (union Raw is used for convenience)
 // Custom -- Send CustomEvent
+//
+// Small closures and lambdas are stored inside of the event itself, so sending them doesn't allocate memory.
 
 template <class T>
 std::enable_if_t<!std::is_base_of<Actor, T>::value> start_migrate(T &obj, int32 sched_id) {
@@ -48,6 +51,10 @@ class CustomEvent {
   virtual ~CustomEvent() = default;
 
   virtual void run(Actor *actor) = 0;
+  // must be overridden by events, which can be stored inline; moves the event to the storage and returns it
+  virtual CustomEvent *move_to(void *storage) {
+    return nullptr;
+  }
   virtual void start_migrate(int32 sched_id) {
   }
   virtual void finish_migrate() {
@@ -64,6 +71,10 @@ class ClosureEvent final : public CustomEvent {
   explicit ClosureEvent(ArgsT &&...args) : closure_(std::forward<ArgsT>(args)...) {
   }
 
+  CustomEvent *move_to(void *storage) final {
+    return new (storage) ClosureEvent(std::move(closure_));
+  }
+
   void start_migrate(int32 sched_id) final {
     closure_.for_each([sched_id](auto &obj) {
       using ::td::start_migrate;
@@ -92,14 +103,27 @@ class LambdaEvent final : public CustomEvent {
   explicit LambdaEvent(FromLambdaT &&lambda) : f_(std::forward<FromLambdaT>(lambda)) {
   }
 
+  CustomEvent *move_to(void *storage) final {
+    return new (storage) LambdaEvent(std::move(f_));
+  }
+
  private:
   LambdaT f_;
 };
 
+// an actor handles queued events with higher priority first;
+// events with the same priority are handled in the order in which they were sent;
+// prioritized events never overtake queued system events, for example, they are always handled after start_up
+enum class EventPriority : uint8 { High, Normal, Low };
+
 class Event {
+  static constexpr size_t MAX_INLINE_CUSTOM_EVENT_SIZE = 40;
+
  public:
   enum class Type { NoType, Start, Stop, Yield, Timeout, Hangup, Raw, Custom };
   Type type;
+  bool is_custom_event_inline = false;
+  EventPriority priority = EventPriority::Normal;
   uint64 link_token = 0;
   union Raw {
     void *ptr;
@@ -139,32 +163,41 @@ class Event {
 
   template <class FromImmediateClosureT>
   static Event immediate_closure(FromImmediateClosureT &&closure) {
-    return custom(
-        new ClosureEvent<typename FromImmediateClosureT::Delayed>(std::forward<FromImmediateClosureT>(closure)));
+    return create_custom<ClosureEvent<typename FromImmediateClosureT::Delayed>>(
+        std::forward<FromImmediateClosureT>(closure));
   }
   template <class... ArgsT>
   static Event delayed_closure(ArgsT &&...args) {
     using DelayedClosureT = decltype(create_delayed_closure(std::forward<ArgsT>(args)...));
-    return custom(new ClosureEvent<DelayedClosureT>(std::forward<ArgsT>(args)...));
+    return create_custom<ClosureEvent<DelayedClosureT>>(std::forward<ArgsT>(args)...);
   }
 
   template <class FromLambdaT>
   static Event lambda(FromLambdaT &&lambda) {
-    return custom(new LambdaEvent<std::decay_t<FromLambdaT>>(std::forward<FromLambdaT>(lambda)));
+    return create_custom<LambdaEvent<std::decay_t<FromLambdaT>>>(std::forward<FromLambdaT>(lambda));
   }
 
   Event() : Event(Type::NoType) {
   }
   Event(const Event &) = delete;
   Event &operator=(const Event &) = delete;
-  Event(Event &&other) noexcept : type(other.type), link_token(other.link_token), data(other.data) {
+  Event(Event &&other) noexcept
+      : type(other.type), priority(other.priority), link_token(other.link_token), data(other.data) {
+    if (other.is_custom_event_inline) {
+      move_inline_custom_event(other);
+    }
     other.type = Type::NoType;
   }
   Event &operator=(Event &&other) noexcept {
     destroy();
     type = other.type;
+    priority = other.priority;
     link_token = other.link_token;
     data = other.data;
+    is_custom_event_inline = false;
+    if (other.is_custom_event_inline) {
+      move_inline_custom_event(other);
+    }
     other.type = Type::NoType;
     return *this;
   }
@@ -179,6 +212,7 @@ class Event {
   void clear() {
     destroy();
     type = Type::NoType;
+    is_custom_event_inline = false;
   }
 
   Event &set_link_token(uint64 new_link_token) {
@@ -186,6 +220,11 @@ class Event {
     return *this;
   }
 
+  Event &set_priority(EventPriority new_priority) {
+    priority = new_priority;
+    return *this;
+  }
+
   friend void start_migrate(Event &obj, int32 sched_id) {
     if (obj.type == Type::Custom) {
       obj.data.custom_event->start_migrate(sched_id);
@@ -214,11 +253,49 @@ class Event {
     data.u64 = u64;
   }
 
+  template <class CustomEventT>
+  struct CanBeInline {
+    static constexpr bool value =
+        sizeof(CustomEventT) <= MAX_INLINE_CUSTOM_EVENT_SIZE && alignof(CustomEventT) <= alignof(uint64);
+  };
+
+  template <class CustomEventT, class... ArgsT>
+  static Event create_custom(ArgsT &&...args) {
+    return create_custom_impl<CustomEventT>(std::integral_constant<bool, CanBeInline<CustomEventT>::value>(),
+                                            std::forward<ArgsT>(args)...);
+  }
+
+  template <class CustomEventT, class... ArgsT>
+  static Event create_custom_impl(std::true_type, ArgsT &&...args) {
+    Event result(Type::Custom);
+    result.data.custom_event = new (result.inline_storage_) CustomEventT(std::forward<ArgsT>(args)...);
+    result.is_custom_event_inline = true;
+    return result;
+  }
+
+  template <class CustomEventT, class... ArgsT>
+  static Event create_custom_impl(std::false_type, ArgsT &&...args) {
+    return custom(new CustomEventT(std::forward<ArgsT>(args)...));
+  }
+
+  void move_inline_custom_event(Event &other) {
+    data.custom_event = other.data.custom_event->move_to(inline_storage_);
+    is_custom_event_inline = true;
+    other.data.custom_event->~CustomEvent();
+    other.is_custom_event_inline = false;
+  }
+
   void destroy() {
     if (type == Type::Custom) {
-      delete data.custom_event;
+      if (is_custom_event_inline) {
+        data.custom_event->~CustomEvent();
+      } else {
+        delete data.custom_event;
+      }
     }
   }
+
+  alignas(uint64) unsigned char inline_storage_[MAX_INLINE_CUSTOM_EVENT_SIZE];
 };
 
 inline StringBuilder &operator<<(StringBuilder &string_builder, const Event &e) {
@@ -35,6 +35,13 @@ class EventFull {
     return data_;
   }
 
+  uint64 trace_id() const {
+    return trace_id_;
+  }
+  void set_trace_id(uint64 trace_id) {
+    trace_id_ = trace_id;
+  }
+
   void try_emit_later();
   void try_emit();
 
@@ -51,6 +58,8 @@ class EventFull {
   ActorId<> actor_id_;
 
   Event data_;
+
+  uint64 trace_id_ = 0;  // identifier of the Tracer flow event if the event is sent to another scheduler
 };
 
 class EventCreator {
@@ -25,12 +25,17 @@
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Promise.h"
 #include "td/utils/Slice.h"
+#include "td/utils/StringBuilder.h"
 #include "td/utils/Time.h"
+#include "td/utils/TimerWheel.h"
 #include "td/utils/type_traits.h"
 
+#include <atomic>
+#include <forward_list>
 #include <functional>
 #include <memory>
 #include <type_traits>
+#include <unordered_map>
 #include <utility>
 
 namespace td {
@@ -41,6 +46,86 @@ class ActorInfo;
 
 enum class ActorSendType { Immediate, Later };
 
+// shared by schedulers, which are allowed to execute migratable actors of each other
+class WorkStealingContext {
+ public:
+  explicit WorkStealingContext(int32 sched_count);
+
+  int32 sched_count() const {
+    return sched_count_;
+  }
+
+  void set_idle(int32 sched_id, bool is_idle);
+
+  bool has_idle_scheduler() const {
+    return idle_count_.load(std::memory_order_relaxed) > 0;
+  }
+
+  // returns identifier of an idle scheduler, which agreed to receive actors from the scheduler sched_id, or -1
+  int32 acquire_idle_scheduler(int32 sched_id);
+
+  void on_actors_moved(size_t actor_count);
+
+  uint64 get_moved_actor_count() const {
+    return moved_actor_count_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  int32 sched_count_ = 0;
+  std::atomic<int32> idle_count_{0};
+  vector<std::atomic<bool>> is_idle_;
+  std::atomic<uint64> moved_actor_count_{0};
+};
+
+// statistics of events sent to other schedulers, which are buffered and flushed in batches
+struct OutboundEventStats {
+  uint64 event_count = 0;
+  uint64 flush_count = 0;
+  // number of batches, which had to wake up the receiving scheduler
+  uint64 wakeup_count = 0;
+
+  double get_events_per_flush() const {
+    return flush_count == 0 ? 0.0 : static_cast<double>(event_count) / static_cast<double>(flush_count);
+  }
+
+  // without batching every event could require a separate wakeup
+  uint64 get_saved_wakeup_count() const {
+    return event_count - wakeup_count;
+  }
+
+  OutboundEventStats &operator+=(const OutboundEventStats &other) {
+    event_count += other.event_count;
+    flush_count += other.flush_count;
+    wakeup_count += other.wakeup_count;
+    return *this;
+  }
+};
+
+StringBuilder &operator<<(StringBuilder &string_builder, const OutboundEventStats &stats);
+
+// runtime statistics of all actors with the same name
+struct ActorProfile {
+  uint64 event_count = 0;
+  // time spent in event handlers of the actors, excluding nested handlers of other actors
+  double total_time = 0.0;
+  // maximum time of one mailbox flush, which can handle several events
+  double max_flush_time = 0.0;
+  size_t max_mailbox_size = 0;
+};
+
+// runtime statistics of a scheduler since profiling was enabled
+struct SchedulerProfile {
+  int32 sched_id = 0;
+  double duration = 0.0;
+  double busy_time = 0.0;
+  double idle_time = 0.0;
+  uint64 poll_wakeup_count = 0;
+  // sorted by total_time in decreasing order
+  vector<std::pair<string, ActorProfile>> actor_profiles;
+};
+
+StringBuilder &operator<<(StringBuilder &string_builder, const SchedulerProfile &profile);
+
 class Scheduler;
 class SchedulerGuard {
  public:
@@ -80,6 +165,17 @@ class Scheduler {
 
   void init(int32 id, std::vector<std::shared_ptr<MpscPollableQueue<EventFull>>> outbound, Callback *callback);
 
+  // must be called before the scheduler is run; sched_id must be less than context->sched_count()
+  void set_work_stealing_context(std::shared_ptr<WorkStealingContext> context);
+
+  // stores actor timeouts in a timer wheel with the given precision instead of a heap;
+  // must be called when there are no actor timeouts
+  void set_timer_wheel_precision(double precision);
+
+  // before blocking in poll, spins for at most the given duration waiting for events from other schedulers,
+  // if such events were received recently; 0 disables spinning
+  void set_busy_poll_duration(double duration);
+
   int32 sched_id() const;
   int32 sched_count() const;
 
@@ -110,7 +206,7 @@ class Scheduler {
   void send_lambda(ActorRef actor_ref, EventT &&lambda);
 
   template <ActorSendType send_type, class EventT>
-  void send_closure(ActorRef actor_ref, EventT &&closure);
+  void send_closure(ActorRef actor_ref, EventT &&closure, EventPriority priority = EventPriority::Normal);
 
   template <ActorSendType send_type>
   void send(ActorRef actor_ref, Event &&event);
@@ -125,6 +221,8 @@ class Scheduler {
   void stop_actor(Actor *actor);
   void do_stop_actor(Actor *actor);
   uint64 get_link_token(Actor *actor);
+  // returns the actor, which is currently processing an event on the scheduler, or an empty ActorId
+  ActorId<> get_current_actor_id() const;
   void migrate_actor(Actor *actor, int32 dest_sched_id);
   void do_migrate_actor(Actor *actor, int32 dest_sched_id);
   void start_migrate_actor(Actor *actor, int32 dest_sched_id);
@@ -151,6 +249,17 @@ class Scheduler {
 
   Timestamp get_timeout();
 
+  // can be called from any thread
+  OutboundEventStats get_outbound_event_stats() const;
+
+  // enables or disables collection of runtime statistics by all schedulers; can be called from any thread
+  static void set_profiling_enabled(bool is_enabled);
+
+  static bool is_profiling_enabled();
+
+  // returns statistics published by all schedulers with enabled profiling; they are updated once in a second
+  static vector<SchedulerProfile> get_profiles();
+
  private:
   static void set_scheduler(Scheduler *scheduler);
 
@@ -200,10 +309,45 @@ class Scheduler {
   template <ActorSendType send_type, class RunFuncT, class EventFuncT>
   void send_impl(const ActorId<> &actor_id, const RunFuncT &run_func, const EventFuncT &event_func);
 
+  void flush_outbound_events();
+
+  struct Profiler {
+    static constexpr double PUBLISH_PERIOD = 1.0;
+    static constexpr double LOG_PERIOD = 60.0;
+    static constexpr size_t MAX_LOGGED_ACTOR_COUNT = 10;
+
+    // actor_profiles are keyed by interned actor names, so no memory is allocated for a known name
+    std::forward_list<string> actor_names;
+    std::unordered_map<Slice, ActorProfile, SliceHash> actor_profiles;
+    double start_time = 0.0;
+    double busy_time = 0.0;
+    double idle_time = 0.0;
+    uint64 poll_wakeup_count = 0;
+
+    // start time of the not yet accounted part of the current run_events call
+    double busy_start_time = 0.0;
+
+    // total time of the finished handlers nested into the current one
+    double nested_time = 0.0;
+
+    double next_publish_time = 0.0;
+    double next_log_time = 0.0;
+  };
+
+  void update_profiler();
+  void publish_profile(bool need_log);
+  void unpublish_profile();
+  void on_event_guard_finished(ActorInfo *actor_info, size_t event_count, size_t mailbox_size, double start_time,
+                               double save_nested_time);
+
   Timestamp run_timeout();
   void run_mailbox();
   Timestamp run_events(Timestamp timeout);
   void run_poll(Timestamp timeout);
+  bool busy_poll(Timestamp timeout);
+
+  void share_work();
+  bool is_shareable_actor(ActorInfo *actor_info) const;
 
   template <class ActorT>
   ActorOwn<ActorT> register_actor_impl(Slice name, ActorT *actor_ptr, Actor::Deleter deleter, int32 sched_id);
@@ -219,6 +363,7 @@ class Scheduler {
   ListNode pending_actors_list_;
   ListNode ready_actors_list_;
   KHeap<double> timeout_queue_;
+  unique_ptr<TimerWheel> timer_wheel_;
 
   FlatHashMap<ActorInfo *, std::vector<Event>> pending_events_;
 
@@ -233,9 +378,27 @@ class Scheduler {
   int32 sched_n_ = 0;
   std::shared_ptr<MpscPollableQueue<EventFull>> inbound_queue_;
   std::vector<std::shared_ptr<MpscPollableQueue<EventFull>>> outbound_queues_;
+  // events for other schedulers, sent while running events; flushed after each run_mailbox iteration
+  std::vector<std::vector<EventFull>> outbound_events_;
+  // schedulers with pending outbound events in the order of the first event sent to them
+  std::vector<int32> outbound_event_sched_ids_;
+  bool is_outbound_event_batching_enabled_ = false;
+  std::atomic<uint64> outbound_event_count_{0};
+  std::atomic<uint64> outbound_flush_count_{0};
+  std::atomic<uint64> outbound_wakeup_count_{0};
+  double busy_poll_duration_ = 0.0;
+
+  static std::atomic<bool> is_profiling_enabled_;
+  // non-null only while profiling is enabled
+  unique_ptr<Profiler> profiler_;
+
+  double inbound_queue_busy_at_ = 0.0;
 
   std::shared_ptr<ActorContext> save_context_;
 
+  std::shared_ptr<WorkStealingContext> work_stealing_context_;
+  vector<ActorInfo *> shared_actors_;
+
   struct EventContext {
     int32 dest_sched_id{0};
     enum Flags { Stop = 1, Migrate = 2 };
@@ -284,6 +447,29 @@ void send_closure_later(ActorIdT &&actor_id, FunctionT function, ArgsT &&...args
                                                     Event::delayed_closure(function, std::forward<ArgsT>(args)...));
 }
 
+// the closure is handled before queued events with lower priority, but after queued events with the same priority
+template <class ActorIdT, class FunctionT, class... ArgsT>
+void send_closure_with_priority(ActorIdT &&actor_id, EventPriority priority, FunctionT function, ArgsT &&...args) {
+  using ActorT = typename std::decay_t<ActorIdT>::ActorT;
+  using FunctionClassT = member_function_class_t<FunctionT>;
+  static_assert(std::is_base_of<FunctionClassT, ActorT>::value, "unsafe send_closure");
+
+  Scheduler::instance()->send_closure<ActorSendType::Immediate>(
+      std::forward<ActorIdT>(actor_id), create_immediate_closure(function, std::forward<ArgsT>(args)...), priority);
+}
+
+template <class ActorIdT, class FunctionT, class... ArgsT>
+void send_closure_later_with_priority(ActorIdT &&actor_id, EventPriority priority, FunctionT function,
+                                      ArgsT &&...args) {
+  using ActorT = typename std::decay_t<ActorIdT>::ActorT;
+  using FunctionClassT = member_function_class_t<FunctionT>;
+  static_assert(std::is_base_of<FunctionClassT, ActorT>::value, "unsafe send_closure");
+
+  auto event = Event::delayed_closure(function, std::forward<ArgsT>(args)...);
+  event.set_priority(priority);
+  Scheduler::instance()->send<ActorSendType::Later>(std::forward<ActorIdT>(actor_id), std::move(event));
+}
+
 template <class... ArgsT>
 void send_lambda(ActorRef actor_ref, ArgsT &&...args) {
   Scheduler::instance()->send_lambda<ActorSendType::Immediate>(actor_ref, std::forward<ArgsT>(args)...);
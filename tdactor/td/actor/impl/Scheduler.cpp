@@ -21,11 +21,15 @@
 #include "td/utils/misc.h"
 #include "td/utils/MpscPollableQueue.h"
 #include "td/utils/ObjectPool.h"
+#include "td/utils/port/Mutex.h"
+#include "td/utils/port/thread.h"
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Promise.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/Time.h"
+#include "td/utils/Tracer.h"
 
+#include <algorithm>
 #include <functional>
 #include <memory>
 #include <utility>
@@ -83,6 +87,7 @@ void Scheduler::ServiceActor::loop() {
   if (ready_n == 0) {
     return;
   }
+  Scheduler::instance()->inbound_queue_busy_at_ = Time::now_cached();
   while (ready_n-- > 0) {
     EventFull event = queue->reader_get_unsafe();
     if (event.actor_id().empty()) {
@@ -93,8 +98,17 @@ void Scheduler::ServiceActor::loop() {
       }
     } else {
       VLOG(actor) << "Receive " << event.data();
+      if (event.trace_id() != 0) {
+        Tracer::flow_end("actor", "send", event.trace_id());
+      }
       finish_migrate(event.data());
-      event.try_emit();
+      auto actor_info = event.actor_id().get_actor_info();
+      if (actor_info != nullptr && Scheduler::instance()->is_shareable_actor(actor_info)) {
+        // the actor will wait for the event in the list of ready actors, so it can be shared with idle schedulers
+        event.try_emit_later();
+      } else {
+        event.try_emit();
+      }
     }
   }
   queue->reader_flush();
@@ -117,6 +131,184 @@ void Scheduler::ServiceActor::tear_down() {
 #endif
 }
 
+StringBuilder &operator<<(StringBuilder &string_builder, const OutboundEventStats &stats) {
+  return string_builder << "OutboundEventStats[events = " << stats.event_count << ", flushes = " << stats.flush_count
+                        << ", events per flush = " << stats.get_events_per_flush()
+                        << ", wakeups = " << stats.wakeup_count
+                        << ", saved wakeups = " << stats.get_saved_wakeup_count() << ']';
+}
+
+StringBuilder &operator<<(StringBuilder &string_builder, const SchedulerProfile &profile) {
+  auto get_percent = [duration = profile.duration](double time) {
+    return duration > 0 ? time * 100 / duration : 0.0;
+  };
+  string_builder << "Scheduler " << profile.sched_id << " in " << profile.duration << "s: busy "
+                 << get_percent(profile.busy_time) << "%, idle " << get_percent(profile.idle_time) << "%, "
+                 << profile.poll_wakeup_count << " poll wakeups";
+  for (auto &it : profile.actor_profiles) {
+    auto &actor_profile = it.second;
+    string_builder << "\n  " << it.first << ": " << actor_profile.event_count << " events, total "
+                   << actor_profile.total_time * 1e3 << "ms, max per flush "
+                   << actor_profile.max_flush_time * 1e3 << "ms, max mailbox size " << actor_profile.max_mailbox_size;
+  }
+  return string_builder;
+}
+
+namespace {
+struct PublishedSchedulerProfiles {
+  Mutex mutex;
+  FlatHashMap<const Scheduler *, SchedulerProfile> profiles;
+};
+
+PublishedSchedulerProfiles &get_published_scheduler_profiles() {
+  static PublishedSchedulerProfiles profiles;
+  return profiles;
+}
+}  // namespace
+
+std::atomic<bool> Scheduler::is_profiling_enabled_{false};
+
+void Scheduler::set_profiling_enabled(bool is_enabled) {
+  is_profiling_enabled_.store(is_enabled, std::memory_order_relaxed);
+}
+
+bool Scheduler::is_profiling_enabled() {
+  return is_profiling_enabled_.load(std::memory_order_relaxed);
+}
+
+vector<SchedulerProfile> Scheduler::get_profiles() {
+  vector<SchedulerProfile> result;
+  auto &published_profiles = get_published_scheduler_profiles();
+  {
+    auto lock = published_profiles.mutex.lock();
+    for (auto &it : published_profiles.profiles) {
+      result.push_back(it.second);
+    }
+  }
+  std::sort(result.begin(), result.end(),
+            [](const SchedulerProfile &lhs, const SchedulerProfile &rhs) { return lhs.sched_id < rhs.sched_id; });
+  return result;
+}
+
+void Scheduler::update_profiler() {
+  if (!is_profiling_enabled()) {
+    if (profiler_ != nullptr) {
+      profiler_ = nullptr;
+      unpublish_profile();
+    }
+    return;
+  }
+
+  auto now = Time::now();
+  if (profiler_ == nullptr) {
+    profiler_ = make_unique<Profiler>();
+    profiler_->start_time = now;
+    profiler_->next_publish_time = now + Profiler::PUBLISH_PERIOD;
+    profiler_->next_log_time = now + Profiler::LOG_PERIOD;
+  }
+  if (profiler_->busy_start_time == 0.0) {
+    profiler_->busy_start_time = now;
+  }
+  if (now >= profiler_->next_publish_time) {
+    // account time of the current run_events call
+    profiler_->busy_time += now - profiler_->busy_start_time;
+    profiler_->busy_start_time = now;
+    profiler_->next_publish_time = now + Profiler::PUBLISH_PERIOD;
+    bool need_log = now >= profiler_->next_log_time;
+    if (need_log) {
+      profiler_->next_log_time = now + Profiler::LOG_PERIOD;
+    }
+    publish_profile(need_log);
+  }
+}
+
+void Scheduler::publish_profile(bool need_log) {
+  CHECK(profiler_ != nullptr);
+  SchedulerProfile profile;
+  profile.sched_id = sched_id_;
+  profile.duration = Time::now() - profiler_->start_time;
+  profile.busy_time = profiler_->busy_time;
+  profile.idle_time = profiler_->idle_time;
+  profile.poll_wakeup_count = profiler_->poll_wakeup_count;
+  profile.actor_profiles.reserve(profiler_->actor_profiles.size());
+  for (auto &it : profiler_->actor_profiles) {
+    profile.actor_profiles.emplace_back(it.first.str(), it.second);
+  }
+  std::sort(profile.actor_profiles.begin(), profile.actor_profiles.end(),
+            [](const std::pair<string, ActorProfile> &lhs, const std::pair<string, ActorProfile> &rhs) {
+              return lhs.second.total_time > rhs.second.total_time;
+            });
+
+  if (need_log) {
+    auto logged_profile = profile;
+    if (logged_profile.actor_profiles.size() > Profiler::MAX_LOGGED_ACTOR_COUNT) {
+      logged_profile.actor_profiles.resize(Profiler::MAX_LOGGED_ACTOR_COUNT);
+    }
+    LOG(INFO) << logged_profile;
+  }
+
+  auto &published_profiles = get_published_scheduler_profiles();
+  auto lock = published_profiles.mutex.lock();
+  published_profiles.profiles[this] = std::move(profile);
+}
+
+void Scheduler::unpublish_profile() {
+  auto &published_profiles = get_published_scheduler_profiles();
+  auto lock = published_profiles.mutex.lock();
+  published_profiles.profiles.erase(this);
+}
+
+void Scheduler::on_event_guard_finished(ActorInfo *actor_info, size_t event_count, size_t mailbox_size,
+                                        double start_time, double save_nested_time) {
+  auto elapsed_time = Time::now() - start_time;
+  auto own_time = elapsed_time - profiler_->nested_time;
+  profiler_->nested_time = save_nested_time + elapsed_time;
+
+  auto name = actor_info->get_name();
+  auto it = profiler_->actor_profiles.find(name);
+  if (it == profiler_->actor_profiles.end()) {
+    profiler_->actor_names.push_front(name.str());
+    it = profiler_->actor_profiles.emplace(profiler_->actor_names.front(), ActorProfile()).first;
+  }
+  auto &actor_profile = it->second;
+  actor_profile.event_count += event_count;
+  actor_profile.total_time += own_time;
+  actor_profile.max_flush_time = max(actor_profile.max_flush_time, own_time);
+  actor_profile.max_mailbox_size = max(actor_profile.max_mailbox_size, mailbox_size);
+}
+
+/*** WorkStealingContext ***/
+WorkStealingContext::WorkStealingContext(int32 sched_count) : sched_count_(sched_count), is_idle_(sched_count) {
+  for (auto &is_idle : is_idle_) {
+    is_idle.store(false, std::memory_order_relaxed);
+  }
+}
+
+void WorkStealingContext::set_idle(int32 sched_id, bool is_idle) {
+  CHECK(0 <= sched_id && sched_id < sched_count_);
+  if (is_idle_[sched_id].exchange(is_idle, std::memory_order_acq_rel) != is_idle) {
+    idle_count_.fetch_add(is_idle ? 1 : -1, std::memory_order_relaxed);
+  }
+}
+
+int32 WorkStealingContext::acquire_idle_scheduler(int32 sched_id) {
+  for (int32 i = 1; i < sched_count_; i++) {
+    auto dest_sched_id = (sched_id + i) % sched_count_;
+    auto &is_idle = is_idle_[dest_sched_id];
+    bool expected = true;
+    if (is_idle.load(std::memory_order_relaxed) &&
+        is_idle.compare_exchange_strong(expected, false, std::memory_order_acq_rel)) {
+      idle_count_.fetch_sub(1, std::memory_order_relaxed);
+      return dest_sched_id;
+    }
+  }
+  return -1;
+}
+
+void WorkStealingContext::on_actors_moved(size_t actor_count) {
+  moved_actor_count_.fetch_add(actor_count, std::memory_order_relaxed);
+}
+
 /*** SchedlerGuard ***/
 SchedulerGuard::SchedulerGuard(Scheduler *scheduler, bool lock) : scheduler_(scheduler) {
   if (lock) {
@@ -158,10 +350,27 @@ EventGuard::EventGuard(Scheduler *scheduler, ActorInfo *actor_info) : scheduler_
   save_log_tag2_ = actor_info->get_name().c_str();
 #endif
   swap_context(actor_info);
+
+  if (unlikely(scheduler_->profiler_ != nullptr)) {
+    mailbox_size_ = actor_info->mailbox_.size();
+    save_nested_time_ = scheduler_->profiler_->nested_time;
+    scheduler_->profiler_->nested_time = 0.0;
+    start_time_ = Time::now();
+  }
+  if (unlikely(Tracer::is_enabled())) {
+    is_traced_ = true;
+    Tracer::begin("actor", actor_info->get_name());
+  }
 }
 
 EventGuard::~EventGuard() {
   auto info = event_context_.actor_info;
+  if (unlikely(is_traced_)) {
+    Tracer::end("actor", info->get_name());
+  }
+  if (unlikely(start_time_ != 0.0) && scheduler_->profiler_ != nullptr) {
+    scheduler_->on_event_guard_finished(info, event_count_, mailbox_size_, start_time_, save_nested_time_);
+  }
   auto node = info->get_list_node();
   node->remove();
   if (info->mailbox_.empty()) {
@@ -227,10 +436,33 @@ void Scheduler::init(int32 id, std::vector<std::shared_ptr<MpscPollableQueue<Eve
   outbound_queues_ = std::move(outbound);
   sched_id_ = id;
   sched_n_ = static_cast<int32>(outbound_queues_.size());
+  outbound_events_.resize(outbound_queues_.size());
   service_actor_.set_queue(inbound_queue_);
   register_actor("ServiceActor", &service_actor_).release();
 }
 
+void Scheduler::set_timer_wheel_precision(double precision) {
+  CHECK(timeout_queue_.empty());
+  CHECK(timer_wheel_ == nullptr || timer_wheel_->empty());
+  timer_wheel_ = make_unique<TimerWheel>(precision);
+}
+
+void Scheduler::set_busy_poll_duration(double duration) {
+  CHECK(duration >= 0);
+#if !TD_THREAD_UNSUPPORTED
+  if (thread::hardware_concurrency() == 1) {
+    // spinning on the only CPU would just delay the thread, which sends the events
+    duration = 0.0;
+  }
+#endif
+  busy_poll_duration_ = duration;
+}
+
+void Scheduler::set_work_stealing_context(std::shared_ptr<WorkStealingContext> context) {
+  CHECK(context == nullptr || sched_id_ < context->sched_count());
+  work_stealing_context_ = std::move(context);
+}
+
 void Scheduler::clear() {
   if (service_actor_.empty()) {
     return;
@@ -252,6 +484,11 @@ void Scheduler::clear() {
   }
   poll_.clear();
 
+  if (profiler_ != nullptr) {
+    profiler_ = nullptr;
+    unpublish_profile();
+  }
+
   if (callback_ && !ExitGuard::is_exited()) {
     // can't move lambda with unique_ptr inside into std::function
     auto ptr = actor_info_pool_.release();
@@ -289,7 +526,13 @@ void Scheduler::do_event(ActorInfo *actor_info, Event &&event) {
       actor->raw_event(event.data);
       break;
     case Event::Type::Custom:
-      event.data.custom_event->run(actor);
+      if (event.is_custom_event_inline) {
+        // the event can be moved during its execution if the mailbox is reallocated, so run it from a local copy
+        Event local_event = std::move(event);
+        local_event.data.custom_event->run(actor);
+      } else {
+        event.data.custom_event->run(actor);
+      }
       break;
     case Event::Type::NoType:
     default:
@@ -317,6 +560,12 @@ void Scheduler::register_migrated_actor(ActorInfo *actor_info) {
     append(actor_info->mailbox_, std::move(it->second));
     pending_events_.erase(it);
   }
+  for (auto &event : actor_info->mailbox_) {
+    if (event.priority != EventPriority::Normal) {
+      actor_info->need_mailbox_reorder_ = true;
+      break;
+    }
+  }
   if (actor_info->mailbox_.empty()) {
     pending_actors_list_.put(actor_info->get_list_node());
   } else {
@@ -334,11 +583,54 @@ void Scheduler::send_to_other_scheduler(int32 sched_id, const ActorId<> &actor_i
       VLOG(actor) << "Send to scheduler " << sched_id << ": " << event;
     }
     start_migrate(event, sched_id);
-    outbound_queues_[sched_id]->writer_put(EventCreator::event_unsafe(actor_id, std::move(event)));
+    auto event_full = EventCreator::event_unsafe(actor_id, std::move(event));
+    if (unlikely(Tracer::is_enabled()) && actor_info != nullptr) {
+      event_full.set_trace_id(Tracer::next_id());
+      Tracer::flow_begin("actor", "send", event_full.trace_id());
+    }
+    if (is_outbound_event_batching_enabled_) {
+      auto &events = outbound_events_[sched_id];
+      if (events.empty()) {
+        outbound_event_sched_ids_.push_back(sched_id);
+      }
+      events.push_back(std::move(event_full));
+      return;
+    }
+    outbound_queues_[sched_id]->writer_put(std::move(event_full));
     outbound_queues_[sched_id]->writer_flush();
   }
 }
 
+void Scheduler::flush_outbound_events() {
+  if (outbound_event_sched_ids_.empty()) {
+    return;
+  }
+
+  uint64 event_count = 0;
+  uint64 wakeup_count = 0;
+  for (auto sched_id : outbound_event_sched_ids_) {
+    auto &events = outbound_events_[sched_id];
+    event_count += events.size();
+    // the batch is published to the reader by writer_put_batch itself, so no writer_flush is needed
+    if (outbound_queues_[sched_id]->writer_put_batch(events)) {
+      wakeup_count++;
+    }
+  }
+  uint64 flush_count = outbound_event_sched_ids_.size();
+  outbound_event_sched_ids_.clear();
+  outbound_event_count_.fetch_add(event_count, std::memory_order_relaxed);
+  outbound_flush_count_.fetch_add(flush_count, std::memory_order_relaxed);
+  outbound_wakeup_count_.fetch_add(wakeup_count, std::memory_order_relaxed);
+}
+
+OutboundEventStats Scheduler::get_outbound_event_stats() const {
+  OutboundEventStats stats;
+  stats.event_count = outbound_event_count_.load(std::memory_order_relaxed);
+  stats.flush_count = outbound_flush_count_.load(std::memory_order_relaxed);
+  stats.wakeup_count = outbound_wakeup_count_.load(std::memory_order_relaxed);
+  return stats;
+}
+
 void Scheduler::run_on_scheduler(int32 sched_id, Promise<Unit> action) {
   if (sched_id >= 0 && sched_id_ != sched_id) {
     class Worker final : public Actor {
@@ -383,6 +675,9 @@ void Scheduler::add_to_mailbox(ActorInfo *actor_info, Event &&event) {
     ready_actors_list_.put(node);
   }
   VLOG(actor) << "Add to mailbox: " << *actor_info << " " << event;
+  if (event.priority != EventPriority::Normal) {
+    actor_info->need_mailbox_reorder_ = true;
+  }
   actor_info->mailbox_.push_back(std::move(event));
 }
 
@@ -452,6 +747,10 @@ void Scheduler::start_migrate_actor(ActorInfo *actor_info, int32 dest_sched_id)
 }
 
 double Scheduler::get_actor_timeout(const ActorInfo *actor_info) const {
+  if (timer_wheel_ != nullptr) {
+    const TimerWheelNode *timer_wheel_node = actor_info->get_timer_wheel_node();
+    return timer_wheel_node->in_timer_wheel() ? timer_wheel_->get_key(timer_wheel_node) - Time::now() : 0.0;
+  }
   const HeapNode *heap_node = actor_info->get_heap_node();
   return heap_node->in_heap() ? timeout_queue_.get_key(heap_node) - Time::now() : 0.0;
 }
@@ -468,8 +767,17 @@ void Scheduler::set_actor_timeout_in(ActorInfo *actor_info, double timeout) {
 }
 
 void Scheduler::set_actor_timeout_at(ActorInfo *actor_info, double timeout_at) {
-  HeapNode *heap_node = actor_info->get_heap_node();
   VLOG(actor) << "Set actor " << *actor_info << " timeout in " << timeout_at - Time::now_cached();
+  if (timer_wheel_ != nullptr) {
+    TimerWheelNode *timer_wheel_node = actor_info->get_timer_wheel_node();
+    if (timer_wheel_node->in_timer_wheel()) {
+      timer_wheel_->fix(timeout_at, timer_wheel_node, Time::now_cached());
+    } else {
+      timer_wheel_->insert(timeout_at, timer_wheel_node, Time::now_cached());
+    }
+    return;
+  }
+  HeapNode *heap_node = actor_info->get_heap_node();
   if (heap_node->in_heap()) {
     timeout_queue_.fix(timeout_at, heap_node);
   } else {
@@ -478,17 +786,42 @@ void Scheduler::set_actor_timeout_at(ActorInfo *actor_info, double timeout_at) {
 }
 
 void Scheduler::run_poll(Timestamp timeout) {
+#if TD_PORT_WINDOWS
   // we can't wait for less than 1ms
   auto timeout_ms = static_cast<int>(clamp(timeout.in(), 0.0, 1000000.0) * 1000 + 1);
-#if TD_PORT_WINDOWS
   CHECK(inbound_queue_);
   inbound_queue_->reader_get_event_fd().wait(timeout_ms);
   service_actor_.notify();
 #elif TD_PORT_POSIX
-  poll_.run(timeout_ms);
+  if (busy_poll(timeout)) {
+    // the inbound queue isn't empty, so just check other file descriptors
+    poll_.run(0);
+    return;
+  }
+  poll_.run_precise(timeout.in());
 #endif
 }
 
+bool Scheduler::busy_poll(Timestamp timeout) {
+  // the inbound queue is considered busy if events were received during the last 10 spin durations
+  constexpr double BUSY_QUEUE_DURATION_FACTOR = 10.0;
+  if (busy_poll_duration_ <= 0 || !inbound_queue_) {
+    return false;
+  }
+  auto now = Time::now();
+  if (now > inbound_queue_busy_at_ + BUSY_QUEUE_DURATION_FACTOR * busy_poll_duration_) {
+    return false;
+  }
+  auto spin_until = min(now + busy_poll_duration_, timeout.at());
+  do {
+    if (inbound_queue_->reader_has_values()) {
+      service_actor_.notify();
+      return true;
+    }
+  } while (Time::now() < spin_until);
+  return false;
+}
+
 void Scheduler::run_mailbox() {
   VLOG(actor) << "Run mailbox : begin";
   ListNode actors_list = std::move(ready_actors_list_);
@@ -520,6 +853,17 @@ void Scheduler::run_mailbox() {
 
 Timestamp Scheduler::run_timeout() {
   double now = Time::now();
+  if (timer_wheel_ != nullptr) {
+    while (true) {
+      TimerWheelNode *node = timer_wheel_->pop_expired(now);
+      if (node == nullptr) {
+        break;
+      }
+      ActorInfo *actor_info = ActorInfo::from_timer_wheel_node(node);
+      send<ActorSendType::Immediate>(actor_info->actor_id(), Event::timeout());
+    }
+    return get_timeout();
+  }
   //TODO: use Timestamp().is_in_past()
   while (!timeout_queue_.empty() && timeout_queue_.top_key() < now) {
     HeapNode *node = timeout_queue_.pop();
@@ -529,14 +873,74 @@ Timestamp Scheduler::run_timeout() {
   return get_timeout();
 }
 
+void Scheduler::share_work() {
+  if (!work_stealing_context_->has_idle_scheduler()) {
+    return;
+  }
+
+  // look only at the beginning of the list to keep the check cheap
+  constexpr size_t MAX_CHECKED_ACTORS = 256;
+  constexpr size_t MAX_SHARED_ACTORS = 64;
+  shared_actors_.clear();
+  size_t checked_actor_count = 0;
+  for (ListNode *end = &ready_actors_list_, *it = ready_actors_list_.next;
+       it != end && checked_actor_count < MAX_CHECKED_ACTORS && shared_actors_.size() < 2 * MAX_SHARED_ACTORS;
+       it = it->next, checked_actor_count++) {
+    auto actor_info = ActorInfo::from_list_node(it);
+    if (actor_info->is_migratable() && !actor_info->is_running() && !actor_info->has_timeout()) {
+      shared_actors_.push_back(actor_info);
+    }
+  }
+  if (shared_actors_.size() < 2) {
+    // nothing to share; the only ready actor will be run here faster than anywhere else
+    return;
+  }
+
+  auto dest_sched_id = work_stealing_context_->acquire_idle_scheduler(sched_id_);
+  if (dest_sched_id < 0) {
+    return;
+  }
+
+  // keep actors from the beginning of the list, because they will be run here first
+  auto shared_actor_count = shared_actors_.size() / 2;
+  VLOG(actor) << "Move " << shared_actor_count << " actors from scheduler " << sched_id_ << " to " << dest_sched_id;
+  for (size_t i = shared_actors_.size() - shared_actor_count; i < shared_actors_.size(); i++) {
+    do_migrate_actor(shared_actors_[i], dest_sched_id);
+  }
+  shared_actors_.clear();
+  work_stealing_context_->on_actors_moved(shared_actor_count);
+}
+
+bool Scheduler::is_shareable_actor(ActorInfo *actor_info) const {
+  if (work_stealing_context_ == nullptr) {
+    return false;
+  }
+  int32 actor_sched_id;
+  bool is_migrating;
+  std::tie(actor_sched_id, is_migrating) = actor_info->migrate_dest_flag_atomic();
+  return !is_migrating && actor_sched_id == sched_id_ && actor_info->is_migratable();
+}
+
 Timestamp Scheduler::run_events(Timestamp timeout) {
   Timestamp res;
   VLOG(actor) << "Run events " << sched_id_ << " " << tag("pending", pending_events_.size())
               << tag("actors", actor_count_);
+  // events for other schedulers can be buffered only here, because they will be flushed before return
+  is_outbound_event_batching_enabled_ = true;
   do {
+    update_profiler();
+    if (work_stealing_context_ != nullptr) {
+      share_work();
+    }
     run_mailbox();
     res = run_timeout();
+    flush_outbound_events();
   } while (!ready_actors_list_.empty() && !timeout.is_in_past());
+  is_outbound_event_batching_enabled_ = false;
+  if (profiler_ != nullptr) {
+    profiler_->busy_time += Time::now() - profiler_->busy_start_time;
+    profiler_->busy_start_time = 0.0;
+  }
   return res;
 }
 
@@ -550,7 +954,18 @@ void Scheduler::run_no_guard(Timestamp timeout) {
   if (yield_flag_) {
     return;
   }
-  run_poll(timeout);
+  auto poll_start_time = profiler_ != nullptr ? Time::now() : 0.0;
+  if (work_stealing_context_ != nullptr && ready_actors_list_.empty()) {
+    work_stealing_context_->set_idle(sched_id_, true);
+    run_poll(timeout);
+    work_stealing_context_->set_idle(sched_id_, false);
+  } else {
+    run_poll(timeout);
+  }
+  if (profiler_ != nullptr && poll_start_time != 0.0) {
+    profiler_->idle_time += Time::now() - poll_start_time;
+    profiler_->poll_wakeup_count++;
+  }
   run_events(timeout);
 }
 
@@ -558,6 +973,12 @@ Timestamp Scheduler::get_timeout() {
   if (!ready_actors_list_.empty()) {
     return Timestamp::in(0);
   }
+  if (timer_wheel_ != nullptr) {
+    if (timer_wheel_->empty()) {
+      return Timestamp::in(10000);
+    }
+    return Timestamp::at(timer_wheel_->get_next_timeout());
+  }
   if (timeout_queue_.empty()) {
     return Timestamp::in(10000);
   }
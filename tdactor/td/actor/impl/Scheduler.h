@@ -19,6 +19,7 @@
 #include "td/utils/Slice.h"
 #include "td/utils/Time.h"
 
+#include <algorithm>
 #include <atomic>
 #include <tuple>
 #include <utility>
@@ -34,6 +35,10 @@ class EventGuard {
     return event_context_.flags == 0;
   }
 
+  void set_event_count(size_t event_count) {
+    event_count_ = event_count;
+  }
+
   EventGuard(const EventGuard &) = delete;
   EventGuard &operator=(const EventGuard &) = delete;
   EventGuard(EventGuard &&) = delete;
@@ -46,6 +51,11 @@ class EventGuard {
   Scheduler *scheduler_;
   ActorContext *save_context_;
   const char *save_log_tag2_;
+  size_t event_count_ = 1;
+  size_t mailbox_size_ = 0;
+  double start_time_ = 0.0;
+  double save_nested_time_ = 0.0;
+  bool is_traced_ = false;
 
   void swap_context(ActorInfo *info);
 };
@@ -141,20 +151,37 @@ inline void Scheduler::destroy_actor(ActorInfo *actor_info) {
 template <class RunFuncT, class EventFuncT>
 void Scheduler::flush_mailbox(ActorInfo *actor_info, const RunFuncT &run_func, const EventFuncT &event_func) {
   auto &mailbox = actor_info->mailbox_;
+  if (unlikely(actor_info->need_mailbox_reorder_)) {
+    actor_info->need_mailbox_reorder_ = false;
+    // system events like start, hangup or timeout are never overtaken, so only custom events after the last of them
+    // are reordered
+    auto first_reordered = std::find_if(mailbox.rbegin(), mailbox.rend(), [](const Event &event) {
+                             return event.type != Event::Type::Custom;
+                           }).base();
+    std::stable_sort(first_reordered, mailbox.end(),
+                     [](const Event &lhs, const Event &rhs) { return lhs.priority < rhs.priority; });
+  }
   size_t mailbox_size = mailbox.size();
   CHECK(mailbox_size != 0);
   EventGuard guard(this, actor_info);
   size_t i = 0;
   for (; i < mailbox_size && guard.can_run(); i++) {
+    if (unlikely(actor_info->need_mailbox_reorder_) && i > 0) {
+      // a prioritized event was added; the rest of the mailbox will be handled after reordering
+      break;
+    }
     do_event(actor_info, std::move(mailbox[i]));
   }
+  size_t event_count = i;
   if (run_func) {
     if (guard.can_run()) {
       (*run_func)(actor_info);
+      event_count++;
     } else {
       mailbox.insert(mailbox.begin() + i, (*event_func)());
     }
   }
+  guard.set_event_count(event_count);
   mailbox.erase(mailbox.begin(), mailbox.begin() + i);
 }
 
@@ -230,7 +257,7 @@ void Scheduler::send_lambda(ActorRef actor_ref, EventT &&lambda) {
 }
 
 template <ActorSendType send_type, class EventT>
-void Scheduler::send_closure(ActorRef actor_ref, EventT &&closure) {
+void Scheduler::send_closure(ActorRef actor_ref, EventT &&closure, EventPriority priority) {
   return send_impl<send_type>(
       actor_ref.get(),
       [&](ActorInfo *actor_info) {
@@ -240,6 +267,7 @@ void Scheduler::send_closure(ActorRef actor_ref, EventT &&closure) {
       [&] {
         auto event = Event::immediate_closure(std::forward<EventT>(closure));
         event.set_link_token(actor_ref.token());
+        event.set_priority(priority);
         return event;
       });
 }
@@ -287,6 +315,13 @@ inline uint64 Scheduler::get_link_token(ActorInfo *actor_info) {
   return event_context_ptr_->link_token;
 }
 
+inline ActorId<> Scheduler::get_current_actor_id() const {
+  if (event_context_ptr_ == nullptr || event_context_ptr_->actor_info == nullptr) {
+    return ActorId<>();
+  }
+  return event_context_ptr_->actor_info->actor_id();
+}
+
 inline void Scheduler::finish_migrate_actor(Actor *actor) {
   register_migrated_actor(actor->get_info());
 }
@@ -305,6 +340,13 @@ inline void Scheduler::cancel_actor_timeout(Actor *actor) {
 }
 
 inline void Scheduler::cancel_actor_timeout(ActorInfo *actor_info) {
+  if (timer_wheel_ != nullptr) {
+    TimerWheelNode *timer_wheel_node = actor_info->get_timer_wheel_node();
+    if (timer_wheel_node->in_timer_wheel()) {
+      timer_wheel_->erase(timer_wheel_node);
+    }
+    return;
+  }
   HeapNode *heap_node = actor_info->get_heap_node();
   if (heap_node->in_heap()) {
     timeout_queue_.erase(heap_node);
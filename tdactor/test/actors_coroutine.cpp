@@ -0,0 +1,140 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/actor/Coroutine.h"
+
+#if TD_HAVE_ACTOR_COROUTINES
+
+#include "td/actor/actor.h"
+#include "td/actor/ConcurrentScheduler.h"
+
+#include "td/utils/common.h"
+#include "td/utils/Promise.h"
+#include "td/utils/ScopeGuard.h"
+#include "td/utils/Status.h"
+#include "td/utils/tests.h"
+
+class CoroutineServer final : public td::Actor {
+ public:
+  void add_one(int value, td::Promise<int> &&promise) {
+    CHECK(td::Scheduler::instance()->sched_id() == 1);
+    if (value < 0) {
+      return promise.set_error(td::Status::Error(400, "Negative value"));
+    }
+    promise.set_value(value + 1);
+  }
+
+  void lose_promise(td::Promise<td::Unit> &&promise) {
+  }
+};
+
+class CoroutineClient final : public td::Actor {
+ public:
+  explicit CoroutineClient(td::ActorId<CoroutineServer> server) : server_(std::move(server)) {
+  }
+
+ private:
+  td::ActorId<CoroutineServer> server_;
+  int sum_ = 0;
+
+  td::Task<int> add_two(int value) {
+    auto r_value = co_await td::co_send_closure(server_, &CoroutineServer::add_one, value);
+    if (r_value.is_error()) {
+      co_return r_value.move_as_error();
+    }
+    co_return co_await td::co_send_closure(server_, &CoroutineServer::add_one, r_value.ok());
+  }
+
+  td::Task<td::Unit> run() {
+    for (int i = 0; i < 100; i++) {
+      auto r_value = co_await add_two(i);
+      ASSERT_EQ(td::Scheduler::instance()->sched_id(), 0);
+      ASSERT_EQ(i + 2, r_value.ok());
+      sum_ += r_value.ok();
+    }
+
+    auto r_error = co_await add_two(-1);
+    ASSERT_EQ(400, r_error.error().code());
+
+    auto r_lost = co_await td::co_send_closure(server_, &CoroutineServer::lose_promise);
+    ASSERT_TRUE(r_lost.is_error());
+
+    auto r_immediate = co_await td::wait_promise<int>([](td::Promise<int> &&promise) { promise.set_value(5); });
+    ASSERT_EQ(5, r_immediate.ok());
+    co_return td::Unit();
+  }
+
+  void start_up() final {
+    run().start(td::PromiseCreator::lambda([actor_id = actor_id(this)](td::Result<td::Unit> result) {
+      result.ensure();
+      send_closure(actor_id, &CoroutineClient::on_finished);
+    }));
+  }
+
+  void on_finished() {
+    ASSERT_EQ(5150, sum_);
+    td::Scheduler::instance()->finish();
+    stop();
+  }
+};
+
+TEST(Actors, coroutine) {
+  td::ConcurrentScheduler scheduler(1, 0);
+  auto server = scheduler.create_actor_unsafe<CoroutineServer>(1, "CoroutineServer").release();
+  scheduler.create_actor_unsafe<CoroutineClient>(0, "CoroutineClient", server).release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+}
+
+static td::Promise<td::Unit> saved_promise;
+static bool is_coroutine_destroyed = false;
+
+class CoroutineClosedActor final : public td::Actor {
+  td::Task<td::Unit> wait() {
+    SCOPE_EXIT {
+      is_coroutine_destroyed = true;
+    };
+    co_await td::wait_promise<td::Unit>([](td::Promise<td::Unit> &&promise) { saved_promise = std::move(promise); });
+    UNREACHABLE();
+    co_return td::Unit();
+  }
+
+  void start_up() final {
+    wait().start(td::Promise<td::Unit>());
+    stop();
+  }
+};
+
+class CoroutineClosedChecker final : public td::Actor {
+  void start_up() final {
+    td::create_actor<CoroutineClosedActor>("CoroutineClosedActor").release();
+    yield();
+  }
+
+  void loop() final {
+    if (!saved_promise) {
+      return yield();
+    }
+    ASSERT_TRUE(!is_coroutine_destroyed);
+    saved_promise.set_value(td::Unit());
+    ASSERT_TRUE(is_coroutine_destroyed);
+    td::Scheduler::instance()->finish();
+    stop();
+  }
+};
+
+TEST(Actors, coroutine_actor_closed) {
+  td::ConcurrentScheduler scheduler(0, 0);
+  scheduler.create_actor_unsafe<CoroutineClosedChecker>(0, "CoroutineClosedChecker").release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+}
+
+#endif
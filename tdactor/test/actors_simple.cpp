@@ -19,10 +19,12 @@
 #include "td/utils/port/thread.h"
 #include "td/utils/Promise.h"
 #include "td/utils/Slice.h"
+#include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
 #include "td/utils/StringBuilder.h"
 #include "td/utils/tests.h"
 #include "td/utils/Time.h"
+#include "td/utils/Tracer.h"
 
 #include <memory>
 #include <tuple>
@@ -110,6 +112,10 @@ TEST(Actors, simple_pass_event_arguments) {
 
   X x;
 
+  // small delayed closures are stored inline in events, so they are moved together with the events
+  // to the list of pending events, to the mailbox and out of the mailbox before they are run
+  const td::string inline_event_moves = "[cnstr_move][cnstr_move][cnstr_move]";
+
   // check tuple
   // std::tuple<X> tx;
   // sb.clear();
@@ -129,7 +135,7 @@ TEST(Actors, simple_pass_event_arguments) {
   td::send_closure_later(id, &XReceiver::by_const_ref, X());
   scheduler.run_no_guard(td::Timestamp::in(1));
   // LOG(ERROR) << sb.as_cslice();
-  ASSERT_STREQ("[cnstr_default][cnstr_move][by_const_ref]", sb.as_cslice().c_str());
+  ASSERT_STREQ("[cnstr_default][cnstr_move]" + inline_event_moves + "[by_const_ref]", sb.as_cslice().c_str());
 
   // Tmp-->LvalueRef
   sb.clear();
@@ -140,7 +146,7 @@ TEST(Actors, simple_pass_event_arguments) {
   sb.clear();
   td::send_closure_later(id, &XReceiver::by_lvalue_ref, X());
   scheduler.run_no_guard(td::Timestamp::in(1));
-  ASSERT_STREQ("[cnstr_default][cnstr_move][by_lvalue_ref]", sb.as_cslice().c_str());
+  ASSERT_STREQ("[cnstr_default][cnstr_move]" + inline_event_moves + "[by_lvalue_ref]", sb.as_cslice().c_str());
 
   // Tmp-->Value
   sb.clear();
@@ -151,7 +157,7 @@ TEST(Actors, simple_pass_event_arguments) {
   sb.clear();
   td::send_closure_later(id, &XReceiver::by_value, X());
   scheduler.run_no_guard(td::Timestamp::in(1));
-  ASSERT_STREQ("[cnstr_default][cnstr_move][cnstr_move][by_value]", sb.as_cslice().c_str());
+  ASSERT_STREQ("[cnstr_default][cnstr_move]" + inline_event_moves + "[cnstr_move][by_value]", sb.as_cslice().c_str());
 
   // Var-->ConstRef
   sb.clear();
@@ -162,7 +168,7 @@ TEST(Actors, simple_pass_event_arguments) {
   sb.clear();
   td::send_closure_later(id, &XReceiver::by_const_ref, x);
   scheduler.run_no_guard(td::Timestamp::in(1));
-  ASSERT_STREQ("[cnstr_copy][by_const_ref]", sb.as_cslice().c_str());
+  ASSERT_STREQ("[cnstr_copy]" + inline_event_moves + "[by_const_ref]", sb.as_cslice().c_str());
 
   // Var-->LvalueRef
   // Var-->LvalueRef (Delayed)
@@ -177,7 +183,7 @@ TEST(Actors, simple_pass_event_arguments) {
   sb.clear();
   td::send_closure_later(id, &XReceiver::by_value, x);
   scheduler.run_no_guard(td::Timestamp::in(1));
-  ASSERT_STREQ("[cnstr_copy][cnstr_move][by_value]", sb.as_cslice().c_str());
+  ASSERT_STREQ("[cnstr_copy]" + inline_event_moves + "[cnstr_move][by_value]", sb.as_cslice().c_str());
 }
 
 class PrintChar final : public td::Actor {
@@ -494,6 +500,42 @@ TEST(Actors, later) {
   ASSERT_STREQ(sb.as_cslice().c_str(), "AAABBB");
 }
 
+class InlineEventActor final : public td::Actor {
+ public:
+  void start_up() final {
+    send_closure_later(actor_id(this), &InlineEventActor::on_event, td::make_unique<td::string>("0"), 0);
+  }
+
+  void on_event(const td::unique_ptr<td::string> &value, int depth) {
+    received_event_count_++;
+    if (depth < 3) {
+      for (int i = 0; i < 10; i++) {
+        send_closure_later(actor_id(this), &InlineEventActor::on_event,
+                           td::make_unique<td::string>(PSTRING() << depth + 1), depth + 1);
+      }
+    }
+    // the mailbox has been reallocated, but the argument must still be valid
+    td::string expected_value = PSTRING() << depth;
+    CHECK(*value == expected_value);
+    if (received_event_count_ == 1111) {
+      td::Scheduler::instance()->finish();
+      stop();
+    }
+  }
+
+ private:
+  int received_event_count_ = 0;
+};
+
+TEST(Actors, inline_event_arguments) {
+  td::ConcurrentScheduler scheduler(0, 0);
+  scheduler.create_actor_unsafe<InlineEventActor>(0, "A").release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+}
+
 class MultiPromise2 final : public td::Actor {
  public:
   void start_up() final {
@@ -531,6 +573,51 @@ TEST(Actors, MultiPromise) {
   scheduler.finish();
 }
 
+TEST(Actors, MultiPromiseJoin) {
+  td::MultiPromiseJoin multi_promise{"MultiPromiseJoin"};
+  int ok_count = 0;
+  int error_count = 0;
+  auto add_promise = [&] {
+    multi_promise.add_promise(td::PromiseCreator::lambda([&](td::Result<td::Unit> result) {
+      if (result.is_ok()) {
+        ok_count++;
+      } else {
+        ASSERT_EQ(400, result.error().code());
+        error_count++;
+      }
+    }));
+  };
+
+  add_promise();
+  add_promise();
+  ASSERT_EQ(2u, multi_promise.promise_count());
+  auto lock = multi_promise.get_promise();
+  td::vector<td::Promise<td::Unit>> promises;
+  for (int i = 0; i < 100; i++) {
+    promises.push_back(multi_promise.get_promise());
+  }
+  td::thread worker([&promises] { td::set_promises(promises); });
+  worker.join();
+  ASSERT_EQ(0, ok_count);
+  lock.set_value(td::Unit());
+  ASSERT_EQ(2, ok_count);
+  ASSERT_EQ(0u, multi_promise.promise_count());
+
+  add_promise();
+  lock = multi_promise.get_promise();
+  multi_promise.get_promise().set_error(td::Status::Error(400, "Error"));
+  multi_promise.get_promise().set_value(td::Unit());
+  ASSERT_EQ(0, error_count);
+  lock = td::Promise<td::Unit>();
+  ASSERT_EQ(1, error_count);
+
+  add_promise();
+  multi_promise.set_ignore_errors(true);
+  multi_promise.get_promise().set_error(td::Status::Error(400, "Error"));
+  ASSERT_EQ(3, ok_count);
+  ASSERT_EQ(1, error_count);
+}
+
 class FastPromise final : public td::Actor {
  public:
   void start_up() final {
@@ -680,3 +767,197 @@ TEST(Actors, MultiPromiseSendClosureLater) {
   }
   scheduler.finish();
 }
+
+class ProfiledInnerActor final : public td::Actor {
+ public:
+  void work() {
+    auto end_time = td::Time::now() + 1e-3;
+    while (td::Time::now() < end_time) {
+      // busy wait
+    }
+  }
+};
+
+class ProfiledOuterActor final : public td::Actor {
+ public:
+  void start_up() final {
+    inner_ = td::create_actor<ProfiledInnerActor>("ProfiledInnerActor").release();
+    yield();
+  }
+
+  void wakeup() final {
+    // the inner actor is run immediately inside the handler of the outer actor
+    td::send_closure(inner_, &ProfiledInnerActor::work);
+
+    auto profiles = td::Scheduler::get_profiles();
+    if (profiles.empty()) {
+      yield();
+      return;
+    }
+    ASSERT_EQ(1u, profiles.size());
+    auto &profile = profiles[0];
+    LOG(INFO) << profile;
+    ASSERT_TRUE(profile.busy_time > 0.5);
+    ASSERT_TRUE(profile.busy_time <= profile.duration);
+
+    const td::ActorProfile *inner_profile = nullptr;
+    const td::ActorProfile *outer_profile = nullptr;
+    for (auto &it : profile.actor_profiles) {
+      if (it.first == "ProfiledInnerActor") {
+        inner_profile = &it.second;
+      }
+      if (it.first == "ProfiledOuterActor") {
+        outer_profile = &it.second;
+      }
+    }
+    ASSERT_TRUE(inner_profile != nullptr);
+    ASSERT_TRUE(outer_profile != nullptr);
+    ASSERT_TRUE(inner_profile->event_count > 100);
+    ASSERT_TRUE(outer_profile->event_count > 100);
+    ASSERT_TRUE(inner_profile->max_flush_time >= 1e-3);
+    // time of the nested handler isn't included into the outer actor time
+    ASSERT_TRUE(outer_profile->total_time < inner_profile->total_time);
+    ASSERT_EQ(profile.actor_profiles[0].first, "ProfiledInnerActor");
+
+    stop();
+    td::Scheduler::instance()->finish();
+  }
+
+ private:
+  td::ActorId<ProfiledInnerActor> inner_;
+};
+
+TEST(Actors, profiling) {
+  td::Scheduler::set_profiling_enabled(true);
+  td::ConcurrentScheduler scheduler(0, 0);
+  scheduler.create_actor_unsafe<ProfiledOuterActor>(0, "ProfiledOuterActor").release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+  td::Scheduler::set_profiling_enabled(false);
+  ASSERT_TRUE(td::Scheduler::get_profiles().empty());
+}
+
+class TracedReceiverActor final : public td::Actor {
+ public:
+  void ping() {
+    stop();
+    td::Scheduler::instance()->finish();
+  }
+};
+
+class TracedSenderActor final : public td::Actor {
+ public:
+  explicit TracedSenderActor(td::ActorId<TracedReceiverActor> receiver) : receiver_(std::move(receiver)) {
+  }
+
+  void start_up() final {
+    td::send_closure(receiver_, &TracedReceiverActor::ping);
+    stop();
+  }
+
+ private:
+  td::ActorId<TracedReceiverActor> receiver_;
+};
+
+TEST(Actors, tracing) {
+  td::Tracer::start();
+  td::ConcurrentScheduler scheduler(1, 0);
+  auto receiver = scheduler.create_actor_unsafe<TracedReceiverActor>(0, "TracedReceiverActor").release();
+  scheduler.create_actor_unsafe<TracedSenderActor>(1, "TracedSenderActor", receiver).release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+  td::Tracer::stop();
+
+  auto trace = td::Tracer::get_trace();
+  ASSERT_TRUE(trace.find("\"name\":\"TracedSenderActor\"") != td::string::npos);
+  ASSERT_TRUE(trace.find("\"name\":\"TracedReceiverActor\"") != td::string::npos);
+  ASSERT_TRUE(trace.find("\"ph\":\"s\"") != td::string::npos);
+  ASSERT_TRUE(trace.find("\"ph\":\"f\"") != td::string::npos);
+}
+
+class PrioritizedReceiverActor final : public td::Actor {
+ public:
+  void on_event(int value) {
+    values_.push_back(value);
+    if (value == 3) {
+      // the high-priority event is handled before the rest of the already queued events
+      td::send_closure_later_with_priority(actor_id(this), td::EventPriority::High, &PrioritizedReceiverActor::on_event,
+                                           7);
+    }
+  }
+
+  void check() {
+    td::vector<int> expected{0, 1, 2, 3, 7, 4, 5, 6};
+    ASSERT_EQ(expected, values_);
+    stop();
+    td::Scheduler::instance()->finish();
+  }
+
+ private:
+  td::vector<int> values_;
+
+  void start_up() final {
+    // the default implementation yields, and custom events are never reordered ahead of the yield event
+  }
+};
+
+class PrioritizedSenderActor final : public td::Actor {
+  void start_up() final {
+    auto receiver = td::create_actor<PrioritizedReceiverActor>("PrioritizedReceiverActor").release();
+    td::send_closure_later_with_priority(receiver, td::EventPriority::Low, &PrioritizedReceiverActor::on_event, 5);
+    td::send_closure_later(receiver, &PrioritizedReceiverActor::on_event, 3);
+    td::send_closure_later_with_priority(receiver, td::EventPriority::High, &PrioritizedReceiverActor::on_event, 0);
+    td::send_closure_later_with_priority(receiver, td::EventPriority::Low, &PrioritizedReceiverActor::on_event, 6);
+    td::send_closure_with_priority(receiver, td::EventPriority::High, &PrioritizedReceiverActor::on_event, 1);
+    td::send_closure_with_priority(receiver, td::EventPriority::High, &PrioritizedReceiverActor::on_event, 2);
+    td::send_closure(receiver, &PrioritizedReceiverActor::on_event, 4);
+    td::send_closure_later_with_priority(receiver, td::EventPriority::Low, &PrioritizedReceiverActor::check);
+    stop();
+  }
+};
+
+TEST(Actors, event_priority) {
+  td::ConcurrentScheduler scheduler(0, 0);
+  scheduler.create_actor_unsafe<PrioritizedSenderActor>(0, "PrioritizedSenderActor").release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+}
+
+class StartedReceiverActor final : public td::Actor {
+ public:
+  void on_event() {
+    ASSERT_TRUE(is_started_);
+    stop();
+    td::Scheduler::instance()->finish();
+  }
+
+ private:
+  bool is_started_ = false;
+
+  void start_up() final {
+    is_started_ = true;
+  }
+};
+
+class StartedSenderActor final : public td::Actor {
+  void start_up() final {
+    auto receiver = td::create_actor<StartedReceiverActor>("StartedReceiverActor").release();
+    td::send_closure_later_with_priority(receiver, td::EventPriority::High, &StartedReceiverActor::on_event);
+    stop();
+  }
+};
+
+TEST(Actors, event_priority_after_start_up) {
+  td::ConcurrentScheduler scheduler(0, 0);
+  scheduler.create_actor_unsafe<StartedSenderActor>(0, "StartedSenderActor").release();
+  scheduler.start();
+  while (scheduler.run_main(10)) {
+  }
+  scheduler.finish();
+}
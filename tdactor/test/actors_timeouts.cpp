@@ -0,0 +1,210 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/actor/actor.h"
+#include "td/actor/ConcurrentScheduler.h"
+#include "td/actor/MultiTimeout.h"
+
+#include "td/utils/benchmark.h"
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+#include "td/utils/Random.h"
+#include "td/utils/SliceBuilder.h"
+#include "td/utils/tests.h"
+#include "td/utils/Time.h"
+
+#include <map>
+
+namespace {
+
+class RepeatedTimeoutActor final : public td::Actor {
+ public:
+  explicit RepeatedTimeoutActor(int *left_count) : left_count_(left_count) {
+  }
+
+ private:
+  int *left_count_;
+  double expires_at_ = 0.0;
+
+  void start_up() final {
+    expires_at_ = td::Time::now() + td::Random::fast(0, 10) * 0.001;
+    set_timeout_at(expires_at_);
+  }
+
+  void timeout_expired() final {
+    CHECK(td::Time::now() >= expires_at_);
+    --*left_count_;
+    start_up();
+  }
+};
+
+struct MultiTimeoutData {
+  td::MultiTimeout *multi_timeout = nullptr;
+  std::map<td::int64, double> expires_at;
+};
+
+void check_timeouts(bool use_timer_wheel) {
+  td::ConcurrentScheduler sched(0, 0);
+  if (use_timer_wheel) {
+    sched.set_timer_wheel_precision(0.001);
+  }
+  int left_count = 1000;
+  for (int i = 0; i < 10; i++) {
+    sched.create_actor_unsafe<RepeatedTimeoutActor>(0, "RepeatedTimeoutActor", &left_count).release();
+  }
+
+  td::unique_ptr<td::MultiTimeout> multi_timeout;
+  MultiTimeoutData data;
+  sched.start();
+  {
+    auto guard = sched.get_main_guard();
+    multi_timeout = td::make_unique<td::MultiTimeout>("MultiTimeout");
+    if (use_timer_wheel) {
+      multi_timeout->set_timer_wheel_precision(0.001);
+    }
+    data.multi_timeout = multi_timeout.get();
+    multi_timeout->set_callback([](void *void_data, td::int64 key) {
+      auto &data = *static_cast<MultiTimeoutData *>(void_data);
+      auto it = data.expires_at.find(key);
+      CHECK(it != data.expires_at.end());
+      CHECK(td::Time::now() >= it->second);
+      data.expires_at.erase(it);
+      if (key < 10000 && td::Random::fast(0, 3) == 0) {
+        auto expires_at = td::Time::now() + td::Random::fast(0, 20) * 0.001;
+        data.expires_at[key + 1000] = expires_at;
+        data.multi_timeout->set_timeout_at(key + 1000, expires_at);
+      }
+    });
+    multi_timeout->set_callback_data(&data);
+
+    auto now = td::Time::now();
+    for (int i = 0; i < 10000; i++) {
+      td::int64 key = td::Random::fast(0, 999);
+      auto x = td::Random::fast(0, 9);
+      if (x < 6) {
+        auto expires_at = now + td::Random::fast(0, 100) * 0.001;
+        data.expires_at[key] = expires_at;
+        multi_timeout->set_timeout_at(key, expires_at);
+      } else if (x < 8) {
+        auto expires_at = now + td::Random::fast(0, 100) * 0.001;
+        if (data.expires_at.emplace(key, expires_at).second) {
+          multi_timeout->add_timeout_at(key, expires_at);
+        }
+      } else {
+        data.expires_at.erase(key);
+        multi_timeout->cancel_timeout(key);
+      }
+      ASSERT_EQ(data.expires_at.count(key) > 0, multi_timeout->has_timeout(key));
+    }
+  }
+
+  auto end_time = td::Time::now() + 10;
+  while (left_count > 0 || !data.expires_at.empty()) {
+    ASSERT_TRUE(td::Time::now() < end_time);
+    sched.run_main(0.1);
+  }
+  {
+    auto guard = sched.get_main_guard();
+    multi_timeout.reset();
+  }
+  sched.finish();
+}
+
+class MultiTimeoutBenchmark final : public td::Benchmark {
+ public:
+  explicit MultiTimeoutBenchmark(bool use_timer_wheel) : use_timer_wheel_(use_timer_wheel) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "MultiTimeout set/cancel " << (use_timer_wheel_ ? "with timer wheel" : "with heap");
+  }
+
+  void run(int n) final {
+    td::ConcurrentScheduler sched(0, 0);
+    sched.start();
+    {
+      auto guard = sched.get_main_guard();
+      td::MultiTimeout multi_timeout("MultiTimeout");
+      if (use_timer_wheel_) {
+        multi_timeout.set_timer_wheel_precision(0.001);
+      }
+      multi_timeout.set_callback([](void *, td::int64) {});
+      multi_timeout.set_callback_data(nullptr);
+      auto now = td::Time::now();
+      for (int i = 0; i < n; i++) {
+        td::int64 key = td::Random::fast(0, KEY_COUNT - 1);
+        if (i % 4 == 3) {
+          multi_timeout.cancel_timeout(key);
+        } else {
+          multi_timeout.set_timeout_at(key, now + td::Random::fast(1, 100000) * 0.001);
+        }
+      }
+    }
+    sched.finish();
+  }
+
+ private:
+  static constexpr int KEY_COUNT = 100000;
+  bool use_timer_wheel_;
+};
+
+class ActorTimeoutBenchmark final : public td::Benchmark {
+ public:
+  explicit ActorTimeoutBenchmark(bool use_timer_wheel) : use_timer_wheel_(use_timer_wheel) {
+  }
+
+  td::string get_description() const final {
+    return PSTRING() << "Actor timeout set/cancel " << (use_timer_wheel_ ? "with timer wheel" : "with heap");
+  }
+
+  void run(int n) final {
+    class IdleActor final : public td::Actor {};
+
+    td::ConcurrentScheduler sched(0, 0);
+    if (use_timer_wheel_) {
+      sched.set_timer_wheel_precision(0.001);
+    }
+    sched.start();
+    {
+      auto guard = sched.get_main_guard();
+      td::vector<td::ActorOwn<IdleActor>> actors;
+      for (int i = 0; i < ACTOR_COUNT; i++) {
+        actors.push_back(td::create_actor<IdleActor>("IdleActor"));
+      }
+      auto now = td::Time::now();
+      for (int i = 0; i < n; i++) {
+        auto actor = actors[td::Random::fast(0, ACTOR_COUNT - 1)].get().get_actor_unsafe();
+        if (i % 4 == 3) {
+          actor->cancel_timeout();
+        } else {
+          actor->set_timeout_at(now + td::Random::fast(1, 100000) * 0.001);
+        }
+      }
+    }
+    sched.finish();
+  }
+
+ private:
+  static constexpr int ACTOR_COUNT = 10000;
+  bool use_timer_wheel_;
+};
+
+}  // namespace
+
+TEST(MultiTimeout, heap) {
+  check_timeouts(false);
+}
+
+TEST(MultiTimeout, timer_wheel) {
+  check_timeouts(true);
+}
+
+TEST(MultiTimeout, benchmark) {
+  for (auto use_timer_wheel : {false, true}) {
+    bench(MultiTimeoutBenchmark(use_timer_wheel), 0.2);
+    bench(ActorTimeoutBenchmark(use_timer_wheel), 0.2);
+  }
+}
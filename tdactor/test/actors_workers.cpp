@@ -8,6 +8,7 @@
 #include "td/actor/ConcurrentScheduler.h"
 
 #include "td/utils/common.h"
+#include "td/utils/logging.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/tests.h"
 #include "td/utils/Time.h"
@@ -25,8 +26,9 @@ class PowerWorker final : public td::Actor {
     virtual void on_ready(int query, int res) = 0;
     virtual void on_closed() = 0;
   };
-  void set_callback(td::unique_ptr<Callback> callback) {
+  void set_callback(td::unique_ptr<Callback> callback, bool is_migratable) {
     callback_ = std::move(callback);
+    set_migratable(is_migratable);
   }
   void task(td::uint32 x, td::uint32 p) {
     td::uint32 res = 1;
@@ -46,11 +48,12 @@ class PowerWorker final : public td::Actor {
 
 class Manager final : public td::Actor {
  public:
-  Manager(int queries_n, int query_size, td::vector<td::ActorId<PowerWorker>> workers)
+  Manager(int queries_n, int query_size, td::vector<td::ActorId<PowerWorker>> workers, bool are_workers_migratable)
       : workers_(std::move(workers))
       , ref_cnt_(static_cast<int>(workers_.size()))
       , left_query_(queries_n)
-      , query_size_(query_size) {
+      , query_size_(query_size)
+      , are_workers_migratable_(are_workers_migratable) {
   }
 
   class Callback final : public PowerWorker::Callback {
@@ -73,7 +76,8 @@ class Manager final : public td::Actor {
     int i = 0;
     for (auto &worker : workers_) {
       ref_cnt_++;
-      td::send_closure_later(worker, &PowerWorker::set_callback, td::make_unique<Callback>(actor_id(this), i));
+      td::send_closure_later(worker, &PowerWorker::set_callback, td::make_unique<Callback>(actor_id(this), i),
+                             are_workers_migratable_);
       i++;
       td::send_closure_later(worker, &PowerWorker::task, 3, query_size_);
       left_query_--;
@@ -81,6 +85,11 @@ class Manager final : public td::Actor {
   }
 
   void on_ready(int worker_id, int query, int res) {
+    td::uint32 expected_res = 1;
+    for (int i = 0; i < query_size_; i++) {
+      expected_res *= static_cast<td::uint32>(query);
+    }
+    CHECK(static_cast<td::uint32>(res) == expected_res);
     ref_cnt_--;
     if (left_query_ == 0) {
       td::send_closure(workers_[worker_id], &PowerWorker::close);
@@ -104,23 +113,46 @@ class Manager final : public td::Actor {
   int ref_cnt_;
   int left_query_;
   int query_size_;
+  bool are_workers_migratable_;
 };
 
-static void test_workers(int threads_n, int workers_n, int queries_n, int query_size) {
+static void test_workers(int threads_n, int workers_n, int queries_n, int query_size, bool use_work_stealing = false,
+                         bool use_busy_poll = false) {
   td::ConcurrentScheduler sched(threads_n, 0);
+  if (use_work_stealing) {
+    sched.enable_work_stealing();
+  }
+  if (use_busy_poll) {
+    sched.set_busy_poll_duration(1e-4);
+  }
 
   td::vector<td::ActorId<PowerWorker>> workers;
   for (int i = 0; i < workers_n; i++) {
-    int thread_id = threads_n ? i % (threads_n - 1) + 2 : 0;
+    // with work stealing all workers are created on the same scheduler and must be spread by idle schedulers
+    int thread_id = threads_n ? (use_work_stealing ? 2 : i % (threads_n - 1) + 2) : 0;
     workers.push_back(sched.create_actor_unsafe<PowerWorker>(thread_id, PSLICE() << "worker" << i).release());
   }
-  sched.create_actor_unsafe<Manager>(threads_n ? 1 : 0, "Manager", queries_n, query_size, std::move(workers)).release();
+  sched
+      .create_actor_unsafe<Manager>(threads_n ? 1 : 0, "Manager", queries_n, query_size, std::move(workers),
+                                    use_work_stealing)
+      .release();
 
   sched.start();
   while (sched.run_main(10)) {
     // empty
   }
+  auto outbound_event_stats = sched.get_outbound_event_stats();
+  if (threads_n != 0) {
+    CHECK(outbound_event_stats.flush_count > 0);
+    CHECK(outbound_event_stats.flush_count <= outbound_event_stats.event_count);
+  }
   sched.finish();
+  if (use_work_stealing) {
+    // all workers are created on the same scheduler, so the other schedulers must take some of them
+    auto stolen_actor_count = sched.get_stolen_actor_count();
+    LOG(INFO) << "Stolen actors: " << stolen_actor_count;
+    ASSERT_TRUE(stolen_actor_count > 0);
+  }
 
   // sched.test_one_thread_run();
 }
@@ -149,6 +181,18 @@ TEST(Actors, workers_small_query_nine_threads) {
   test_workers(9, 10, 10000, 1);
 }
 
+TEST(Actors, workers_big_query_work_stealing) {
+  test_workers(4, 10, 1000, 300000, true);
+}
+
+TEST(Actors, workers_small_query_work_stealing) {
+  test_workers(4, 10, 100000, 1, true);
+}
+
+TEST(Actors, workers_small_query_busy_poll) {
+  test_workers(2, 10, 100000, 1, false, true);
+}
+
 class SenderActor;
 
 class ReceiverActor final : public td::Actor {
@@ -11,7 +11,6 @@
 #include "td/db/DbKey.h"
 #include "td/db/KeyValueSyncInterface.h"
 
-#include "td/utils/algorithm.h"
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
 #include "td/utils/HashTableUtils.h"
@@ -25,6 +24,8 @@
 #include "td/utils/tl_parsers.h"
 #include "td/utils/tl_storers.h"
 
+#include <array>
+#include <map>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -81,9 +82,7 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
     TRY_STATUS(binlog_->init(
         name,
         [&](const BinlogEvent &binlog_event) {
-          Event event;
-          event.parse(TlParser(binlog_event.get_data()));
-          map_.emplace(event.key.str(), std::make_pair(event.value.str(), binlog_event.id_));
+          external_init_handle(binlog_event);
         },
         std::move(db_key), DbKey::empty(), scheduler_id));
     return Status::OK();
@@ -98,13 +97,16 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
 
   template <class OtherBinlogT>
   void external_init_handle(BinlogKeyValue<OtherBinlogT> &&other) {
-    map_ = std::move(other.map_);
+    for (size_t i = 0; i < SHARD_COUNT; i++) {
+      shards_[i].map_ = std::move(other.shards_[i].map_);
+    }
   }
 
   void external_init_handle(const BinlogEvent &binlog_event) {
     Event event;
     event.parse(TlParser(binlog_event.get_data()));
-    map_.emplace(event.key.str(), std::make_pair(event.value.str(), binlog_event.id_));
+    auto key = event.key.str();
+    get_shard(key).map_.emplace(std::move(key), std::make_pair(event.value.str(), binlog_event.id_));
   }
 
   void external_init_finish(std::shared_ptr<BinlogT> binlog) {
@@ -119,9 +121,10 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
   }
 
   SeqNo set(string key, string value) final {
-    auto lock = rw_mutex_.lock_write().move_as_ok();
+    auto &shard = get_shard(key);
+    auto lock = shard.rw_mutex_.lock_write().move_as_ok();
     uint64 old_event_id = 0;
-    auto it_ok = map_.emplace(key, std::make_pair(value, 0));
+    auto it_ok = shard.map_.emplace(key, std::make_pair(value, 0));
     if (!it_ok.second) {
       if (it_ok.first->second.first == value) {
         return 0;
@@ -151,14 +154,15 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
   }
 
   SeqNo erase(const string &key) final {
-    auto lock = rw_mutex_.lock_write().move_as_ok();
-    auto it = map_.find(key);
-    if (it == map_.end()) {
+    auto &shard = get_shard(key);
+    auto lock = shard.rw_mutex_.lock_write().move_as_ok();
+    auto it = shard.map_.find(key);
+    if (it == shard.map_.end()) {
       return 0;
     }
     VLOG(binlog) << "Remove value of key " << key << ", which is " << hex_encode(it->second.first);
     uint64 event_id = it->second.second;
-    map_.erase(it);
+    shard.map_.erase(it);
     auto seq_no = binlog_->next_event_id();
     lock.reset();
     add_event(seq_no, BinlogEvent::create_raw(event_id, BinlogEvent::ServiceTypes::Empty, BinlogEvent::Flags::Rewrite,
@@ -167,13 +171,24 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
   }
 
   SeqNo erase_batch(vector<string> keys) final {
-    auto lock = rw_mutex_.lock_write().move_as_ok();
+    // all affected shards are locked in the same order to avoid deadlocks
+    std::array<bool, SHARD_COUNT> is_shard_used{};
+    for (auto &key : keys) {
+      is_shard_used[get_shard_id(key)] = true;
+    }
+    vector<RwMutex::WriteLock> locks;
+    for (size_t i = 0; i < SHARD_COUNT; i++) {
+      if (is_shard_used[i]) {
+        locks.push_back(shards_[i].rw_mutex_.lock_write().move_as_ok());
+      }
+    }
     vector<uint64> log_event_ids;
     for (auto &key : keys) {
-      auto it = map_.find(key);
-      if (it != map_.end()) {
+      auto &map = get_shard(key).map_;
+      auto it = map.find(key);
+      if (it != map.end()) {
         log_event_ids.push_back(it->second.second);
-        map_.erase(it);
+        map.erase(it);
       }
     }
     if (log_event_ids.empty()) {
@@ -188,14 +203,16 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
   }
 
   bool isset(const string &key) final {
-    auto lock = rw_mutex_.lock_read().move_as_ok();
-    return map_.count(key) > 0;
+    auto &shard = get_shard(key);
+    auto lock = shard.rw_mutex_.lock_read().move_as_ok();
+    return shard.map_.count(key) > 0;
   }
 
   string get(const string &key) final {
-    auto lock = rw_mutex_.lock_read().move_as_ok();
-    auto it = map_.find(key);
-    if (it == map_.end()) {
+    auto &shard = get_shard(key);
+    auto lock = shard.rw_mutex_.lock_read().move_as_ok();
+    auto it = shard.map_.find(key);
+    if (it == shard.map_.end()) {
       return string();
     }
     VLOG(binlog) << "Get value of key " << key << ", which is " << hex_encode(it->second.first);
@@ -211,41 +228,51 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
   }
 
   std::unordered_map<string, string, Hash<string>> prefix_get(Slice prefix) final {
-    auto lock = rw_mutex_.lock_write().move_as_ok();
+    auto prefix_str = prefix.str();
     std::unordered_map<string, string, Hash<string>> res;
-    for (const auto &kv : map_) {
-      if (begins_with(kv.first, prefix)) {
-        res.emplace(kv.first.substr(prefix.size()), kv.second.first);
+    for (auto &shard : shards_) {
+      auto lock = shard.rw_mutex_.lock_read().move_as_ok();
+      for (auto it = shard.map_.lower_bound(prefix_str); it != shard.map_.end() && begins_with(it->first, prefix);
+           ++it) {
+        res.emplace(it->first.substr(prefix.size()), it->second.first);
       }
     }
     return res;
   }
 
   std::unordered_map<string, string, Hash<string>> get_all() final {
-    auto lock = rw_mutex_.lock_write().move_as_ok();
     std::unordered_map<string, string, Hash<string>> res;
-    for (const auto &kv : map_) {
-      res.emplace(kv.first, kv.second.first);
+    for (auto &shard : shards_) {
+      auto lock = shard.rw_mutex_.lock_read().move_as_ok();
+      for (const auto &kv : shard.map_) {
+        res.emplace(kv.first, kv.second.first);
+      }
     }
     return res;
   }
 
   void erase_by_prefix(Slice prefix) final {
-    auto lock = rw_mutex_.lock_write().move_as_ok();
-    vector<uint64> event_ids;
-    table_remove_if(map_, [&](const auto &it) {
-      if (begins_with(it.first, prefix)) {
-        event_ids.push_back(it.second.second);
-        return true;
+    auto prefix_str = prefix.str();
+    for (auto &shard : shards_) {
+      auto lock = shard.rw_mutex_.lock_write().move_as_ok();
+      vector<uint64> event_ids;
+      auto begin = shard.map_.lower_bound(prefix_str);
+      auto end = begin;
+      while (end != shard.map_.end() && begins_with(end->first, prefix)) {
+        event_ids.push_back(end->second.second);
+        ++end;
+      }
+      if (event_ids.empty()) {
+        continue;
+      }
+      shard.map_.erase(begin, end);
+      auto seq_no = binlog_->next_event_id(narrow_cast<int32>(event_ids.size()));
+      lock.reset();
+      for (auto event_id : event_ids) {
+        add_event(seq_no, BinlogEvent::create_raw(event_id, BinlogEvent::ServiceTypes::Empty,
+                                                  BinlogEvent::Flags::Rewrite, EmptyStorer()));
+        seq_no++;
       }
-      return false;
-    });
-    auto seq_no = binlog_->next_event_id(narrow_cast<int32>(event_ids.size()));
-    lock.reset();
-    for (auto event_id : event_ids) {
-      add_event(seq_no, BinlogEvent::create_raw(event_id, BinlogEvent::ServiceTypes::Empty, BinlogEvent::Flags::Rewrite,
-                                                EmptyStorer()));
-      seq_no++;
     }
   }
   template <class T>
@@ -256,10 +283,25 @@ class BinlogKeyValue final : public KeyValueSyncInterface {
   }
 
  private:
-  std::unordered_map<string, std::pair<string, uint64>, Hash<string>> map_;
+  // keys are distributed between shards to reduce lock contention and are sorted for fast prefix queries
+  static constexpr size_t SHARD_COUNT = 16;
+
+  struct Shard {
+    std::map<string, std::pair<string, uint64>> map_;
+    RwMutex rw_mutex_;
+  };
+
+  std::array<Shard, SHARD_COUNT> shards_;
   std::shared_ptr<BinlogT> binlog_;
-  RwMutex rw_mutex_;
   int32 magic_ = MAGIC;
+
+  static size_t get_shard_id(const string &key) {
+    return Hash<string>()(key) % SHARD_COUNT;
+  }
+
+  Shard &get_shard(const string &key) {
+    return shards_[get_shard_id(key)];
+  }
 };
 
 template <>
@@ -0,0 +1,172 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/db/SqliteCheckpointer.h"
+
+#include "td/db/SqliteDb.h"
+
+#include "td/utils/logging.h"
+#include "td/utils/port/Stat.h"
+#include "td/utils/SliceBuilder.h"
+#include "td/utils/Time.h"
+
+#include <atomic>
+
+namespace td {
+
+struct SqliteCheckpointer::Counters {
+  std::atomic<uint64> checkpoint_count{0};
+  std::atomic<uint64> truncate_count{0};
+  std::atomic<uint64> busy_count{0};
+  std::atomic<uint64> total_duration_us{0};
+  std::atomic<uint64> max_duration_us{0};
+  std::atomic<uint64> last_duration_us{0};
+  std::atomic<int64> wal_frame_count{0};
+  std::atomic<int64> wal_size{0};
+};
+
+class SqliteCheckpointer::Impl final : public Actor {
+ public:
+  Impl(std::shared_ptr<SqliteConnectionSafe> connection, std::shared_ptr<Counters> counters)
+      : connection_(std::move(connection)), counters_(std::move(counters)) {
+  }
+
+  void close(Promise<Unit> promise) {
+    connection_->set_commit_callback(nullptr);
+    connection_.reset();
+    stop();
+    promise.set_value(Unit());
+  }
+
+ private:
+  static constexpr double CHECKPOINT_PERIOD = 1.0;
+  static constexpr int32 IDLE_PERIODS_BEFORE_TRUNCATE = 5;
+  static constexpr int32 DEFAULT_WAL_AUTOCHECKPOINT = 1000;
+
+  std::shared_ptr<SqliteConnectionSafe> connection_;
+  std::shared_ptr<Counters> counters_;
+  // set by writers after a commit and cleared by the checkpointer before a checkpoint
+  std::shared_ptr<std::atomic<bool>> has_commits_ = std::make_shared<std::atomic<bool>>(true);
+  int64 page_size_ = 4096;
+  int32 idle_period_count_ = 0;
+
+  void start_up() final {
+    auto r_page_size = connection_->get().get_pragma_int64("page_size");
+    if (r_page_size.is_ok()) {
+      page_size_ = r_page_size.ok();
+    }
+    connection_->set_commit_callback([actor_id = actor_id(this), has_commits = has_commits_] {
+      if (!has_commits->exchange(true, std::memory_order_relaxed)) {
+        send_closure(actor_id, &Impl::on_commit);
+      }
+    });
+
+    // WAL could have been left by the previous run
+    set_timeout_in(CHECKPOINT_PERIOD);
+  }
+
+  void on_commit() {
+    idle_period_count_ = 0;
+    if (!has_timeout()) {
+      set_timeout_in(CHECKPOINT_PERIOD);
+    }
+  }
+
+  void timeout_expired() final {
+    auto &db = connection_->get();
+    auto wal_size = get_wal_size();
+    counters_->wal_size.store(wal_size, std::memory_order_relaxed);
+
+    if (has_commits_->exchange(false, std::memory_order_relaxed)) {
+      idle_period_count_ = 0;
+      checkpoint(db, false);
+      set_timeout_in(CHECKPOINT_PERIOD);
+      return;
+    }
+
+    if (++idle_period_count_ < IDLE_PERIODS_BEFORE_TRUNCATE) {
+      set_timeout_in(CHECKPOINT_PERIOD);
+      return;
+    }
+    auto wal_autocheckpoint = connection_->get_options().wal_autocheckpoint;
+    if (wal_autocheckpoint <= 0) {
+      wal_autocheckpoint = DEFAULT_WAL_AUTOCHECKPOINT;
+    }
+    if (wal_size > wal_autocheckpoint * page_size_) {
+      // the database is idle, so nobody will wait for the checkpoint
+      checkpoint(db, true);
+      counters_->wal_size.store(get_wal_size(), std::memory_order_relaxed);
+    }
+    // the timer is restarted by the next commit
+  }
+
+  void checkpoint(SqliteDb &db, bool truncate) {
+    auto start_time = Time::now();
+    auto r_result = db.checkpoint(truncate);
+    auto duration_us = static_cast<uint64>((Time::now() - start_time) * 1e6);
+    if (r_result.is_error()) {
+      LOG(ERROR) << "Failed to checkpoint database: " << r_result.error();
+      return;
+    }
+    auto result = r_result.move_as_ok();
+    LOG(DEBUG) << "Checkpoint " << result.checkpointed_frame_count << " out of " << result.wal_frame_count
+               << " frames in " << format::as_time(static_cast<double>(duration_us) * 1e-6)
+               << (truncate ? " with WAL truncation" : "");
+
+    auto &counters = *counters_;
+    counters.checkpoint_count.fetch_add(1, std::memory_order_relaxed);
+    if (truncate) {
+      counters.truncate_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    if (result.is_busy) {
+      counters.busy_count.fetch_add(1, std::memory_order_relaxed);
+    }
+    counters.total_duration_us.fetch_add(duration_us, std::memory_order_relaxed);
+    counters.last_duration_us.store(duration_us, std::memory_order_relaxed);
+    if (duration_us > counters.max_duration_us.load(std::memory_order_relaxed)) {
+      counters.max_duration_us.store(duration_us, std::memory_order_relaxed);
+    }
+    counters.wal_frame_count.store(result.wal_frame_count, std::memory_order_relaxed);
+  }
+
+  int64 get_wal_size() const {
+    auto r_stat = stat(PSLICE() << connection_->get_path() << "-wal");
+    if (r_stat.is_error()) {
+      return 0;
+    }
+    return r_stat.ok().size_;
+  }
+};
+
+SqliteCheckpointer::SqliteCheckpointer(std::shared_ptr<SqliteConnectionSafe> connection, int32 scheduler_id)
+    : counters_(std::make_shared<Counters>()) {
+  impl_ = create_actor_on_scheduler<Impl>("SqliteCheckpointer", scheduler_id, std::move(connection), counters_);
+}
+
+SqliteCheckpointer::~SqliteCheckpointer() = default;
+
+SqliteCheckpointer::Statistics SqliteCheckpointer::get_statistics() const {
+  Statistics result;
+  auto &counters = *counters_;
+  result.checkpoint_count = counters.checkpoint_count.load(std::memory_order_relaxed);
+  result.truncate_count = counters.truncate_count.load(std::memory_order_relaxed);
+  result.busy_count = counters.busy_count.load(std::memory_order_relaxed);
+  result.max_duration = static_cast<double>(counters.max_duration_us.load(std::memory_order_relaxed)) * 1e-6;
+  result.last_duration = static_cast<double>(counters.last_duration_us.load(std::memory_order_relaxed)) * 1e-6;
+  if (result.checkpoint_count > 0) {
+    result.average_duration = static_cast<double>(counters.total_duration_us.load(std::memory_order_relaxed)) *
+                              1e-6 / static_cast<double>(result.checkpoint_count);
+  }
+  result.wal_frame_count = counters.wal_frame_count.load(std::memory_order_relaxed);
+  result.wal_size = counters.wal_size.load(std::memory_order_relaxed);
+  return result;
+}
+
+void SqliteCheckpointer::close(Promise<Unit> promise) {
+  send_closure(impl_.release(), &Impl::close, std::move(promise));
+}
+
+}  // namespace td
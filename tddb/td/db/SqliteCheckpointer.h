@@ -0,0 +1,70 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/db/SqliteConnectionSafe.h"
+
+#include "td/actor/actor.h"
+
+#include "td/utils/common.h"
+#include "td/utils/format.h"
+#include "td/utils/Promise.h"
+#include "td/utils/StringBuilder.h"
+
+#include <memory>
+
+namespace td {
+
+// Checkpoints WAL of an SQLite database on a separate scheduler, so writers don't need to do this inline.
+// Writers wake up the checkpointer after commits, and a passive checkpoint is done not more often than once per
+// CHECKPOINT_PERIOD. When the database becomes idle, WAL bigger than the connection wal_autocheckpoint option
+// is truncated and the checkpointer sleeps until the next commit.
+// The connection must have the use_background_checkpoint option enabled.
+class SqliteCheckpointer {
+ public:
+  struct Statistics {
+    uint64 checkpoint_count = 0;
+    uint64 truncate_count = 0;
+    uint64 busy_count = 0;
+    double average_duration = 0;
+    double max_duration = 0;
+    double last_duration = 0;
+    int64 wal_frame_count = 0;
+    int64 wal_size = 0;
+  };
+
+  SqliteCheckpointer(std::shared_ptr<SqliteConnectionSafe> connection, int32 scheduler_id);
+  SqliteCheckpointer(const SqliteCheckpointer &) = delete;
+  SqliteCheckpointer &operator=(const SqliteCheckpointer &) = delete;
+  SqliteCheckpointer(SqliteCheckpointer &&) = delete;
+  SqliteCheckpointer &operator=(SqliteCheckpointer &&) = delete;
+  ~SqliteCheckpointer();
+
+  Statistics get_statistics() const;
+
+  // the connection is released before the promise is set
+  void close(Promise<Unit> promise);
+
+ private:
+  struct Counters;
+  class Impl;
+
+  std::shared_ptr<Counters> counters_;
+  ActorOwn<Impl> impl_;
+};
+
+inline StringBuilder &operator<<(StringBuilder &string_builder, const SqliteCheckpointer::Statistics &statistics) {
+  return string_builder << "SqliteCheckpointer[" << tag("checkpoints", statistics.checkpoint_count)
+                        << tag("truncates", statistics.truncate_count) << tag("busy", statistics.busy_count)
+                        << tag("average_duration", format::as_time(statistics.average_duration))
+                        << tag("max_duration", format::as_time(statistics.max_duration))
+                        << tag("last_duration", format::as_time(statistics.last_duration))
+                        << tag("wal_frames", statistics.wal_frame_count)
+                        << tag("wal_size", format::as_size(statistics.wal_size)) << ']';
+}
+
+}  // namespace td
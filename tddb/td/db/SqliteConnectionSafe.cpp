@@ -9,12 +9,13 @@
 #include "td/utils/common.h"
 #include "td/utils/format.h"
 #include "td/utils/logging.h"
+#include "td/utils/SliceBuilder.h"
 
 namespace td {
 
 SqliteConnectionSafe::SqliteConnectionSafe(string path, DbKey key, optional<int32> cipher_version)
     : path_(std::move(path))
-    , lsls_connection_([path = path_, close_state_ptr = &close_state_, key = std::move(key),
+    , lsls_connection_([this, path = path_, close_state_ptr = &close_state_, key = std::move(key),
                         cipher_version = std::move(cipher_version)] {
       auto r_db = SqliteDb::open_with_key(path, false, key, cipher_version.copy());
       if (r_db.is_error()) {
@@ -23,6 +24,7 @@ SqliteConnectionSafe::SqliteConnectionSafe(string path, DbKey key, optional<int3
       auto db = r_db.move_as_ok();
       db.exec("PRAGMA journal_mode=WAL").ensure();
       db.exec("PRAGMA secure_delete=1").ensure();
+      apply_options(db).ensure();
       return db;
     }) {
 }
@@ -35,6 +37,49 @@ SqliteDb &SqliteConnectionSafe::get() {
   return lsls_connection_.get();
 }
 
+void SqliteConnectionSafe::set_options(const Options &options) {
+  auto guard = options_mutex_.lock();
+  options_ = options;
+}
+
+SqliteConnectionSafe::Options SqliteConnectionSafe::get_options() const {
+  auto guard = options_mutex_.lock();
+  return options_;
+}
+
+Status SqliteConnectionSafe::apply_options(SqliteDb &db) {
+  auto options = get_options();
+  if (options.mmap_size >= 0) {
+    TRY_STATUS(db.exec(PSLICE() << "PRAGMA mmap_size=" << options.mmap_size));
+  }
+  if (options.cache_size > 0) {
+    // negative value means size in KiB instead of number of pages
+    TRY_STATUS(db.exec(PSLICE() << "PRAGMA cache_size=" << -options.cache_size));
+  }
+  if (options.use_background_checkpoint) {
+    // writers checkpoint WAL only if the background checkpointer falls far behind
+    constexpr int32 DEFAULT_WAL_AUTOCHECKPOINT = 1000;
+    constexpr int32 BACKGROUND_CHECKPOINT_FALLBACK_FACTOR = 8;
+    auto wal_autocheckpoint = options.wal_autocheckpoint > 0 ? options.wal_autocheckpoint : DEFAULT_WAL_AUTOCHECKPOINT;
+    db.set_wal_commit_callback(
+        [this] {
+          auto guard = commit_callback_mutex_.lock();
+          if (commit_callback_) {
+            commit_callback_();
+          }
+        },
+        wal_autocheckpoint * BACKGROUND_CHECKPOINT_FALLBACK_FACTOR);
+  } else if (options.wal_autocheckpoint >= 0) {
+    TRY_STATUS(db.exec(PSLICE() << "PRAGMA wal_autocheckpoint=" << options.wal_autocheckpoint));
+  }
+  return Status::OK();
+}
+
+void SqliteConnectionSafe::set_commit_callback(std::function<void()> callback) {
+  auto guard = commit_callback_mutex_.lock();
+  commit_callback_ = std::move(callback);
+}
+
 void SqliteConnectionSafe::close() {
   LOG(INFO) << "Close SQLite database " << tag("path", path_);
   close_state_++;
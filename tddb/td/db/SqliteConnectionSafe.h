@@ -13,19 +13,45 @@
 
 #include "td/utils/common.h"
 #include "td/utils/optional.h"
+#include "td/utils/port/Mutex.h"
+#include "td/utils/Slice.h"
+#include "td/utils/Status.h"
 
 #include <atomic>
+#include <functional>
 
 namespace td {
 
 class SqliteConnectionSafe {
  public:
+  struct Options {
+    int64 mmap_size = -1;                    // maximum size of memory-mapped I/O in bytes; -1 - SQLite default
+    int64 cache_size = 0;                    // page cache size in KiB; 0 - SQLite default
+    int32 wal_autocheckpoint = -1;           // WAL size in pages, after which it is checkpointed; -1 - SQLite default
+    bool use_background_checkpoint = false;  // WAL is checkpointed by SqliteCheckpointer instead of the writers
+  };
+
   SqliteConnectionSafe() = default;
   SqliteConnectionSafe(string path, DbKey key, optional<int32> cipher_version = {});
 
   SqliteDb &get();
   void set(SqliteDb &&db);
 
+  CSlice get_path() const {
+    return path_;
+  }
+
+  // options are applied to the connections, which are opened after the call,
+  // and to already opened connections after a call to apply_options on their schedulers
+  void set_options(const Options &options);
+  Options get_options() const;
+
+  Status apply_options(SqliteDb &db) TD_WARN_UNUSED_RESULT;
+
+  // if use_background_checkpoint is enabled, the callback is called by writers after every commit to WAL;
+  // it is called concurrently from different schedulers and must be fast
+  void set_commit_callback(std::function<void()> callback);
+
   void close();
 
   void close_and_destroy();
@@ -33,6 +59,10 @@ class SqliteConnectionSafe {
  private:
   string path_;
   std::atomic<uint32> close_state_{0};
+  mutable Mutex options_mutex_;
+  Options options_;
+  Mutex commit_callback_mutex_;
+  std::function<void()> commit_callback_;
   LazySchedulerLocalStorage<SqliteDb> lsls_connection_;
 };
 
@@ -15,6 +15,7 @@
 #include "td/utils/Status.h"
 #include "td/utils/StringBuilder.h"
 #include "td/utils/Timer.h"
+#include "td/utils/Tracer.h"
 
 #include "sqlite/sqlite3.h"
 
@@ -124,7 +125,14 @@ Status SqliteDb::exec(CSlice cmd) {
   if (enable_logging_) {
     VLOG(sqlite) << "Start exec " << tag("query", cmd) << tag("database", raw_->db());
   }
+  bool is_traced = Tracer::is_enabled();
+  if (unlikely(is_traced)) {
+    Tracer::begin("db", detail::RawSqliteDb::get_sql_keyword(cmd));
+  }
   auto rc = tdsqlite3_exec(raw_->db(), cmd.c_str(), nullptr, nullptr, &msg);
+  if (unlikely(is_traced)) {
+    Tracer::end("db", detail::RawSqliteDb::get_sql_keyword(cmd));
+  }
   if (rc != SQLITE_OK) {
     CHECK(msg != nullptr);
     if (enable_logging_) {
@@ -140,8 +148,8 @@ Status SqliteDb::exec(CSlice cmd) {
 }
 
 Result<bool> SqliteDb::has_table(Slice table) {
-  TRY_RESULT(stmt, get_statement(PSLICE() << "SELECT count(*) FROM sqlite_master WHERE type='table' AND name='" << table
-                                          << "'"));
+  TRY_RESULT(stmt, get_cached_statement("SELECT count(*) FROM sqlite_master WHERE type='table' AND name=?1"));
+  TRY_STATUS(stmt.bind_string(1, table));
   TRY_STATUS(stmt.step());
   CHECK(stmt.has_row());
   auto cnt = stmt.view_int32(0);
@@ -149,7 +157,7 @@ Result<bool> SqliteDb::has_table(Slice table) {
 }
 
 Result<string> SqliteDb::get_pragma(Slice name) {
-  TRY_RESULT(stmt, get_statement(PSLICE() << "PRAGMA " << name));
+  TRY_RESULT(stmt, get_cached_statement(PSLICE() << "PRAGMA " << name));
   TRY_STATUS(stmt.step());
   CHECK(stmt.has_row());
   auto res = stmt.view_blob(0).str();
@@ -159,7 +167,7 @@ Result<string> SqliteDb::get_pragma(Slice name) {
 }
 
 Result<string> SqliteDb::get_pragma_string(Slice name) {
-  TRY_RESULT(stmt, get_statement(PSLICE() << "PRAGMA " << name));
+  TRY_RESULT(stmt, get_cached_statement(PSLICE() << "PRAGMA " << name));
   TRY_STATUS(stmt.step());
   CHECK(stmt.has_row());
   auto res = stmt.view_string(0).str();
@@ -168,8 +176,17 @@ Result<string> SqliteDb::get_pragma_string(Slice name) {
   return std::move(res);
 }
 
+Result<int64> SqliteDb::get_pragma_int64(Slice name) {
+  TRY_RESULT(stmt, get_cached_statement(PSLICE() << "PRAGMA " << name));
+  TRY_STATUS(stmt.step());
+  if (!stmt.has_row()) {
+    return Status::Error(PSLICE() << "PRAGMA " << name << " returned nothing for database \"" << raw_->path() << '"');
+  }
+  return stmt.view_int64(0);
+}
+
 Result<int32> SqliteDb::user_version() {
-  TRY_RESULT(get_version_stmt, get_statement("PRAGMA user_version"));
+  TRY_RESULT(get_version_stmt, get_cached_statement("PRAGMA user_version"));
   TRY_STATUS(get_version_stmt.step());
   if (!get_version_stmt.has_row()) {
     return Status::Error(PSLICE() << "PRAGMA user_version failed for database \"" << raw_->path() << '"');
@@ -181,16 +198,42 @@ Status SqliteDb::set_user_version(int32 version) {
   return exec(PSLICE() << "PRAGMA user_version = " << version);
 }
 
+Result<SqliteDb::CheckpointResult> SqliteDb::checkpoint(bool truncate) {
+  TRY_RESULT(stmt, get_cached_statement(truncate ? CSlice("PRAGMA wal_checkpoint(TRUNCATE)")
+                                                 : CSlice("PRAGMA wal_checkpoint(PASSIVE)")));
+  TRY_STATUS(stmt.step());
+  if (!stmt.has_row()) {
+    return Status::Error(PSLICE() << "PRAGMA wal_checkpoint failed for database \"" << raw_->path() << '"');
+  }
+  CheckpointResult result;
+  result.is_busy = stmt.view_int32(0) != 0;
+  result.wal_frame_count = stmt.view_int32(1);
+  result.checkpointed_frame_count = stmt.view_int32(2);
+  return result;
+}
+
+static int wal_hook_callback(void *raw, tdsqlite3 *db, const char *db_name, int wal_frame_count) {
+  if (static_cast<detail::RawSqliteDb *>(raw)->on_wal_commit(wal_frame_count)) {
+    tdsqlite3_wal_checkpoint(db, db_name);
+  }
+  return SQLITE_OK;
+}
+
+void SqliteDb::set_wal_commit_callback(std::function<void()> callback, int32 autocheckpoint_frame_count) {
+  raw_->set_wal_commit_callback(std::move(callback), autocheckpoint_frame_count);
+  tdsqlite3_wal_hook(raw_->db(), wal_hook_callback, raw_.get());
+}
+
 Status SqliteDb::begin_read_transaction() {
   if (raw_->on_begin()) {
-    return exec("BEGIN");
+    return exec_cached("BEGIN");
   }
   return Status::OK();
 }
 
 Status SqliteDb::begin_write_transaction() {
   if (raw_->on_begin()) {
-    return exec("BEGIN IMMEDIATE");
+    return exec_cached("BEGIN IMMEDIATE");
   }
   return Status::OK();
 }
@@ -198,11 +241,21 @@ Status SqliteDb::begin_write_transaction() {
 Status SqliteDb::commit_transaction() {
   TRY_RESULT(need_commit, raw_->on_commit());
   if (need_commit) {
-    return exec("COMMIT");
+    return exec_cached("COMMIT");
   }
   return Status::OK();
 }
 
+Status SqliteDb::exec_cached(CSlice cmd) {
+  TRY_RESULT(stmt, get_cached_statement(cmd));
+  while (true) {
+    TRY_STATUS(stmt.step());
+    if (!stmt.can_step()) {
+      return Status::OK();
+    }
+  }
+}
+
 Status SqliteDb::check_encryption() {
   auto status = exec("SELECT count(*) FROM sqlite_master");
   if (status.is_ok()) {
@@ -309,7 +362,7 @@ Status SqliteDb::destroy(Slice path) {
   return detail::RawSqliteDb::destroy(path);
 }
 
-Result<SqliteStatement> SqliteDb::get_statement(CSlice statement) {
+Result<tdsqlite3_stmt *> SqliteDb::prepare_statement(CSlice statement) {
   tdsqlite3_stmt *stmt = nullptr;
   auto rc =
       tdsqlite3_prepare_v2(get_native(), statement.c_str(), static_cast<int>(statement.size()) + 1, &stmt, nullptr);
@@ -317,7 +370,35 @@ Result<SqliteStatement> SqliteDb::get_statement(CSlice statement) {
     return Status::Error(PSLICE() << "Failed to prepare SQLite " << tag("statement", statement) << raw_->last_error());
   }
   LOG_CHECK(stmt != nullptr) << statement;
+  return stmt;
+}
+
+Result<SqliteStatement> SqliteDb::get_statement(CSlice statement) {
+  TRY_RESULT(stmt, prepare_statement(statement));
   return SqliteStatement(stmt, raw_);
 }
 
+Result<SqliteStatement> SqliteDb::get_cached_statement(CSlice statement) {
+  CHECK(!statement.empty());
+  auto sql = statement.str();
+  auto *stmt = raw_->get_cached_statement(sql);
+  if (stmt == nullptr) {
+    TRY_RESULT_ASSIGN(stmt, prepare_statement(statement));
+  }
+  return SqliteStatement(stmt, raw_, std::move(sql));
+}
+
+SqliteDb::StatementCacheStatistics SqliteDb::get_statement_cache_statistics() const {
+  StatementCacheStatistics result;
+  result.hit_count = raw_->get_statement_cache_hit_count();
+  result.miss_count = raw_->get_statement_cache_miss_count();
+  result.size = raw_->get_cached_statement_count();
+  return result;
+}
+
+StringBuilder &operator<<(StringBuilder &string_builder, const SqliteDb::StatementCacheStatistics &statistics) {
+  return string_builder << "SqliteStatementCache[" << tag("hits", statistics.hit_count)
+                        << tag("misses", statistics.miss_count) << tag("size", statistics.size) << ']';
+}
+
 }  // namespace td
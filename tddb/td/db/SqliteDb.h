@@ -11,13 +11,17 @@
 
 #include "td/db/detail/RawSqliteDb.h"
 
+#include "td/utils/common.h"
 #include "td/utils/optional.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
+#include "td/utils/StringBuilder.h"
 
+#include <functional>
 #include <memory>
 
 struct tdsqlite3;
+struct tdsqlite3_stmt;
 
 namespace td {
 
@@ -46,6 +50,7 @@ class SqliteDb {
   Result<bool> has_table(Slice table);
   Result<string> get_pragma(Slice name);
   Result<string> get_pragma_string(Slice name);
+  Result<int64> get_pragma_int64(Slice name);
 
   Status begin_read_transaction() TD_WARN_UNUSED_RESULT;
   Status begin_write_transaction() TD_WARN_UNUSED_RESULT;
@@ -55,6 +60,18 @@ class SqliteDb {
   Status set_user_version(int32 version) TD_WARN_UNUSED_RESULT;
   void trace(bool flag);
 
+  struct CheckpointResult {
+    bool is_busy = false;
+    int32 wal_frame_count = 0;
+    int32 checkpointed_frame_count = 0;
+  };
+  // runs a passive WAL checkpoint, or a truncating checkpoint, which waits for readers and writers
+  Result<CheckpointResult> checkpoint(bool truncate);
+
+  // replaces automatic WAL checkpoints: the callback is called by the writer after every commit to WAL,
+  // and the writer checkpoints WAL itself only if it has at least autocheckpoint_frame_count frames
+  void set_wal_commit_callback(std::function<void()> callback, int32 autocheckpoint_frame_count);
+
   static Status destroy(Slice path) TD_WARN_UNUSED_RESULT;
 
   // we can't change the key on the fly, so static functions are more than enough
@@ -69,6 +86,17 @@ class SqliteDb {
 
   Result<SqliteStatement> get_statement(CSlice statement) TD_WARN_UNUSED_RESULT;
 
+  // returns a statement from the LRU cache of prepared statements of the connection;
+  // the statement is reset and returned to the cache when destroyed
+  Result<SqliteStatement> get_cached_statement(CSlice statement) TD_WARN_UNUSED_RESULT;
+
+  struct StatementCacheStatistics {
+    uint64 hit_count = 0;
+    uint64 miss_count = 0;
+    size_t size = 0;
+  };
+  StatementCacheStatistics get_statement_cache_statistics() const;
+
   template <class F>
   static void with_db_path(Slice main_path, F &&f) {
     detail::RawSqliteDb::with_db_path(main_path, f);
@@ -86,8 +114,12 @@ class SqliteDb {
   Status init(CSlice path, bool allow_creation) TD_WARN_UNUSED_RESULT;
 
   Status check_encryption();
+  Status exec_cached(CSlice cmd) TD_WARN_UNUSED_RESULT;
+  Result<tdsqlite3_stmt *> prepare_statement(CSlice statement);
   static Result<SqliteDb> do_open_with_key(CSlice path, bool allow_creation, const DbKey &db_key, int32 cipher_version);
   void set_cipher_version(int32 cipher_version);
 };
 
+StringBuilder &operator<<(StringBuilder &string_builder, const SqliteDb::StatementCacheStatistics &statistics);
+
 }  // namespace td
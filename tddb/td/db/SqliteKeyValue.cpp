@@ -24,17 +24,12 @@ Status SqliteKeyValue::init_with_connection(SqliteDb connection, string table_na
                     db_.get_statement(PSLICE() << "REPLACE INTO " << table_name_ << " (k, v) VALUES (?1, ?2)"));
   TRY_RESULT_ASSIGN(get_stmt_, db_.get_statement(PSLICE() << "SELECT v FROM " << table_name_ << " WHERE k = ?1"));
   TRY_RESULT_ASSIGN(erase_stmt_, db_.get_statement(PSLICE() << "DELETE FROM " << table_name_ << " WHERE k = ?1"));
-  TRY_RESULT_ASSIGN(get_all_stmt_, db_.get_statement(PSLICE() << "SELECT k, v FROM " << table_name_));
 
   TRY_RESULT_ASSIGN(erase_by_prefix_stmt_,
                     db_.get_statement(PSLICE() << "DELETE FROM " << table_name_ << " WHERE ?1 <= k AND k < ?2"));
-  TRY_RESULT_ASSIGN(erase_by_prefix_rare_stmt_,
-                    db_.get_statement(PSLICE() << "DELETE FROM " << table_name_ << " WHERE ?1 <= k"));
 
   TRY_RESULT_ASSIGN(get_by_prefix_stmt_,
                     db_.get_statement(PSLICE() << "SELECT k, v FROM " << table_name_ << " WHERE ?1 <= k AND k < ?2"));
-  TRY_RESULT_ASSIGN(get_by_prefix_rare_stmt_,
-                    db_.get_statement(PSLICE() << "SELECT k, v FROM " << table_name_ << " WHERE ?1 <= k"));
 
   init_guard.dismiss();
   return Status::OK();
@@ -97,11 +92,9 @@ void SqliteKeyValue::erase_batch(vector<string> keys) {
 void SqliteKeyValue::erase_by_prefix(Slice prefix) {
   auto next = next_prefix(prefix);
   if (next.empty()) {
-    SCOPE_EXIT {
-      erase_by_prefix_rare_stmt_.reset();
-    };
-    erase_by_prefix_rare_stmt_.bind_blob(1, prefix).ensure();
-    erase_by_prefix_rare_stmt_.step().ensure();
+    auto stmt = get_cached_statement("DELETE FROM ", " WHERE ?1 <= k");
+    stmt.bind_blob(1, prefix).ensure();
+    stmt.step().ensure();
   } else {
     SCOPE_EXIT {
       erase_by_prefix_stmt_.reset();
@@ -112,6 +105,12 @@ void SqliteKeyValue::erase_by_prefix(Slice prefix) {
   }
 }
 
+SqliteStatement SqliteKeyValue::get_cached_statement(Slice query_prefix, Slice query_suffix) {
+  auto r_stmt = db_.get_cached_statement(PSLICE() << query_prefix << table_name_ << query_suffix);
+  LOG_IF(FATAL, r_stmt.is_error()) << "Failed to prepare statement: " << r_stmt.error();
+  return r_stmt.move_as_ok();
+}
+
 string SqliteKeyValue::next_prefix(Slice prefix) {
   string next = prefix.str();
   size_t pos = next.size();
@@ -84,13 +84,16 @@ class SqliteKeyValue {
 
   template <class CallbackT>
   void get_by_range(Slice from, Slice till, CallbackT &&callback) {
+    SqliteStatement rare_stmt;
     SqliteStatement *stmt = nullptr;
     if (from.empty()) {
-      stmt = &get_all_stmt_;
+      rare_stmt = get_cached_statement("SELECT k, v FROM ", Slice());
+      stmt = &rare_stmt;
     } else {
       if (till.empty()) {
-        stmt = &get_by_prefix_rare_stmt_;
-        stmt->bind_blob(1, till).ensure();
+        rare_stmt = get_cached_statement("SELECT k, v FROM ", " WHERE ?1 <= k");
+        stmt = &rare_stmt;
+        stmt->bind_blob(1, from).ensure();
       } else {
         stmt = &get_by_prefix_stmt_;
         stmt->bind_blob(1, from).ensure();
@@ -113,11 +116,11 @@ class SqliteKeyValue {
   SqliteStatement get_stmt_;
   SqliteStatement set_stmt_;
   SqliteStatement erase_stmt_;
-  SqliteStatement get_all_stmt_;
   SqliteStatement erase_by_prefix_stmt_;
-  SqliteStatement erase_by_prefix_rare_stmt_;
   SqliteStatement get_by_prefix_stmt_;
-  SqliteStatement get_by_prefix_rare_stmt_;
+
+  // rarely used statements are taken from the statement cache of the connection
+  SqliteStatement get_cached_statement(Slice query_prefix, Slice query_suffix);
 
   static string next_prefix(Slice prefix);
 };
@@ -7,19 +7,19 @@
 #include "td/db/SqliteKeyValueAsync.h"
 
 #include "td/db/SqliteKeyValue.h"
+#include "td/db/SqliteWriteBatcher.h"
 
 #include "td/actor/actor.h"
 
 #include "td/utils/common.h"
 #include "td/utils/optional.h"
-#include "td/utils/Time.h"
 
 namespace td {
 
 class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
  public:
   explicit SqliteKeyValueAsync(std::shared_ptr<SqliteKeyValueSafe> kv_safe, int32 scheduler_id = -1) {
-    impl_ = create_actor_on_scheduler<Impl>("KV", scheduler_id, std::move(kv_safe));
+    impl_ = create_actor_on_scheduler<Impl>("KV", scheduler_id, std::move(kv_safe), write_batcher_);
   }
   void set(string key, string value, Promise<Unit> promise) final {
     send_closure_later(impl_, &Impl::set, std::move(key), std::move(value), std::move(promise));
@@ -39,11 +39,15 @@ class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
   void close(Promise<Unit> promise) final {
     send_closure_later(impl_, &Impl::close, std::move(promise));
   }
+  SqliteWriteBatcher::Statistics get_write_statistics() const final {
+    return write_batcher_->get_statistics();
+  }
 
  private:
   class Impl final : public Actor {
    public:
-    explicit Impl(std::shared_ptr<SqliteKeyValueSafe> kv_safe) : kv_safe_(std::move(kv_safe)) {
+    Impl(std::shared_ptr<SqliteKeyValueSafe> kv_safe, std::shared_ptr<SqliteWriteBatcher> write_batcher)
+        : kv_safe_(std::move(kv_safe)), write_batcher_(std::move(write_batcher)) {
     }
 
     void set(string key, string value, Promise<Unit> promise) {
@@ -57,12 +61,11 @@ class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
       if (promise) {
         buffer_promises_.push_back(std::move(promise));
       }
-      cnt_++;
-      do_flush(false /*force*/);
+      add_write_query();
     }
 
     void set_all(FlatHashMap<string, string> key_values, Promise<Unit> promise) {
-      do_flush(true /*force*/);
+      do_flush();
       kv_->set_all(key_values);
       promise.set_value(Unit());
     }
@@ -78,12 +81,11 @@ class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
       if (promise) {
         buffer_promises_.push_back(std::move(promise));
       }
-      cnt_++;
-      do_flush(false /*force*/);
+      add_write_query();
     }
 
     void erase_by_prefix(string key_prefix, Promise<Unit> promise) {
-      do_flush(true /*force*/);
+      do_flush();
       kv_->erase_by_prefix(key_prefix);
       promise.set_value(Unit());
     }
@@ -97,7 +99,7 @@ class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
     }
 
     void close(Promise<Unit> promise) {
-      do_flush(true /*force*/);
+      do_flush();
       kv_safe_.reset();
       kv_ = nullptr;
       stop();
@@ -108,53 +110,48 @@ class SqliteKeyValueAsync final : public SqliteKeyValueAsyncInterface {
     std::shared_ptr<SqliteKeyValueSafe> kv_safe_;
     SqliteKeyValue *kv_ = nullptr;
 
-    static constexpr double MAX_PENDING_QUERIES_DELAY = 0.01;
-    static constexpr size_t MAX_PENDING_QUERIES_COUNT = 100;
+    std::shared_ptr<SqliteWriteBatcher> write_batcher_;
     FlatHashMap<string, optional<string>> buffer_;
     vector<Promise<Unit>> buffer_promises_;
-    size_t cnt_ = 0;
 
-    double wakeup_at_ = 0;
-    void do_flush(bool force) {
-      if (buffer_.empty()) {
-        return;
+    void add_write_query() {
+      if (write_batcher_->add_query()) {
+        do_flush();
+      } else if (write_batcher_->get_pending_query_count() == 1) {
+        set_timeout_at(write_batcher_->get_commit_time());
       }
+    }
 
-      if (!force) {
-        auto now = Time::now_cached();
-        if (wakeup_at_ == 0) {
-          wakeup_at_ = now + MAX_PENDING_QUERIES_DELAY;
-        }
-        if (now < wakeup_at_ && cnt_ < MAX_PENDING_QUERIES_COUNT) {
-          set_timeout_at(wakeup_at_);
-          return;
-        }
+    void do_flush() {
+      if (buffer_.empty()) {
+        return;
       }
 
-      wakeup_at_ = 0;
-      cnt_ = 0;
-
-      kv_->begin_write_transaction().ensure();
-      for (auto &it : buffer_) {
-        if (it.second) {
-          kv_->set(it.first, it.second.value());
-        } else {
-          kv_->erase(it.first);
+      write_batcher_->commit([&] {
+        kv_->begin_write_transaction().ensure();
+        for (auto &it : buffer_) {
+          if (it.second) {
+            kv_->set(it.first, it.second.value());
+          } else {
+            kv_->erase(it.first);
+          }
         }
-      }
-      kv_->commit_transaction().ensure();
+        kv_->commit_transaction().ensure();
+      });
       buffer_.clear();
       set_promises(buffer_promises_);
+      cancel_timeout();
     }
 
     void timeout_expired() final {
-      do_flush(false /*force*/);
+      do_flush();
     }
 
     void start_up() final {
       kv_ = &kv_safe_->get();
     }
   };
+  std::shared_ptr<SqliteWriteBatcher> write_batcher_ = std::make_shared<SqliteWriteBatcher>();
   ActorOwn<Impl> impl_;
 };
 
@@ -7,6 +7,7 @@
 #pragma once
 
 #include "td/db/SqliteKeyValueSafe.h"
+#include "td/db/SqliteWriteBatcher.h"
 
 #include "td/utils/common.h"
 #include "td/utils/FlatHashMap.h"
@@ -31,6 +32,8 @@ class SqliteKeyValueAsyncInterface {
   virtual void get(string key, Promise<string> promise) = 0;
 
   virtual void close(Promise<Unit> promise) = 0;
+
+  virtual SqliteWriteBatcher::Statistics get_write_statistics() const = 0;
 };
 
 unique_ptr<SqliteKeyValueAsyncInterface> create_sqlite_key_value_async(std::shared_ptr<SqliteKeyValueSafe> kv,
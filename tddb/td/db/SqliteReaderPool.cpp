@@ -0,0 +1,57 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/db/SqliteReaderPool.h"
+
+#include "td/actor/MultiPromise.h"
+
+#include "td/utils/logging.h"
+
+namespace td {
+
+void SqliteReaderPool::Reader::close(Promise<Unit> promise) {
+  promise.set_value(Unit());
+  stop();
+}
+
+SqliteReaderPool::SqliteReaderPool(const vector<int32> &scheduler_ids) {
+  for (auto scheduler_id : scheduler_ids) {
+    ReaderInfo info;
+    info.pending_query_count_ = std::make_shared<std::atomic<int32>>(0);
+    info.reader_ = create_actor_on_scheduler<Reader>("SqliteReader", scheduler_id);
+    readers_.push_back(std::move(info));
+  }
+  LOG(INFO) << "Create SQLite reader pool with " << readers_.size() << " readers";
+}
+
+SqliteReaderPool::~SqliteReaderPool() = default;
+
+SqliteReaderPool::ReaderInfo &SqliteReaderPool::choose_reader() {
+  CHECK(!readers_.empty());
+  auto *best_reader = &readers_[0];
+  auto best_pending_query_count = best_reader->pending_query_count_->load(std::memory_order_relaxed);
+  for (auto &reader : readers_) {
+    auto pending_query_count = reader.pending_query_count_->load(std::memory_order_relaxed);
+    if (pending_query_count < best_pending_query_count) {
+      best_reader = &reader;
+      best_pending_query_count = pending_query_count;
+    }
+  }
+  return *best_reader;
+}
+
+void SqliteReaderPool::close(Promise<Unit> promise) {
+  MultiPromiseActorSafe mpas{"SqliteReaderPoolCloseMultiPromiseActor"};
+  mpas.add_promise(std::move(promise));
+  auto lock = mpas.get_promise();
+  for (auto &reader : readers_) {
+    send_closure(reader.reader_.release(), &Reader::close, mpas.get_promise());
+  }
+  readers_.clear();
+  lock.set_value(Unit());
+}
+
+}  // namespace td
@@ -0,0 +1,67 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/actor/actor.h"
+
+#include "td/utils/common.h"
+#include "td/utils/Promise.h"
+
+#include <atomic>
+#include <memory>
+#include <utility>
+
+namespace td {
+
+// Executes read-only queries on several schedulers concurrently.
+// Queries must use scheduler-local SQLite connections, so in WAL mode they block neither the writer nor each other.
+class SqliteReaderPool {
+ public:
+  SqliteReaderPool() = default;
+  explicit SqliteReaderPool(const vector<int32> &scheduler_ids);
+  SqliteReaderPool(const SqliteReaderPool &) = delete;
+  SqliteReaderPool &operator=(const SqliteReaderPool &) = delete;
+  SqliteReaderPool(SqliteReaderPool &&) = default;
+  SqliteReaderPool &operator=(SqliteReaderPool &&) = default;
+  ~SqliteReaderPool();
+
+  bool empty() const {
+    return readers_.empty();
+  }
+
+  // the query is a callable without arguments, which is run on the least loaded reader; the pool must not be empty
+  // the query is destroyed without being run if the pool is closed before the query is started
+  template <class F>
+  void run(F &&query) {
+    auto &reader = choose_reader();
+    reader.pending_query_count_->fetch_add(1, std::memory_order_relaxed);
+    send_lambda(reader.reader_, [pending_query_count = reader.pending_query_count_,
+                                 query = std::forward<F>(query)]() mutable {
+      query();
+      pending_query_count->fetch_sub(1, std::memory_order_relaxed);
+    });
+  }
+
+  // the promise is set after all previously added queries are finished
+  void close(Promise<Unit> promise);
+
+ private:
+  class Reader final : public Actor {
+   public:
+    void close(Promise<Unit> promise);
+  };
+
+  struct ReaderInfo {
+    ActorOwn<Reader> reader_;
+    std::shared_ptr<std::atomic<int32>> pending_query_count_;
+  };
+  vector<ReaderInfo> readers_;
+
+  ReaderInfo &choose_reader();
+};
+
+}  // namespace td
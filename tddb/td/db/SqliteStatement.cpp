@@ -10,6 +10,7 @@
 #include "td/utils/logging.h"
 #include "td/utils/StackAllocator.h"
 #include "td/utils/StringBuilder.h"
+#include "td/utils/Tracer.h"
 
 #include "sqlite/sqlite3.h"
 
@@ -50,11 +51,17 @@ int printExplainQueryPlan(StringBuilder &sb, tdsqlite3_stmt *pStmt) {
 }
 }  // namespace
 
-SqliteStatement::SqliteStatement(tdsqlite3_stmt *stmt, std::shared_ptr<detail::RawSqliteDb> db)
-    : stmt_(stmt), db_(std::move(db)) {
+SqliteStatement::SqliteStatement(tdsqlite3_stmt *stmt, std::shared_ptr<detail::RawSqliteDb> db, string cache_key)
+    : stmt_(stmt), db_(std::move(db)), cache_key_(std::move(cache_key)) {
   CHECK(stmt != nullptr);
 }
-SqliteStatement::~SqliteStatement() = default;
+SqliteStatement::~SqliteStatement() {
+  if (stmt_ != nullptr && !cache_key_.empty()) {
+    tdsqlite3_reset(stmt_.get());
+    tdsqlite3_clear_bindings(stmt_.get());
+    db_->put_cached_statement(std::move(cache_key_), stmt_.release());
+  }
+}
 
 Result<string> SqliteStatement::explain() {
   if (empty()) {
@@ -180,7 +187,14 @@ Status SqliteStatement::step() {
   }
   VLOG(sqlite) << "Start step " << tag("query", tdsqlite3_sql(stmt_.get())) << tag("statement", stmt_.get())
                << tag("database", db_.get());
+  bool is_traced = Tracer::is_enabled();
+  if (unlikely(is_traced)) {
+    Tracer::begin("db", detail::RawSqliteDb::get_sql_keyword(Slice(tdsqlite3_sql(stmt_.get()))));
+  }
   auto rc = tdsqlite3_step(stmt_.get());
+  if (unlikely(is_traced)) {
+    Tracer::end("db", detail::RawSqliteDb::get_sql_keyword(Slice(tdsqlite3_sql(stmt_.get()))));
+  }
   VLOG(sqlite) << "Finish step with response " << (rc == SQLITE_ROW ? "ROW" : (rc == SQLITE_DONE ? "DONE" : "ERROR"));
   if (rc == SQLITE_ROW) {
     state_ = State::HaveRow;
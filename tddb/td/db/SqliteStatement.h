@@ -69,7 +69,7 @@ class SqliteStatement {
 
  private:
   friend class SqliteDb;
-  SqliteStatement(tdsqlite3_stmt *stmt, std::shared_ptr<detail::RawSqliteDb> db);
+  SqliteStatement(tdsqlite3_stmt *stmt, std::shared_ptr<detail::RawSqliteDb> db, string cache_key = string());
 
   class StmtDeleter {
    public:
@@ -81,6 +81,7 @@ class SqliteStatement {
 
   std::unique_ptr<tdsqlite3_stmt, StmtDeleter> stmt_;
   std::shared_ptr<detail::RawSqliteDb> db_;
+  string cache_key_;  // non-empty if the statement must be returned to the statement cache of the database
 
   Status last_error();
 };
@@ -0,0 +1,92 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/db/SqliteWriteBatcher.h"
+
+#include "td/utils/misc.h"
+
+namespace td {
+
+static void update_max(std::atomic<uint64> &max_value, uint64 value) {
+  // there is only one writer, so there is no need for compare_exchange
+  if (value > max_value.load(std::memory_order_relaxed)) {
+    max_value.store(value, std::memory_order_relaxed);
+  }
+}
+
+bool SqliteWriteBatcher::add_query() {
+  auto now = Time::now_cached();
+  if (pending_query_count_ == 0) {
+    first_query_time_ = now;
+    if (now - last_commit_end_time_ > MAX_DELAY) {
+      // the database is idle, so there is no reason to wait for more queries
+      commit_time_ = now;
+    } else {
+      commit_time_ = now + clamp(average_commit_time_, MIN_DELAY, MAX_DELAY);
+    }
+  }
+  pending_query_count_++;
+  query_time_sum_ += now;
+  return pending_query_count_ >= max_batch_size_;
+}
+
+void SqliteWriteBatcher::on_commit(double start_time, double end_time) {
+  auto batch_size = pending_query_count_;
+  if (batch_size == 0) {
+    return;
+  }
+  auto commit_time = end_time - start_time;
+  auto queueing_delay = max(static_cast<double>(batch_size) * start_time - query_time_sum_, 0.0);
+  pending_query_count_ = 0;
+  query_time_sum_ = 0;
+  last_commit_end_time_ = end_time;
+
+  auto query_cost = commit_time / static_cast<double>(batch_size);
+  if (average_query_cost_ == 0) {
+    average_commit_time_ = commit_time;
+    average_query_cost_ = query_cost;
+  } else {
+    average_commit_time_ += (commit_time - average_commit_time_) * SMOOTHING_FACTOR;
+    average_query_cost_ += (query_cost - average_query_cost_) * SMOOTHING_FACTOR;
+  }
+  if (average_query_cost_ > 0) {
+    max_batch_size_ = static_cast<size_t>(
+        clamp(TARGET_COMMIT_TIME / average_query_cost_, static_cast<double>(MIN_BATCH_SIZE),
+              static_cast<double>(MAX_BATCH_SIZE)));
+  }
+
+  transaction_count_.fetch_add(1, std::memory_order_relaxed);
+  query_count_.fetch_add(batch_size, std::memory_order_relaxed);
+  update_max(max_batch_size_seen_, batch_size);
+  current_max_batch_size_.store(max_batch_size_, std::memory_order_relaxed);
+  auto commit_time_us = static_cast<uint64>(commit_time * 1e6);
+  total_commit_time_us_.fetch_add(commit_time_us, std::memory_order_relaxed);
+  update_max(max_commit_time_us_, commit_time_us);
+  total_queueing_delay_us_.fetch_add(static_cast<uint64>(queueing_delay * 1e6), std::memory_order_relaxed);
+  update_max(max_queueing_delay_us_, static_cast<uint64>(max(start_time - first_query_time_, 0.0) * 1e6));
+}
+
+SqliteWriteBatcher::Statistics SqliteWriteBatcher::get_statistics() const {
+  Statistics result;
+  result.transaction_count = transaction_count_.load(std::memory_order_relaxed);
+  result.query_count = query_count_.load(std::memory_order_relaxed);
+  result.max_batch_size = max_batch_size_seen_.load(std::memory_order_relaxed);
+  result.current_max_batch_size = current_max_batch_size_.load(std::memory_order_relaxed);
+  result.max_commit_time = static_cast<double>(max_commit_time_us_.load(std::memory_order_relaxed)) * 1e-6;
+  result.max_queueing_delay = static_cast<double>(max_queueing_delay_us_.load(std::memory_order_relaxed)) * 1e-6;
+  if (result.transaction_count > 0) {
+    result.average_commit_time = static_cast<double>(total_commit_time_us_.load(std::memory_order_relaxed)) * 1e-6 /
+                                 static_cast<double>(result.transaction_count);
+  }
+  if (result.query_count > 0) {
+    result.average_queueing_delay =
+        static_cast<double>(total_queueing_delay_us_.load(std::memory_order_relaxed)) * 1e-6 /
+        static_cast<double>(result.query_count);
+  }
+  return result;
+}
+
+}  // namespace td
@@ -0,0 +1,97 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/format.h"
+#include "td/utils/StringBuilder.h"
+#include "td/utils/Time.h"
+
+#include <atomic>
+
+namespace td {
+
+// Decides when write queries, which are added to a pending batch, must be committed in a single transaction.
+// A write to an idle database is committed almost immediately. Under load queries are delayed for up to an average
+// commit duration, and the maximum batch size is chosen so that a transaction takes about TARGET_COMMIT_TIME.
+// All methods except get_statistics must be called from the actor owning the database connection.
+class SqliteWriteBatcher {
+ public:
+  struct Statistics {
+    uint64 transaction_count = 0;
+    uint64 query_count = 0;
+    uint64 max_batch_size = 0;
+    uint64 current_max_batch_size = 0;
+    double average_commit_time = 0;
+    double max_commit_time = 0;
+    double average_queueing_delay = 0;
+    double max_queueing_delay = 0;
+  };
+
+  // returns true, if the pending batch must be committed immediately
+  bool add_query();
+
+  size_t get_pending_query_count() const {
+    return pending_query_count_;
+  }
+
+  // returns time at which the pending batch must be committed
+  double get_commit_time() const {
+    return commit_time_;
+  }
+
+  // commits the pending batch; the function must execute the whole transaction
+  template <class F>
+  void commit(F &&f) {
+    auto start_time = Time::now();
+    f();
+    on_commit(start_time, Time::now());
+  }
+
+  Statistics get_statistics() const;
+
+ private:
+  static constexpr size_t MIN_BATCH_SIZE = 50;
+  static constexpr size_t MAX_BATCH_SIZE = 2000;
+  static constexpr double MIN_DELAY = 0.001;
+  static constexpr double MAX_DELAY = 0.01;
+  static constexpr double TARGET_COMMIT_TIME = 0.02;
+  static constexpr double SMOOTHING_FACTOR = 0.2;
+
+  size_t pending_query_count_ = 0;
+  double commit_time_ = 0;
+  double first_query_time_ = 0;
+  double query_time_sum_ = 0;
+  double last_commit_end_time_ = 0;
+  double average_commit_time_ = 0;
+  double average_query_cost_ = 0;
+  size_t max_batch_size_ = MIN_BATCH_SIZE;
+
+  std::atomic<uint64> transaction_count_{0};
+  std::atomic<uint64> query_count_{0};
+  std::atomic<uint64> max_batch_size_seen_{0};
+  std::atomic<uint64> current_max_batch_size_{MIN_BATCH_SIZE};
+  std::atomic<uint64> total_commit_time_us_{0};
+  std::atomic<uint64> max_commit_time_us_{0};
+  std::atomic<uint64> total_queueing_delay_us_{0};
+  std::atomic<uint64> max_queueing_delay_us_{0};
+
+  void on_commit(double start_time, double end_time);
+};
+
+inline StringBuilder &operator<<(StringBuilder &string_builder, const SqliteWriteBatcher::Statistics &statistics) {
+  return string_builder << "SqliteWriteBatcher[" << tag("transactions", statistics.transaction_count)
+                        << tag("queries", statistics.query_count)
+                        << tag("max_batch_size", statistics.max_batch_size)
+                        << tag("batch_size_limit", statistics.current_max_batch_size)
+                        << tag("average_commit_time", format::as_time(statistics.average_commit_time))
+                        << tag("max_commit_time", format::as_time(statistics.max_commit_time))
+                        << tag("average_queueing_delay", format::as_time(statistics.average_queueing_delay))
+                        << tag("max_queueing_delay", format::as_time(statistics.max_queueing_delay)) << ']';
+}
+
+}  // namespace td
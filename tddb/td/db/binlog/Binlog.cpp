@@ -10,14 +10,19 @@
 #include "td/db/binlog/detail/BinlogEventsProcessor.h"
 
 #include "td/utils/buffer.h"
+#include "td/utils/crypto.h"
+#include "td/utils/filesystem.h"
 #include "td/utils/format.h"
 #include "td/utils/misc.h"
+#include "td/utils/MpmcQueue.h"
 #include "td/utils/port/Clocks.h"
 #include "td/utils/port/FileFd.h"
+#include "td/utils/port/MemoryMapping.h"
 #include "td/utils/port/path.h"
 #include "td/utils/port/PollFlags.h"
 #include "td/utils/port/sleep.h"
 #include "td/utils/port/Stat.h"
+#include "td/utils/port/thread.h"
 #include "td/utils/Random.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/SliceBuilder.h"
@@ -25,6 +30,10 @@
 #include "td/utils/Time.h"
 #include "td/utils/tl_helpers.h"
 #include "td/utils/tl_parsers.h"
+#include "td/utils/VectorQueue.h"
+
+#include <atomic>
+#include <utility>
 
 namespace td {
 namespace detail {
@@ -109,7 +118,11 @@ class BinlogReader {
   int64 offset() const {
     return offset_;
   }
-  Result<size_t> read_next(BinlogEvent *event) {
+  void set_offset(int64 offset) {
+    CHECK(state_ == State::ReadLength);
+    offset_ = offset;
+  }
+  Result<size_t> read_next(string *raw_event) {
     if (state_ == State::ReadLength) {
       if (input_->size() < 4) {
         return 4;
@@ -138,12 +151,8 @@ class BinlogReader {
       return size_;
     }
 
-    event->debug_info_ = BinlogDebugInfo{__FILE__, __LINE__};
-    auto buffer_slice = input_->cut_head(size_).move_as_buffer_slice();
-    event->init(buffer_slice.as_slice().str());
-    TRY_STATUS(event->validate());
+    *raw_event = input_->cut_head(size_).move_as_buffer_slice().as_slice().str();
     offset_ += size_;
-    event->offset_ = offset_;
     state_ = State::ReadLength;
     return 0;
   }
@@ -158,6 +167,167 @@ class BinlogReader {
   bool is_encrypted_{false};
 };
 
+// checks and parses binlog events on several threads, preserving their order
+class BinlogEventsValidator {
+ public:
+  explicit BinlogEventsValidator(size_t threads_n) : queue_(threads_n + 1) {
+#if TD_THREAD_UNSUPPORTED
+    threads_n = 0;
+#endif
+    threads_n_ = threads_n;
+#if !TD_THREAD_UNSUPPORTED
+    for (size_t i = 0; i < threads_n; i++) {
+      threads_.push_back(td::thread([this, thread_id = i + 1] {
+        while (true) {
+          auto batch = queue_.pop(thread_id);
+          if (batch == nullptr) {
+            break;
+          }
+          batch->validate();
+        }
+      }));
+    }
+#endif
+  }
+  BinlogEventsValidator(const BinlogEventsValidator &) = delete;
+  BinlogEventsValidator &operator=(const BinlogEventsValidator &) = delete;
+  BinlogEventsValidator(BinlogEventsValidator &&) = delete;
+  BinlogEventsValidator &operator=(BinlogEventsValidator &&) = delete;
+  ~BinlogEventsValidator() {
+    for (size_t i = 0; i < threads_n_; i++) {
+      queue_.push(nullptr, 0);
+    }
+#if !TD_THREAD_UNSUPPORTED
+    for (auto &thread : threads_) {
+      thread.join();
+    }
+#endif
+  }
+
+  // callback is called for every valid event in the original order, until the first invalid event
+  template <class CallbackT>
+  Status add_event(string raw_event, int64 offset, CallbackT &&callback) {
+    if (current_batch_ == nullptr) {
+      current_batch_ = make_unique<Batch>();
+    }
+    current_batch_->size_ += raw_event.size();
+    current_batch_->raw_events_.emplace_back(std::move(raw_event), offset);
+    if (current_batch_->size_ < MAX_BATCH_SIZE) {
+      return Status::OK();
+    }
+
+    send_batch();
+    if (batches_.size() < MAX_PENDING_BATCHES) {
+      return Status::OK();
+    }
+    return process_batch(callback);
+  }
+
+  template <class CallbackT>
+  Status flush(CallbackT &&callback) {
+    send_batch();
+    while (!batches_.empty()) {
+      TRY_STATUS(process_batch(callback));
+    }
+    return Status::OK();
+  }
+
+ private:
+  static constexpr size_t MAX_BATCH_SIZE = 1 << 18;
+  static constexpr size_t MAX_PENDING_BATCHES = 16;
+
+  struct Batch {
+    vector<std::pair<string, int64>> raw_events_;
+    size_t size_{0};
+    vector<BinlogEvent> events_;
+    Status status_;
+    std::atomic<bool> is_ready_{false};
+
+    void validate() {
+      events_.reserve(raw_events_.size());
+      for (auto &raw_event : raw_events_) {
+        BinlogEvent event;
+        event.debug_info_ = BinlogDebugInfo{__FILE__, __LINE__};
+        event.init(std::move(raw_event.first));
+        status_ = event.validate();
+        if (status_.is_error()) {
+          break;
+        }
+        event.offset_ = raw_event.second;
+        events_.push_back(std::move(event));
+      }
+      raw_events_ = {};
+      is_ready_.store(true, std::memory_order_release);
+    }
+  };
+
+  MpmcQueue<Batch *> queue_;
+  size_t threads_n_{0};
+#if !TD_THREAD_UNSUPPORTED
+  vector<td::thread> threads_;
+#endif
+  VectorQueue<unique_ptr<Batch>> batches_;
+  unique_ptr<Batch> current_batch_;
+
+  void send_batch() {
+    if (current_batch_ == nullptr) {
+      return;
+    }
+    if (threads_n_ == 0) {
+      current_batch_->validate();
+    } else {
+      queue_.push(current_batch_.get(), 0);
+    }
+    batches_.push(std::move(current_batch_));
+  }
+
+  void wait_batch(Batch *batch) {
+    while (!batch->is_ready_.load(std::memory_order_acquire)) {
+      // help validator threads instead of waiting
+      Batch *other_batch = nullptr;
+      if (queue_.try_pop(other_batch, 0)) {
+        if (other_batch == nullptr) {
+          queue_.push(nullptr, 0);
+        } else {
+          other_batch->validate();
+        }
+      } else {
+        usleep_for(1);
+      }
+    }
+  }
+
+  template <class CallbackT>
+  Status process_batch(CallbackT &&callback) {
+    auto batch = batches_.pop();
+    wait_batch(batch.get());
+    for (auto &event : batch->events_) {
+      callback(std::move(event));
+    }
+    return std::move(batch->status_);
+  }
+};
+
+static bool is_service_event(Slice raw_event) {
+  TlParser parser(raw_event);
+  parser.fetch_int();   // size
+  parser.fetch_long();  // id
+  return parser.fetch_int() < 0;
+}
+
+static size_t get_load_threads_count(int64 binlog_size) {
+#if TD_THREAD_UNSUPPORTED
+  return 0;
+#else
+  // there is no need to parallelize loading of small binlogs
+  if (binlog_size < (4 << 20)) {
+    return 0;
+  }
+  auto cpu_count = static_cast<size_t>(td::thread::hardware_concurrency());
+  return cpu_count <= 1 ? 0 : min(cpu_count - 1, static_cast<size_t>(4));
+#endif
+}
+
 static int64 file_size(CSlice path) {
   auto r_stat = stat(path);
   if (r_stat.is_error()) {
@@ -165,6 +335,427 @@ static int64 file_size(CSlice path) {
   }
   return r_stat.ok().size_;
 }
+
+// writes a snapshot of live events to a new binlog file without blocking the owner of the binlog
+class BinlogReindexWorker {
+ public:
+  BinlogReindexWorker(FileFd fd, string path, vector<string> events, BufferSlice encryption_event, Slice key,
+                      Slice iv, bool need_sync)
+      : fd_(std::move(fd))
+      , path_(std::move(path))
+      , events_(std::move(events))
+      , encryption_event_(std::move(encryption_event))
+      , need_sync_(need_sync) {
+    if (!encryption_event_.empty()) {
+      aes_ctr_state_.init(key, iv);
+    }
+  }
+  BinlogReindexWorker(const BinlogReindexWorker &) = delete;
+  BinlogReindexWorker &operator=(const BinlogReindexWorker &) = delete;
+  BinlogReindexWorker(BinlogReindexWorker &&) = delete;
+  BinlogReindexWorker &operator=(BinlogReindexWorker &&) = delete;
+  ~BinlogReindexWorker() {
+    cancel();
+  }
+
+  void start() {
+#if TD_THREAD_UNSUPPORTED
+    run();
+#else
+    thread_ = td::thread([this] { run(); });
+#endif
+  }
+
+  bool is_ready() const {
+    return is_ready_.load(std::memory_order_acquire);
+  }
+
+  void cancel() {
+    is_cancelled_.store(true, std::memory_order_relaxed);
+    join();
+  }
+
+  void join() {
+#if !TD_THREAD_UNSUPPORTED
+    thread_.join();
+#endif
+  }
+
+  bool is_encrypted() const {
+    return !encryption_event_.empty();
+  }
+
+  FileFd &fd() {
+    return fd_;
+  }
+
+  AesCtrState move_aes_ctr_state() {
+    return std::move(aes_ctr_state_);
+  }
+
+  Status move_status() {
+    return std::move(status_);
+  }
+
+  int64 written_size() const {
+    return written_size_;
+  }
+
+  uint64 written_events() const {
+    return written_events_;
+  }
+
+  double start_time_{0};
+  int64 start_size_{0};
+  uint64 start_events_{0};
+
+ private:
+  static constexpr size_t CHUNK_SIZE = 1 << 20;
+
+  FileFd fd_;
+  string path_;
+  vector<string> events_;
+  BufferSlice encryption_event_;
+  bool need_sync_;
+  AesCtrState aes_ctr_state_;
+#if !TD_THREAD_UNSUPPORTED
+  td::thread thread_;
+#endif
+  std::atomic<bool> is_ready_{false};
+  std::atomic<bool> is_cancelled_{false};
+
+  Status status_;
+  int64 written_size_{0};
+  uint64 written_events_{0};
+
+  Status write(Slice data) {
+    while (!data.empty()) {
+      TRY_RESULT(written, fd_.write(data));
+      data.remove_prefix(written);
+    }
+    return Status::OK();
+  }
+
+  Status do_run() {
+    if (!encryption_event_.empty()) {
+      TRY_STATUS(write(encryption_event_.as_slice()));
+      written_size_ += static_cast<int64>(encryption_event_.size());
+      written_events_++;
+    }
+
+    string chunk;
+    size_t chunk_events = 0;
+    auto flush_chunk = [&]() -> Status {
+      if (is_encrypted()) {
+        aes_ctr_state_.encrypt(chunk, MutableSlice(chunk));
+      }
+      TRY_STATUS(write(chunk));
+      written_size_ += static_cast<int64>(chunk.size());
+      written_events_ += chunk_events;
+      VLOG(binlog) << "Background reindex of \"" << path_ << "\": written " << written_events_
+                   << " events of total size " << format::as_size(written_size_);
+      chunk.clear();
+      chunk_events = 0;
+      if (is_cancelled_.load(std::memory_order_relaxed)) {
+        return Status::Error("Reindex was cancelled");
+      }
+      return Status::OK();
+    };
+    for (auto &event : events_) {
+      chunk += event;
+      chunk_events++;
+      event = string();
+      if (chunk.size() >= CHUNK_SIZE) {
+        TRY_STATUS(flush_chunk());
+      }
+    }
+    if (!chunk.empty()) {
+      TRY_STATUS(flush_chunk());
+    }
+    events_ = vector<string>();
+
+    if (need_sync_) {  // must sync creation of the file if it is non-empty
+      TRY_STATUS(fd_.sync_barrier());
+    }
+    return Status::OK();
+  }
+
+  void run() {
+    status_ = do_run();
+    is_ready_.store(true, std::memory_order_release);
+  }
+};
+
+// a binlog snapshot file consists of the size of the header, the header and live events of the binlog,
+// which are encrypted with the key of the binlog if the binlog is encrypted
+struct BinlogSnapshotHeader {
+  static constexpr int32 magic() {
+    return 0x534e4c42;
+  }
+  static constexpr size_t iv_size() {
+    return 16;  // 128 bits
+  }
+
+  int64 binlog_size_{0};  // size of the binlog part, events of which are saved in the snapshot
+  uint64 binlog_event_count_{0};
+  uint64 last_event_id_{0};
+  string binlog_hash_;  // hash of the beginning and the end of the binlog part
+  string iv_;           // empty if the binlog isn't encrypted
+  int64 events_size_{0};
+  uint32 events_crc32c_{0};
+
+  template <class StorerT>
+  void store(StorerT &storer) const {
+    using td::store;
+    store(magic(), storer);
+    BEGIN_STORE_FLAGS();
+    END_STORE_FLAGS();
+    store(binlog_size_, storer);
+    store(binlog_event_count_, storer);
+    store(last_event_id_, storer);
+    store(binlog_hash_, storer);
+    store(iv_, storer);
+    store(events_size_, storer);
+    store(events_crc32c_, storer);
+  }
+  template <class ParserT>
+  void parse(ParserT &parser) {
+    using td::parse;
+    int32 stored_magic;
+    parse(stored_magic, parser);
+    if (stored_magic != magic()) {
+      return parser.set_error("Wrong snapshot magic");
+    }
+    BEGIN_PARSE_FLAGS();
+    END_PARSE_FLAGS();
+    parse(binlog_size_, parser);
+    parse(binlog_event_count_, parser);
+    parse(last_event_id_, parser);
+    parse(binlog_hash_, parser);
+    parse(iv_, parser);
+    parse(events_size_, parser);
+    parse(events_crc32c_, parser);
+  }
+};
+
+// identifies the binlog part saved in a snapshot; regenerated binlogs differ in size or in the encryption event,
+// and binlogs with lost data written before the snapshot almost always differ in the end of the part
+static Result<string> get_binlog_hash(const FileFd &fd, int64 size) {
+  static constexpr int64 HASHED_PART_SIZE = 1 << 12;
+  string data;
+  auto read_part = [&](int64 offset) -> Status {
+    string part(narrow_cast<size_t>(min(HASHED_PART_SIZE, size - offset)), '\0');
+    TRY_RESULT(read_size, fd.pread(part, offset));
+    if (read_size != part.size()) {
+      return Status::Error("Failed to read the binlog");
+    }
+    data += part;
+    return Status::OK();
+  };
+  TRY_STATUS(read_part(0));
+  TRY_STATUS(read_part(max(size - HASHED_PART_SIZE, static_cast<int64>(0))));
+  return sha256(data);
+}
+
+struct BinlogSnapshot {
+  BinlogSnapshotHeader header_;
+  Slice events_;
+  unique_ptr<MemoryMapping> mapping_;
+  string data_;  // used if the file can't be memory-mapped
+
+  bool is_encrypted() const {
+    return !header_.iv_.empty();
+  }
+
+  static Result<unique_ptr<BinlogSnapshot>> open(CSlice path) {
+    auto result = make_unique<BinlogSnapshot>();
+    Slice data;
+    {
+      TRY_RESULT(fd, FileFd::open(path, FileFd::Flags::Read));
+      auto r_mapping = MemoryMapping::create_from_file(fd);
+      if (r_mapping.is_ok()) {
+        result->mapping_ = make_unique<MemoryMapping>(r_mapping.move_as_ok());
+        data = result->mapping_->as_slice();
+      } else {
+        fd.close();
+        TRY_RESULT_ASSIGN(result->data_, read_file_str(path));
+        data = result->data_;
+      }
+    }
+    if (data.size() < 4) {
+      return Status::Error("Snapshot is too small");
+    }
+    auto header_size = static_cast<uint32>(TlParser(data.substr(0, 4)).fetch_int());
+    data.remove_prefix(4);
+    if (header_size > data.size()) {
+      return Status::Error("Snapshot header is truncated");
+    }
+    TRY_STATUS(unserialize(result->header_, data.substr(0, header_size)));
+    data.remove_prefix(header_size);
+    if (static_cast<uint64>(result->header_.events_size_) != data.size()) {
+      return Status::Error("Snapshot events are truncated");
+    }
+    if (result->is_encrypted() && result->header_.iv_.size() != BinlogSnapshotHeader::iv_size()) {
+      return Status::Error("Wrong snapshot IV");
+    }
+    result->events_ = data;
+    return std::move(result);
+  }
+};
+
+static Status parse_binlog_snapshot_events(Slice data, uint64 last_event_id, int64 offset,
+                                           vector<BinlogEvent> &events) {
+  while (!data.empty()) {
+    if (data.size() < 4) {
+      return Status::Error("Snapshot event is truncated");
+    }
+    auto size = static_cast<size_t>(static_cast<uint32>(TlParser(data.substr(0, 4)).fetch_int()));
+    if (size < BinlogEvent::MIN_SIZE || size > BinlogEvent::MAX_SIZE || size % 4 != 0 || size > data.size()) {
+      return Status::Error(PSLICE() << "Wrong snapshot event " << tag("size", size));
+    }
+    BinlogEvent event;
+    event.debug_info_ = BinlogDebugInfo{__FILE__, __LINE__};
+    event.init(data.substr(0, size).str());
+    data.remove_prefix(size);
+    if (event.type_ < 0 || event.id_ > last_event_id || (!events.empty() && events.back().id_ >= event.id_)) {
+      return Status::Error(PSLICE() << "Wrong snapshot event " << event.public_to_string());
+    }
+    event.offset_ = offset;
+    events.push_back(std::move(event));
+  }
+  return Status::OK();
+}
+
+// initializes AES-CTR state to decrypt data starting from the given position of the encrypted stream
+static void init_aes_ctr_state(AesCtrState &state, Slice key, UInt128 iv, int64 position) {
+  // the counter is a 128-bit big-endian number, which is incremented for every 16-byte block
+  auto block_count = static_cast<uint64>(position / 16);
+  for (int i = 15; i >= 0 && block_count != 0; i--) {
+    auto sum = static_cast<uint64>(iv.raw[i]) + (block_count & 0xFF);
+    iv.raw[i] = static_cast<uint8>(sum & 0xFF);
+    block_count = (block_count >> 8) + (sum >> 8);
+  }
+  state.init(key, as_slice(iv));
+  char skipped[16];
+  auto skipped_size = static_cast<size_t>(position % 16);
+  state.encrypt(Slice(skipped, skipped_size), MutableSlice(skipped, skipped_size));
+}
+
+// writes a snapshot of live events of a binlog without blocking the owner of the binlog
+class BinlogSnapshotWorker {
+ public:
+  BinlogSnapshotWorker(string path, BinlogSnapshotHeader header, vector<string> events, Slice key)
+      : path_(std::move(path)), header_(std::move(header)), events_(std::move(events)) {
+    if (!header_.iv_.empty()) {
+      aes_ctr_state_.init(key, header_.iv_);
+    }
+  }
+  BinlogSnapshotWorker(const BinlogSnapshotWorker &) = delete;
+  BinlogSnapshotWorker &operator=(const BinlogSnapshotWorker &) = delete;
+  BinlogSnapshotWorker(BinlogSnapshotWorker &&) = delete;
+  BinlogSnapshotWorker &operator=(BinlogSnapshotWorker &&) = delete;
+  ~BinlogSnapshotWorker() {
+    cancel();
+  }
+
+  void start() {
+#if TD_THREAD_UNSUPPORTED
+    run();
+#else
+    thread_ = td::thread([this] { run(); });
+#endif
+  }
+
+  bool is_ready() const {
+    return is_ready_.load(std::memory_order_acquire);
+  }
+
+  void cancel() {
+    is_cancelled_.store(true, std::memory_order_relaxed);
+    join();
+  }
+
+  void join() {
+#if !TD_THREAD_UNSUPPORTED
+    thread_.join();
+#endif
+  }
+
+  Status move_status() {
+    return std::move(status_);
+  }
+
+  const BinlogSnapshotHeader &header() const {
+    return header_;
+  }
+
+  string get_new_path() const {
+    return path_ + ".new";
+  }
+
+  double start_time_{0};
+
+ private:
+  static constexpr size_t CHUNK_SIZE = 1 << 20;
+
+  string path_;
+  BinlogSnapshotHeader header_;
+  vector<string> events_;
+  AesCtrState aes_ctr_state_;
+#if !TD_THREAD_UNSUPPORTED
+  td::thread thread_;
+#endif
+  std::atomic<bool> is_ready_{false};
+  std::atomic<bool> is_cancelled_{false};
+
+  Status status_;
+
+  Status do_run() {
+    string data;
+    for (auto &event : events_) {
+      data += event;
+      event = string();
+    }
+    events_ = vector<string>();
+    header_.events_size_ = static_cast<int64>(data.size());
+    header_.events_crc32c_ = crc32c(data);
+    if (!header_.iv_.empty()) {
+      aes_ctr_state_.encrypt(data, MutableSlice(data));
+    }
+
+    auto header = serialize(header_);
+    auto new_path = get_new_path();
+    TRY_RESULT(fd, FileFd::open(new_path, FileFd::Flags::Write | FileFd::Flags::Create | FileFd::Truncate));
+    auto write = [&](Slice part) -> Status {
+      while (!part.empty()) {
+        TRY_RESULT(written, fd.write(part));
+        part.remove_prefix(written);
+      }
+      return Status::OK();
+    };
+    char header_size[4];
+    TlStorerUnsafe(MutableSlice(header_size, 4).ubegin()).store_int(narrow_cast<int32>(header.size()));
+    TRY_STATUS(write(Slice(header_size, 4)));
+    TRY_STATUS(write(header));
+    for (size_t pos = 0; pos < data.size(); pos += CHUNK_SIZE) {
+      if (is_cancelled_.load(std::memory_order_relaxed)) {
+        return Status::Error("Snapshot was cancelled");
+      }
+      TRY_STATUS(write(Slice(data).substr(pos, CHUNK_SIZE)));
+    }
+    TRY_STATUS(fd.sync());
+    fd.close();
+    if (is_cancelled_.load(std::memory_order_relaxed)) {
+      return Status::Error("Snapshot was cancelled");
+    }
+    return rename(new_path, path_);
+  }
+
+  void run() {
+    status_ = do_run();
+    is_ready_.store(true, std::memory_order_release);
+  }
+};
 }  // namespace detail
 
 int32 VERBOSITY_NAME(binlog) = VERBOSITY_NAME(DEBUG) + 8;
@@ -203,7 +794,10 @@ Status Binlog::init(string path, const Callback &callback, DbKey db_key, DbKey o
   TRY_RESULT(fd, open_binlog(path, FileFd::Flags::Read | FileFd::Flags::Write | FileFd::Flags::Create));
   fd_ = BufferedFdBase<FileFd>(std::move(fd));
   fd_size_ = 0;
+  fd_events_ = 0;
   path_ = std::move(path);
+  snapshot_binlog_size_ = 0;
+  snapshot_events_size_ = 0;
 
   auto status = load_binlog(callback, debug_callback);
   if (status.is_error()) {
@@ -220,6 +814,9 @@ Status Binlog::init(string path, const Callback &callback, DbKey db_key, DbKey o
   if ((!db_key_.is_empty() && !db_key_used_) || (db_key_.is_empty() && encryption_type_ != EncryptionType::None)) {
     aes_ctr_key_salt_ = string();
     do_reindex();
+  } else {
+    // compact the binlog right away to speed up the next start
+    try_reindex();
   }
 
   info_.is_opened = true;
@@ -230,6 +827,9 @@ void Binlog::add_event(BinlogEvent &&event) {
   if (event.size_ % 4 != 0) {
     LOG(FATAL) << "Trying to add event with bad size " << event.public_to_string();
   }
+  if (use_crc32c_ && !event.is_empty()) {
+    event.set_crc32c_flag();
+  }
 
   if (!events_buffer_) {
     do_add_event(std::move(event));
@@ -239,18 +839,41 @@ void Binlog::add_event(BinlogEvent &&event) {
   lazy_flush();
 
   if (state_ == State::Run) {
-    auto fd_size = fd_size_;
-    if (events_buffer_) {
-      fd_size += events_buffer_->size();
-    }
-    auto need_reindex = [&](int64 min_size, int rate) {
-      return fd_size > min_size && fd_size / rate > processor_->total_raw_events_size();
-    };
-    if (need_reindex(50000, 5) || need_reindex(100000, 4) || need_reindex(300000, 3) || need_reindex(500000, 2)) {
+    try_finish_background_reindex();
+    try_reindex();
+    try_finish_background_snapshot();
+    try_snapshot();
+  }
+}
+
+void Binlog::try_reindex() {
+  if (reindex_worker_ != nullptr) {
+    return;
+  }
+
+  auto fd_size = fd_size_;
+  if (events_buffer_) {
+    fd_size += events_buffer_->size();
+  }
+  auto total_raw_events_size = processor_->total_raw_events_size();
+  if (fd_size > MIN_BACKGROUND_REINDEX_SIZE) {
+    // background regeneration doesn't block the caller, so big binlogs are regenerated more eagerly
+    // to keep the amount of data replayed on the next start closer to the size of live events
+    if (fd_size * 100 > total_raw_events_size * BACKGROUND_REINDEX_SIZE_PERCENT) {
       LOG(INFO) << tag("fd_size", format::as_size(fd_size))
-                << tag("total events size", format::as_size(processor_->total_raw_events_size()));
-      do_reindex();
+                << tag("total events size", format::as_size(total_raw_events_size));
+      start_background_reindex();
     }
+    return;
+  }
+
+  auto need_reindex = [&](int64 min_size, int rate) {
+    return fd_size > min_size && fd_size / rate > total_raw_events_size;
+  };
+  if (need_reindex(50000, 5) || need_reindex(100000, 4) || need_reindex(300000, 3) || need_reindex(500000, 2)) {
+    LOG(INFO) << tag("fd_size", format::as_size(fd_size))
+              << tag("total events size", format::as_size(total_raw_events_size));
+    do_reindex();
   }
 }
 
@@ -285,6 +908,10 @@ Status Binlog::close(bool need_sync) {
   if (fd_.empty()) {
     return Status::OK();
   }
+  try_finish_background_reindex();
+  cancel_background_reindex();
+  try_finish_background_snapshot();
+  cancel_background_snapshot();
   if (need_sync) {
     sync();
   } else {
@@ -305,6 +932,7 @@ void Binlog::close(Promise<> promise) {
 }
 
 void Binlog::change_key(DbKey new_db_key) {
+  cancel_background_reindex();
   db_key_ = std::move(new_db_key);
   aes_ctr_key_salt_ = string();
   do_reindex();
@@ -318,6 +946,8 @@ Status Binlog::close_and_destroy() {
 }
 
 Status Binlog::destroy(Slice path) {
+  unlink(PSLICE() << get_snapshot_path(path) << ".new").ignore();
+  unlink(get_snapshot_path(path)).ignore();
   unlink(PSLICE() << path << ".new").ignore();  // delete regenerated version first to avoid it becoming main version
   unlink(PSLICE() << path).ignore();
   return Status::OK();
@@ -335,6 +965,10 @@ void Binlog::do_event(BinlogEvent &&event) {
     VLOG(binlog) << "Write binlog event: " << format::cond(state_ == State::Reindex, "[reindex] ")
                  << event.public_to_string();
     buffer_writer_.append(as_slice(event.raw_event_));
+    if (reindex_worker_ != nullptr && state_ == State::Run) {
+      // the event must be appended also to the binlog being regenerated
+      reindex_tail_events_.push_back(event.raw_event_);
+    }
   }
 
   if (event.type_ < 0) {
@@ -407,7 +1041,7 @@ void Binlog::do_event(BinlogEvent &&event) {
 void Binlog::sync() {
   flush();
   if (need_sync_) {
-    auto status = fd_.sync();
+    auto status = fd_.sync_data();
     LOG_IF(FATAL, status.is_error()) << "Failed to sync binlog: " << status;
     need_sync_ = false;
   }
@@ -512,10 +1146,61 @@ Status Binlog::load_binlog(const Callback &callback, const Callback &debug_callb
 
   fd_.get_poll_info().add_flags(PollFlags::Read());
   info_.wrong_password = false;
+
+  unique_ptr<detail::BinlogEventsValidator> validator;
+  auto threads_n = detail::get_load_threads_count(fd_.get_size().move_as_ok());
+  if (threads_n > 0) {
+    validator = td::make_unique<detail::BinlogEventsValidator>(threads_n);
+  }
+  auto add_event = [&](BinlogEvent &&event) {
+    if (debug_callback) {
+      debug_callback(event);
+    }
+    do_add_event(std::move(event));
+  };
+  auto flush_validator = [&] {
+    if (validator == nullptr) {
+      return true;
+    }
+    auto status = validator->flush(add_event);
+    if (status.is_error()) {
+      LOG(ERROR) << status;
+      return false;
+    }
+    return true;
+  };
+
+  // the snapshot is used only if there is no need to read all events
+  unique_ptr<detail::BinlogSnapshot> snapshot;
+  auto snapshot_path = get_snapshot_path(path_);
+  if (!debug_callback && stat(snapshot_path).is_ok()) {
+    auto r_snapshot = detail::BinlogSnapshot::open(snapshot_path);
+    if (r_snapshot.is_error()) {
+      LOG(WARNING) << "Failed to open snapshot of binlog \"" << path_ << "\": " << r_snapshot.error();
+      unlink(snapshot_path).ignore();
+    } else {
+      snapshot = r_snapshot.move_as_ok();
+    }
+  }
+  auto apply_snapshot = [&] {
+    auto status = load_snapshot(*snapshot, reader);
+    if (status.is_error()) {
+      LOG(WARNING) << "Ignore snapshot of binlog \"" << path_ << "\": " << status;
+      unlink(snapshot_path).ignore();
+    }
+    snapshot = nullptr;
+  };
+  if (snapshot != nullptr && !snapshot->is_encrypted()) {
+    apply_snapshot();
+  }
+
   while (true) {
-    BinlogEvent event;
-    auto r_need_size = reader.read_next(&event);
+    string raw_event;
+    auto r_need_size = reader.read_next(&raw_event);
     if (r_need_size.is_error()) {
+      if (!flush_validator()) {
+        break;
+      }
       if (r_need_size.error().code() == -2) {
         auto old_size = detail::file_size(path_);
         auto offset = reader.offset();
@@ -534,24 +1219,57 @@ Status Binlog::load_binlog(const Callback &callback, const Callback &debug_callb
     auto need_size = r_need_size.move_as_ok();
     // LOG(ERROR) << "Need size = " << need_size;
     if (need_size == 0) {
-      if (debug_callback) {
-        debug_callback(event);
+      if (snapshot != nullptr && !detail::is_service_event(raw_event)) {
+        // encrypted binlogs begin with the encryption event
+        snapshot = nullptr;
+      }
+      if (validator != nullptr && !detail::is_service_event(raw_event)) {
+        auto status = validator->add_event(std::move(raw_event), reader.offset(), add_event);
+        if (status.is_error()) {
+          LOG(ERROR) << status;
+          break;
+        }
+        continue;
       }
-      do_add_event(std::move(event));
+
+      // service events can change encryption, so they are applied synchronously
+      if (!flush_validator()) {
+        break;
+      }
+      BinlogEvent event;
+      event.debug_info_ = BinlogDebugInfo{__FILE__, __LINE__};
+      event.init(std::move(raw_event));
+      auto status = event.validate();
+      if (status.is_error()) {
+        LOG(ERROR) << status;
+        break;
+      }
+      event.offset_ = reader.offset();
+      add_event(std::move(event));
       if (info_.wrong_password) {
         return Status::OK();
       }
+      if (snapshot != nullptr) {
+        // an encrypted snapshot is applied right after the encryption event
+        if (encryption_type_ == EncryptionType::AesCtr && fd_events_ == 1) {
+          apply_snapshot();
+        } else {
+          snapshot = nullptr;
+        }
+      }
     } else {
-      TRY_STATUS(fd_.flush_read(max(need_size, static_cast<size_t>(4096))));
+      TRY_STATUS(fd_.flush_read(max(need_size, LOAD_READ_SIZE)));
       buffer_reader_.sync_with_writer();
       if (byte_flow_flag_) {
         byte_flow_source_.wakeup();
       }
       if (reader.input()->size() < need_size) {
+        flush_validator();
         break;
       }
     }
   }
+  validator = nullptr;
 
   auto offset = processor_->offset();
   CHECK(offset >= 0);
@@ -585,11 +1303,152 @@ Status Binlog::load_binlog(const Callback &callback, const Callback &debug_callb
   return Status::OK();
 }
 
+string Binlog::get_snapshot_path(Slice path) {
+  return PSTRING() << path << ".snapshot";
+}
+
+Status Binlog::load_snapshot(const detail::BinlogSnapshot &snapshot, detail::BinlogReader &reader) {
+  CHECK(state_ == State::Load);
+  CHECK(processor_->last_event_id() == 0);
+  const auto &header = snapshot.header_;
+  if (snapshot.is_encrypted() != (encryption_type_ == EncryptionType::AesCtr)) {
+    return Status::Error("Snapshot encryption doesn't match the binlog");
+  }
+  TRY_RESULT(file_size, fd_.get_size());
+  if (header.binlog_size_ < fd_size_ || header.binlog_size_ > file_size) {
+    return Status::Error(PSLICE() << "Snapshot is for binlog part of size " << header.binlog_size_
+                                  << ", but the binlog has size " << file_size);
+  }
+  TRY_RESULT(binlog_hash, detail::get_binlog_hash(fd_, header.binlog_size_));
+  if (binlog_hash != header.binlog_hash_) {
+    return Status::Error("Snapshot is for another binlog");
+  }
+
+  auto events_data = snapshot.events_;
+  string decrypted_events_data;
+  if (snapshot.is_encrypted()) {
+    decrypted_events_data = events_data.str();
+    AesCtrState aes_ctr_state;
+    aes_ctr_state.init(as_slice(aes_ctr_key_), header.iv_);
+    aes_ctr_state.decrypt(decrypted_events_data, MutableSlice(decrypted_events_data));
+    events_data = decrypted_events_data;
+  }
+  if (crc32c(events_data) != header.events_crc32c_) {
+    return Status::Error("Snapshot checksum mismatch");
+  }
+  vector<BinlogEvent> events;
+  TRY_STATUS(
+      detail::parse_binlog_snapshot_events(events_data, header.last_event_id_, header.binlog_size_, events));
+
+  auto encrypted_data_offset = fd_size_;
+  processor_->restore(std::move(events), header.last_event_id_, header.binlog_size_);
+  fd_size_ = header.binlog_size_;
+  fd_events_ = header.binlog_event_count_;
+  snapshot_binlog_size_ = fd_size_;
+  snapshot_events_size_ = processor_->total_raw_events_size();
+  info_.was_snapshot_used = true;
+  VLOG(binlog) << "Load snapshot of " << tag("name", path_) << tag("binlog_size", format::as_size(fd_size_))
+               << tag("events_size", format::as_size(snapshot_events_size_))
+               << tag("tail_size", format::as_size(file_size - fd_size_));
+
+  // continue to read the binlog after the part saved in the snapshot
+  fd_.seek(fd_size_).ensure();
+  fd_.get_poll_info().add_flags(PollFlags::Read());
+  buffer_writer_ = ChainBufferWriter();
+  buffer_reader_ = buffer_writer_.extract_reader();
+  reader.set_offset(fd_size_);
+  if (encryption_type_ == EncryptionType::AesCtr) {
+    detail::init_aes_ctr_state(aes_ctr_state_, as_slice(aes_ctr_key_), aes_ctr_iv_, fd_size_ - encrypted_data_offset);
+  }
+  update_read_encryption();
+  return Status::OK();
+}
+
+void Binlog::try_snapshot() {
+  if (reindex_worker_ != nullptr || snapshot_worker_ != nullptr || fd_size_ <= MIN_SNAPSHOT_BINLOG_SIZE) {
+    return;
+  }
+  auto replayed_size = snapshot_events_size_ + fd_size_ - snapshot_binlog_size_;
+  if (replayed_size * 100 > processor_->total_raw_events_size() * SNAPSHOT_REPLAYED_SIZE_PERCENT) {
+    start_background_snapshot();
+  }
+}
+
+void Binlog::start_background_snapshot() {
+  CHECK(state_ == State::Run);
+  CHECK(snapshot_worker_ == nullptr);
+
+  auto start_time = Clocks::monotonic();
+  // the snapshot can include only events, which were written to the file
+  flush();
+
+  // the next snapshot isn't created until enough events are added, even if this one fails
+  snapshot_binlog_size_ = fd_size_;
+  snapshot_events_size_ = processor_->total_raw_events_size();
+
+  detail::BinlogSnapshotHeader header;
+  header.binlog_size_ = fd_size_;
+  header.binlog_event_count_ = fd_events_;
+  header.last_event_id_ = processor_->last_event_id();
+  auto r_binlog_hash = detail::get_binlog_hash(fd_, fd_size_);
+  if (r_binlog_hash.is_error()) {
+    LOG(ERROR) << "Failed to create snapshot of binlog \"" << path_ << "\": " << r_binlog_hash.error();
+    return;
+  }
+  header.binlog_hash_ = r_binlog_hash.move_as_ok();
+  if (encryption_type_ == EncryptionType::AesCtr) {
+    header.iv_.resize(detail::BinlogSnapshotHeader::iv_size());
+    Random::secure_bytes(header.iv_);
+  }
+
+  vector<string> events;
+  processor_->for_each([&](BinlogEvent &event) { events.push_back(event.raw_event_); });
+
+  snapshot_worker_ = td::make_unique<detail::BinlogSnapshotWorker>(get_snapshot_path(path_), std::move(header),
+                                                                   std::move(events), as_slice(aes_ctr_key_));
+  snapshot_worker_->start_time_ = start_time;
+  snapshot_worker_->start();
+  VLOG(binlog) << "Start background snapshot of " << tag("name", path_)
+               << tag("binlog_size", format::as_size(snapshot_binlog_size_))
+               << tag("events_size", format::as_size(snapshot_events_size_))
+               << tag("time", format::as_time(Clocks::monotonic() - start_time));
+}
+
+void Binlog::try_finish_background_snapshot() {
+  if (snapshot_worker_ == nullptr || !snapshot_worker_->is_ready()) {
+    return;
+  }
+
+  auto worker = std::move(snapshot_worker_);
+  worker->join();
+  auto status = worker->move_status();
+  if (status.is_error()) {
+    LOG(ERROR) << "Failed to save snapshot of binlog \"" << path_ << "\": " << status;
+    unlink(worker->get_new_path()).ignore();
+    return;
+  }
+  VLOG(binlog) << "Finish background snapshot of " << tag("name", path_)
+               << tag("events_size", format::as_size(worker->header().events_size_))
+               << tag("time", format::as_time(Clocks::monotonic() - worker->start_time_));
+}
+
+void Binlog::cancel_background_snapshot() {
+  if (snapshot_worker_ == nullptr) {
+    return;
+  }
+
+  snapshot_worker_->cancel();
+  if (snapshot_worker_->move_status().is_error()) {
+    unlink(snapshot_worker_->get_new_path()).ignore();
+  }
+  snapshot_worker_ = nullptr;
+  VLOG(binlog) << "Cancel background snapshot of " << tag("name", path_);
+}
+
 void Binlog::update_encryption(Slice key, Slice iv) {
   as_mutable_slice(aes_ctr_key_).copy_from(key);
-  UInt128 aes_ctr_iv;
-  as_mutable_slice(aes_ctr_iv).copy_from(iv);
-  aes_ctr_state_.init(as_slice(aes_ctr_key_), as_slice(aes_ctr_iv));
+  as_mutable_slice(aes_ctr_iv_).copy_from(iv);
+  aes_ctr_state_.init(as_slice(aes_ctr_key_), as_slice(aes_ctr_iv_));
 }
 
 void Binlog::reset_encryption() {
@@ -628,6 +1487,7 @@ void Binlog::do_reindex() {
   flush_events_buffer(true);
   // start reindex
   CHECK(state_ == State::Run);
+  cancel_background_snapshot();
   state_ = State::Reindex;
   SCOPE_EXIT {
     state_ = State::Run;
@@ -639,7 +1499,8 @@ void Binlog::do_reindex() {
 
   string new_path = path_ + ".new";
 
-  auto r_opened_file = open_binlog(new_path, FileFd::Flags::Write | FileFd::Flags::Create | FileFd::Truncate);
+  auto r_opened_file =
+      open_binlog(new_path, FileFd::Flags::Read | FileFd::Flags::Write | FileFd::Flags::Create | FileFd::Truncate);
   if (r_opened_file.is_error()) {
     LOG(ERROR) << "Can't open new binlog for regenerate: " << r_opened_file.error();
     return;
@@ -668,7 +1529,16 @@ void Binlog::do_reindex() {
     need_sync_ = false;
   }
 
-  // finish_reindex
+  finish_reindex(std::move(old_fd), new_path, "Regenerate index", start_time, start_size, start_events);
+}
+
+void Binlog::finish_reindex(BufferedFdBase<FileFd> old_fd, const string &new_path, Slice reindex_type,
+                            double start_time, int64 start_size, uint64 start_events) {
+  // the snapshot must be deleted before the binlog is replaced, because it describes the old binlog
+  unlink(get_snapshot_path(path_)).ignore();
+  snapshot_binlog_size_ = 0;
+  snapshot_events_size_ = 0;
+
   auto status = unlink(path_);
   LOG_IF(FATAL, status.is_error()) << "Failed to unlink old binlog: " << status;
   old_fd.close();  // now we can close old file and release the system lock
@@ -702,7 +1572,7 @@ void Binlog::do_reindex() {
     } else {
       LOG(INFO) << msg;
     }
-  }(PSLICE() << "Regenerate index " << tag("name", path_) << tag("time", format::as_time(finish_time - start_time))
+  }(PSLICE() << reindex_type << ' ' << tag("name", path_) << tag("time", format::as_time(finish_time - start_time))
              << tag("before_size", format::as_size(start_size)) << tag("after_size", format::as_size(finish_size))
              << tag("ratio", ratio) << tag("before_events", start_events) << tag("after_events", finish_events));
 
@@ -716,6 +1586,131 @@ void Binlog::do_reindex() {
   update_write_encryption();
 }
 
+void Binlog::start_background_reindex() {
+  flush_events_buffer(true);
+  CHECK(state_ == State::Run);
+  CHECK(reindex_worker_ == nullptr);
+  cancel_background_snapshot();
+
+  auto start_time = Clocks::monotonic();
+  string new_path = path_ + ".new";
+  auto r_opened_file =
+      open_binlog(new_path, FileFd::Flags::Read | FileFd::Flags::Write | FileFd::Flags::Create | FileFd::Truncate);
+  if (r_opened_file.is_error()) {
+    LOG(ERROR) << "Can't open new binlog for regenerate: " << r_opened_file.error();
+    return;
+  }
+
+  BufferSlice encryption_event;
+  string iv;
+  if (encryption_type_ == EncryptionType::AesCtr) {
+    // the key doesn't change, so there is no need to run the slow KDF again
+    using EncryptionEvent = detail::AesCtrEncryptionEvent;
+    EncryptionEvent event;
+    event.key_salt_ = aes_ctr_key_salt_;
+    event.iv_.resize(EncryptionEvent::iv_size());
+    Random::secure_bytes(event.iv_);
+    event.key_hash_ = EncryptionEvent::generate_hash(as_slice(aes_ctr_key_));
+    iv = event.iv_;
+    encryption_event =
+        BinlogEvent::create_raw(0, BinlogEvent::ServiceTypes::AesCtrEncryption, 0, create_default_storer(event));
+  }
+
+  vector<string> events;
+  processor_->for_each([&](BinlogEvent &event) { events.push_back(event.raw_event_); });
+
+  auto start_size = detail::file_size(path_);
+  reindex_worker_ = td::make_unique<detail::BinlogReindexWorker>(r_opened_file.move_as_ok(), path_, std::move(events),
+                                                              std::move(encryption_event), as_slice(aes_ctr_key_), iv,
+                                                              start_size != 0);
+  reindex_worker_->start_time_ = start_time;
+  reindex_worker_->start_size_ = start_size;
+  reindex_worker_->start_events_ = fd_events_;
+  reindex_tail_events_.clear();
+  reindex_worker_->start();
+  VLOG(binlog) << "Start background reindex of " << tag("name", path_) << tag("size", format::as_size(start_size))
+               << tag("time", format::as_time(Clocks::monotonic() - start_time));
+}
+
+void Binlog::try_finish_background_reindex() {
+  if (reindex_worker_ == nullptr || !reindex_worker_->is_ready() || state_ != State::Run) {
+    return;
+  }
+
+  auto worker = std::move(reindex_worker_);
+  worker->join();
+  string new_path = path_ + ".new";
+  auto status = worker->move_status();
+  if (status.is_error()) {
+    LOG(ERROR) << "Failed to regenerate binlog in background: " << status;
+    worker->fd().close();
+    FileFd::remove_local_lock(new_path);
+    unlink(new_path).ignore();
+    reindex_tail_events_.clear();
+    return;
+  }
+
+  auto switch_start_time = Clocks::monotonic();
+  LOG(INFO) << "Finish background reindex of " << tag("name", path_)
+            << tag("time", format::as_time(switch_start_time - worker->start_time_))
+            << tag("tail_events", reindex_tail_events_.size());
+
+  // write all pending events to the old binlog before switching to the new one
+  flush();
+
+  state_ = State::Reindex;
+  SCOPE_EXIT {
+    state_ = State::Run;
+  };
+
+  auto old_fd = std::move(fd_);  // can't close fd_ now, because it will release file lock
+  fd_ = BufferedFdBase<FileFd>(std::move(worker->fd()));
+
+  buffer_writer_ = ChainBufferWriter();
+  buffer_reader_ = buffer_writer_.extract_reader();
+  if (worker->is_encrypted()) {
+    aes_ctr_state_ = worker->move_aes_ctr_state();
+  }
+  update_write_encryption();
+
+  fd_size_ = worker->written_size();
+  fd_events_ = worker->written_events();
+  auto tail_events = std::move(reindex_tail_events_);
+  reindex_tail_events_.clear();
+  for (auto &raw_event : tail_events) {
+    BinlogEvent event;
+    event.debug_info_ = BinlogDebugInfo{__FILE__, __LINE__};
+    event.init(std::move(raw_event));
+    do_event(std::move(event));
+  }
+  {
+    flush();
+    if (worker->start_size_ != 0) {
+      auto sync_status = fd_.sync_barrier();
+      LOG_IF(FATAL, sync_status.is_error()) << "Failed to sync binlog: " << sync_status;
+    }
+    need_sync_ = false;
+  }
+
+  finish_reindex(std::move(old_fd), new_path, "Switch to regenerated index", switch_start_time, worker->start_size_,
+                 worker->start_events_);
+}
+
+void Binlog::cancel_background_reindex() {
+  if (reindex_worker_ == nullptr) {
+    return;
+  }
+
+  reindex_worker_->cancel();
+  string new_path = path_ + ".new";
+  reindex_worker_->fd().close();
+  FileFd::remove_local_lock(new_path);
+  unlink(new_path).ignore();
+  reindex_worker_ = nullptr;
+  reindex_tail_events_.clear();
+  VLOG(binlog) << "Cancel background reindex of " << tag("name", path_);
+}
+
 string Binlog::debug_get_binlog_data(int64 begin_offset, int64 end_offset) {
   if (begin_offset > end_offset) {
     return "Begin offset is bigger than end_offset";
@@ -35,12 +35,16 @@ struct BinlogInfo {
   bool is_encrypted{false};
   bool wrong_password{false};
   bool is_opened{false};
+  bool was_snapshot_used{false};
 };
 
 namespace detail {
 class BinlogReader;
 class BinlogEventsProcessor;
 class BinlogEventsBuffer;
+class BinlogReindexWorker;
+struct BinlogSnapshot;
+class BinlogSnapshotWorker;
 }  // namespace detail
 
 class Binlog {
@@ -130,6 +134,19 @@ class Binlog {
     return info_;
   }
 
+  // if enabled, all subsequently added events are checksummed with CRC32C and marked with the flag Crc32c;
+  // the binlog can't be opened by previous TDLib versions after that
+  void set_use_crc32c(bool use_crc32c) {
+    use_crc32c_ = use_crc32c;
+  }
+
+  // big binlogs are regenerated in background when their size exceeds this percentage of the size of live events
+  static constexpr int64 BACKGROUND_REINDEX_SIZE_PERCENT = 200;
+
+  // a snapshot of live events of big binlogs is saved in background, when the amount of data to be read on the next
+  // start exceeds this percentage of the size of live events; then only events added after the snapshot are read
+  static constexpr int64 SNAPSHOT_REPLAYED_SIZE_PERCENT = 150;
+
  private:
   BufferedFdBase<FileFd> fd_;
   ChainBufferWriter buffer_writer_;
@@ -145,9 +162,11 @@ class Binlog {
   // AesCtrEncryption
   string aes_ctr_key_salt_;
   UInt256 aes_ctr_key_;
+  UInt128 aes_ctr_iv_;
   AesCtrState aes_ctr_state_;
 
   bool byte_flow_flag_ = false;
+  bool use_crc32c_ = false;
   ByteFlowSource byte_flow_source_;
   ByteFlowSink byte_flow_sink_;
   AesCtrByteFlow aes_xcode_byte_flow_;
@@ -159,18 +178,43 @@ class Binlog {
   unique_ptr<detail::BinlogEventsProcessor> processor_;
   unique_ptr<detail::BinlogEventsBuffer> events_buffer_;
   bool in_flush_events_buffer_{false};
+  unique_ptr<detail::BinlogReindexWorker> reindex_worker_;
+  vector<string> reindex_tail_events_;
+  unique_ptr<detail::BinlogSnapshotWorker> snapshot_worker_;
+  int64 snapshot_binlog_size_{0};  // size of the binlog part, events of which are saved in the last snapshot
+  int64 snapshot_events_size_{0};  // total size of events saved in the last snapshot
   uint64 last_event_id_{0};
   double need_flush_since_ = 0;
   double next_buffer_flush_time_ = 0;
   bool need_sync_{false};
   enum class State { Empty, Load, Reindex, Run } state_{State::Empty};
 
+  // binlog is read sequentially on start, so it is read by big chunks
+  static constexpr size_t LOAD_READ_SIZE = 1 << 20;
+
   static Result<FileFd> open_binlog(const string &path, int32 flags);
   size_t flush_events_buffer(bool force);
   void do_add_event(BinlogEvent &&event);
   void do_event(BinlogEvent &&event);
   Status load_binlog(const Callback &callback, const Callback &debug_callback = Callback()) TD_WARN_UNUSED_RESULT;
   void do_reindex();
+  void finish_reindex(BufferedFdBase<FileFd> old_fd, const string &new_path, Slice reindex_type, double start_time,
+                      int64 start_size, uint64 start_events);
+
+  // binlogs bigger than this are regenerated on a separate thread while new events are still appended
+  static constexpr int64 MIN_BACKGROUND_REINDEX_SIZE = 1 << 20;
+  void try_reindex();
+  void start_background_reindex();
+  void try_finish_background_reindex();
+  void cancel_background_reindex();
+
+  static constexpr int64 MIN_SNAPSHOT_BINLOG_SIZE = 1 << 20;
+  static string get_snapshot_path(Slice path);
+  Status load_snapshot(const detail::BinlogSnapshot &snapshot, detail::BinlogReader &reader) TD_WARN_UNUSED_RESULT;
+  void try_snapshot();
+  void start_background_snapshot();
+  void try_finish_background_snapshot();
+  void cancel_background_snapshot();
 
   void update_encryption(Slice key, Slice iv);
   void reset_encryption();
@@ -43,9 +43,12 @@ Status BinlogEvent::validate() const {
     return Status::Error(PSLICE() << "Size of event changed: " << tag("was", size_) << tag("now", size)
                                   << tag("real size", raw_event_.size()));
   }
-  parser.fetch_string_raw<Slice>(size_ - TAIL_SIZE - sizeof(int));  // skip
+  parser.fetch_long();  // id
+  parser.fetch_int();   // type
+  auto flags = parser.fetch_int();
+  parser.fetch_string_raw<Slice>(size_ - TAIL_SIZE - 5 * sizeof(int));  // skip
   auto stored_crc32 = static_cast<uint32>(parser.fetch_int());
-  auto calculated_crc = crc32(Slice(as_slice(raw_event_).data(), size_ - TAIL_SIZE));
+  auto calculated_crc = calc_crc32(flags, Slice(as_slice(raw_event_).data(), size_ - TAIL_SIZE));
   if (calculated_crc != crc32_ || calculated_crc != stored_crc32) {
     return Status::Error(PSLICE() << "CRC mismatch " << tag("actual", format::as_hex(calculated_crc))
                                   << tag("expected", format::as_hex(crc32_)) << public_to_string());
@@ -53,6 +56,25 @@ Status BinlogEvent::validate() const {
   return Status::OK();
 }
 
+uint32 BinlogEvent::calc_crc32(int32 flags, Slice data) {
+  if ((flags & Flags::Crc32c) != 0) {
+    return crc32c(data);
+  }
+  return crc32(data);
+}
+
+void BinlogEvent::set_crc32c_flag() {
+  CHECK(raw_event_.size() >= MIN_SIZE);
+  if ((flags_ & Flags::Crc32c) != 0) {
+    return;
+  }
+  flags_ |= Flags::Crc32c;
+  auto raw_event = MutableSlice(raw_event_);
+  TlStorerUnsafe(raw_event.ubegin() + 4 + 8 + 4).store_int(flags_);
+  crc32_ = calc_crc32(flags_, raw_event.copy().truncate(raw_event.size() - TAIL_SIZE));
+  TlStorerUnsafe(raw_event.uend() - TAIL_SIZE).store_int(static_cast<int32>(crc32_));
+}
+
 BufferSlice BinlogEvent::create_raw(uint64 id, int32 type, int32 flags, const Storer &storer) {
   auto raw_event = BufferSlice{storer.size() + MIN_SIZE};
 
@@ -67,7 +89,7 @@ BufferSlice BinlogEvent::create_raw(uint64 id, int32 type, int32 flags, const St
   tl_storer.store_storer(storer);
 
   CHECK(tl_storer.get_buf() == raw_event.as_slice().uend() - TAIL_SIZE);
-  tl_storer.store_int(crc32(raw_event.as_slice().truncate(raw_event.size() - TAIL_SIZE)));
+  tl_storer.store_int(calc_crc32(flags, raw_event.as_slice().truncate(raw_event.size() - TAIL_SIZE)));
 
   return raw_event;
 }
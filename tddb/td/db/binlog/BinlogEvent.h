@@ -67,7 +67,10 @@ struct BinlogEvent {
   BinlogDebugInfo debug_info_;
 
   enum ServiceTypes { Header = -1, Empty = -2, AesCtrEncryption = -3, NoEncryption = -4 };
-  enum Flags { Rewrite = 1, Partial = 2 };
+  // events with the flag Crc32c are checksummed with CRC32C instead of the legacy zlib CRC32;
+  // the flag is opt-in, because previous TDLib versions don't know it and would drop the binlog starting from
+  // the first such event as corrupted, so it must be used only for binlogs, which will never be opened by them
+  enum Flags { Rewrite = 1, Partial = 2, Crc32c = 4 };
 
   Slice get_data() const;
 
@@ -103,6 +106,10 @@ struct BinlogEvent {
 
   void init(string raw_event);
 
+  static uint32 calc_crc32(int32 flags, Slice data);
+
+  void set_crc32c_flag();
+
   Status validate() const TD_WARN_UNUSED_RESULT;
 };
 
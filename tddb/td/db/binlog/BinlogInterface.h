@@ -37,6 +37,8 @@ class BinlogInterface {
   void add_raw_event(uint64 event_id, BufferSlice &&raw_event, Promise<> promise = Promise<>()) {
     add_raw_event_impl(event_id, std::move(raw_event), std::move(promise), {});
   }
+  // promises passed with events and to lazy_sync are set after the next disk sync, which can be delayed by seconds;
+  // force_sync must be used if the events need to be durable as soon as possible
   void lazy_sync(Promise<> promise = Promise<>()) {
     add_raw_event_impl(next_event_id(), BufferSlice(), std::move(promise), {});
   }
@@ -74,6 +76,7 @@ class BinlogInterface {
     return seq_no;
   }
 
+  // syncs all previously added events to disk within a short group commit window
   virtual void force_sync(Promise<> promise) = 0;
   virtual void force_flush() = 0;
   virtual void change_key(DbKey db_key, Promise<> promise) = 0;
@@ -13,12 +13,22 @@
 #include "td/utils/Time.h"
 
 #include <map>
+#include <utility>
 
 namespace td {
 namespace detail {
+struct BinlogSyncCounters {
+  std::atomic<uint64> sync_count{0};
+  std::atomic<uint64> synced_request_count{0};
+  std::atomic<uint64> max_batch_size{0};
+  std::atomic<uint64> total_commit_latency_us{0};
+  std::atomic<uint64> max_commit_latency_us{0};
+};
+
 class BinlogActor final : public Actor {
  public:
-  BinlogActor(unique_ptr<Binlog> binlog, uint64 seq_no) : binlog_(std::move(binlog)), processor_(seq_no) {
+  BinlogActor(unique_ptr<Binlog> binlog, uint64 seq_no, std::shared_ptr<BinlogSyncCounters> sync_counters)
+      : binlog_(std::move(binlog)), processor_(seq_no), sync_counters_(std::move(sync_counters)) {
   }
   void close(Promise<> promise) {
     binlog_->close().ensure();
@@ -63,10 +73,11 @@ class BinlogActor final : public Actor {
 
   void force_sync(Promise<> &&promise) {
     auto seq_no = processor_.max_unfinished_seq_no();
+    auto request_time = Time::now();
     if (processor_.max_finished_seq_no() == seq_no) {
-      do_immediate_sync(std::move(promise));
+      do_immediate_sync(std::move(promise), request_time);
     } else {
-      immediate_sync_promises_.emplace(seq_no, std::move(promise));
+      immediate_sync_promises_.emplace(seq_no, std::make_pair(std::move(promise), request_time));
     }
   }
 
@@ -81,24 +92,37 @@ class BinlogActor final : public Actor {
     promise.set_value(Unit());
   }
 
+  void set_group_commit_delay(double delay) {
+    group_commit_delay_ = delay;
+    update_sync_at();
+  }
+
  private:
   unique_ptr<Binlog> binlog_;
 
   OrderedEventsProcessor<Event> processor_;
 
-  std::multimap<uint64, Promise<>> immediate_sync_promises_;
+  std::multimap<uint64, std::pair<Promise<>, double>> immediate_sync_promises_;
   std::vector<Promise<>> sync_promises_;
-  bool force_sync_flag_ = false;
-  bool lazy_sync_flag_ = false;
   bool flush_flag_ = false;
   double wakeup_at_ = 0;
 
-  static constexpr double FLUSH_TIMEOUT = 0.001;  // 1ms
+  double group_commit_delay_ = DEFAULT_GROUP_COMMIT_DELAY;
 
-  void wakeup_after(double after) {
-    auto now = Time::now_cached();
-    wakeup_at(now + after);
-  }
+  // all pending sync requests are committed together at sync_at_, which is group_commit_delay_ after the first
+  // forced sync request, or LAZY_SYNC_DELAY after the first lazy sync request if there are no forced requests
+  double sync_at_ = 0;
+  double first_sync_request_time_ = 0;
+  double first_force_sync_request_time_ = 0;
+  bool has_force_sync_request_ = false;
+  uint64 sync_request_count_ = 0;
+  double sync_request_time_sum_ = 0;
+
+  std::shared_ptr<BinlogSyncCounters> sync_counters_;
+
+  static constexpr double FLUSH_TIMEOUT = 0.001;               // 1ms
+  static constexpr double DEFAULT_GROUP_COMMIT_DELAY = 0.003;  // 3ms
+  static constexpr double LAZY_SYNC_DELAY = 30;                // 30s
 
   void wakeup_at(double at) {
     if (wakeup_at_ == 0 || wakeup_at_ > at) {
@@ -117,7 +141,8 @@ class BinlogActor final : public Actor {
     if (now > need_flush_since + FLUSH_TIMEOUT - 1e-9) {
       binlog_->flush();
     } else {
-      if (!force_sync_flag_) {
+      // there is no need to flush before the sync
+      if (sync_request_count_ == 0 || sync_at_ > need_flush_since + FLUSH_TIMEOUT) {
         flush_flag_ = true;
         wakeup_at(need_flush_since + FLUSH_TIMEOUT);
       }
@@ -128,46 +153,93 @@ class BinlogActor final : public Actor {
     auto seq_no = processor_.max_finished_seq_no();
     for (auto it = immediate_sync_promises_.begin(), end = immediate_sync_promises_.end();
          it != end && it->first <= seq_no; it = immediate_sync_promises_.erase(it)) {
-      do_immediate_sync(std::move(it->second));
+      do_immediate_sync(std::move(it->second.first), it->second.second);
+    }
+  }
+
+  void do_immediate_sync(Promise<> &&promise, double request_time) {
+    add_sync_request(std::move(promise), request_time, true);
+  }
+
+  void do_lazy_sync(Promise<> &&promise) {
+    if (!promise) {
+      return;
     }
+    add_sync_request(std::move(promise), Time::now(), false);
   }
 
-  void do_immediate_sync(Promise<> &&promise) {
+  void add_sync_request(Promise<> &&promise, double request_time, bool is_forced) {
     if (promise) {
       sync_promises_.emplace_back(std::move(promise));
     }
-    if (!force_sync_flag_) {
-      force_sync_flag_ = true;
-      wakeup_after(0.003);
+    if (sync_request_count_ == 0) {
+      first_sync_request_time_ = request_time;
     }
+    if (is_forced && !has_force_sync_request_) {
+      has_force_sync_request_ = true;
+      first_force_sync_request_time_ = request_time;
+    }
+    sync_request_count_++;
+    sync_request_time_sum_ += request_time;
+    update_sync_at();
   }
 
-  void do_lazy_sync(Promise<> &&promise) {
-    if (!promise) {
+  void update_sync_at() {
+    if (sync_request_count_ == 0) {
       return;
     }
-    sync_promises_.emplace_back(std::move(promise));
-    if (!lazy_sync_flag_ && !force_sync_flag_) {
-      wakeup_after(30);
-      lazy_sync_flag_ = true;
+    // only forced sync requests shorten the group commit window; lazy requests are committed together with them
+    if (has_force_sync_request_) {
+      sync_at_ = min(first_force_sync_request_time_ + group_commit_delay_, first_sync_request_time_ + LAZY_SYNC_DELAY);
+    } else {
+      sync_at_ = first_sync_request_time_ + LAZY_SYNC_DELAY;
     }
+    wakeup_at(sync_at_);
+  }
+
+  void do_sync() {
+    binlog_->sync();
+    // LOG(ERROR) << "BINLOG SYNC";
+
+    auto now = Time::now();
+    auto to_us = [](double time) {
+      return static_cast<uint64>(max(time, 0.0) * 1e6);
+    };
+    auto &counters = *sync_counters_;
+    counters.sync_count.fetch_add(1, std::memory_order_relaxed);
+    counters.synced_request_count.fetch_add(sync_request_count_, std::memory_order_relaxed);
+    if (sync_request_count_ > counters.max_batch_size.load(std::memory_order_relaxed)) {
+      counters.max_batch_size.store(sync_request_count_, std::memory_order_relaxed);
+    }
+    counters.total_commit_latency_us.fetch_add(
+        to_us(static_cast<double>(sync_request_count_) * now - sync_request_time_sum_), std::memory_order_relaxed);
+    auto latency_us = to_us(now - first_sync_request_time_);
+    if (latency_us > counters.max_commit_latency_us.load(std::memory_order_relaxed)) {
+      counters.max_commit_latency_us.store(latency_us, std::memory_order_relaxed);
+    }
+    sync_request_count_ = 0;
+    sync_request_time_sum_ = 0;
+    has_force_sync_request_ = false;
+    sync_at_ = 0;
+
+    set_promises(sync_promises_);
   }
 
   void timeout_expired() final {
-    bool need_sync = lazy_sync_flag_ || force_sync_flag_;
-    lazy_sync_flag_ = false;
-    force_sync_flag_ = false;
-    bool need_flush = flush_flag_;
-    flush_flag_ = false;
     wakeup_at_ = 0;
-    if (need_sync) {
-      binlog_->sync();
-      // LOG(ERROR) << "BINLOG SYNC";
-      set_promises(sync_promises_);
-    } else if (need_flush) {
+    if (sync_request_count_ > 0 && Time::now() > sync_at_ - 1e-9) {
+      flush_flag_ = false;
+      do_sync();
+      return;
+    }
+    if (flush_flag_) {
+      flush_flag_ = false;
       try_flush();
       // LOG(ERROR) << "BINLOG FLUSH";
     }
+    if (sync_request_count_ > 0) {
+      wakeup_at(sync_at_);
+    }
   }
 };
 }  // namespace detail
@@ -190,8 +262,9 @@ Result<BinlogInfo> ConcurrentBinlog::init(string path, const Callback &callback,
 void ConcurrentBinlog::init_impl(unique_ptr<Binlog> binlog, int32 scheduler_id) {
   path_ = binlog->get_path().str();
   last_event_id_ = binlog->peek_next_event_id();
+  sync_counters_ = std::make_shared<detail::BinlogSyncCounters>();
   binlog_actor_ = create_actor_on_scheduler<detail::BinlogActor>(PSLICE() << "Binlog " << path_, scheduler_id,
-                                                                 std::move(binlog), last_event_id_);
+                                                                 std::move(binlog), last_event_id_, sync_counters_);
 }
 
 void ConcurrentBinlog::close_impl(Promise<> promise) {
@@ -215,6 +288,29 @@ void ConcurrentBinlog::change_key(DbKey db_key, Promise<> promise) {
   send_closure(binlog_actor_, &detail::BinlogActor::change_key, std::move(db_key), std::move(promise));
 }
 
+void ConcurrentBinlog::set_group_commit_delay(double delay) {
+  send_closure(binlog_actor_, &detail::BinlogActor::set_group_commit_delay, delay);
+}
+
+ConcurrentBinlog::SyncStatistics ConcurrentBinlog::get_sync_statistics() const {
+  SyncStatistics result;
+  if (sync_counters_ == nullptr) {
+    return result;
+  }
+  auto &counters = *sync_counters_;
+  result.sync_count = counters.sync_count.load(std::memory_order_relaxed);
+  result.synced_request_count = counters.synced_request_count.load(std::memory_order_relaxed);
+  result.max_batch_size = counters.max_batch_size.load(std::memory_order_relaxed);
+  if (result.synced_request_count > 0) {
+    result.average_commit_latency =
+        static_cast<double>(counters.total_commit_latency_us.load(std::memory_order_relaxed)) * 1e-6 /
+        static_cast<double>(result.synced_request_count);
+  }
+  result.max_commit_latency =
+      static_cast<double>(counters.max_commit_latency_us.load(std::memory_order_relaxed)) * 1e-6;
+  return result;
+}
+
 uint64 ConcurrentBinlog::erase_batch(vector<uint64> event_ids) {
   auto shift = narrow_cast<int32>(event_ids.size());
   if (shift == 0) {
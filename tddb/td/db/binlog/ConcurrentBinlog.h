@@ -14,21 +14,33 @@
 
 #include "td/utils/buffer.h"
 #include "td/utils/common.h"
+#include "td/utils/format.h"
 #include "td/utils/Promise.h"
 #include "td/utils/Slice.h"
 #include "td/utils/Status.h"
+#include "td/utils/StringBuilder.h"
 
 #include <atomic>
 #include <functional>
+#include <memory>
 
 namespace td {
 
 namespace detail {
 class BinlogActor;
+struct BinlogSyncCounters;
 }  // namespace detail
 
 class ConcurrentBinlog final : public BinlogInterface {
  public:
+  struct SyncStatistics {
+    uint64 sync_count = 0;
+    uint64 synced_request_count = 0;
+    uint64 max_batch_size = 0;
+    double average_commit_latency = 0;
+    double max_commit_latency = 0;
+  };
+
   using Callback = std::function<void(const BinlogEvent &)>;
   Result<BinlogInfo> init(string path, const Callback &callback, DbKey db_key = DbKey::empty(),
                           DbKey old_db_key = DbKey::empty(), int scheduler_id = -1) TD_WARN_UNUSED_RESULT;
@@ -58,6 +70,12 @@ class ConcurrentBinlog final : public BinlogInterface {
 
   uint64 erase_batch(vector<uint64> event_ids) final;
 
+  // all sync requests received during the delay after the first forced sync request are committed by a single disk
+  // sync together with all pending lazy sync requests; lazy sync requests alone are committed much later
+  void set_group_commit_delay(double delay);
+
+  SyncStatistics get_sync_statistics() const;
+
  private:
   void init_impl(unique_ptr<Binlog> binlog, int scheduler_id);
   void close_impl(Promise<> promise) final;
@@ -65,8 +83,17 @@ class ConcurrentBinlog final : public BinlogInterface {
   void add_raw_event_impl(uint64 event_id, BufferSlice &&raw_event, Promise<> promise, BinlogDebugInfo info) final;
 
   ActorOwn<detail::BinlogActor> binlog_actor_;
+  std::shared_ptr<detail::BinlogSyncCounters> sync_counters_;
   string path_;
   std::atomic<uint64> last_event_id_{0};
 };
 
+inline StringBuilder &operator<<(StringBuilder &string_builder, const ConcurrentBinlog::SyncStatistics &statistics) {
+  return string_builder << "BinlogSyncStatistics[" << tag("syncs", statistics.sync_count)
+                        << tag("requests", statistics.synced_request_count)
+                        << tag("max_batch_size", statistics.max_batch_size)
+                        << tag("average_latency", format::as_time(statistics.average_commit_latency))
+                        << tag("max_latency", format::as_time(statistics.max_commit_latency)) << ']';
+}
+
 }  // namespace td
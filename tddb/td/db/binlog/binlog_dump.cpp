@@ -5,6 +5,7 @@
 // file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
 //
 #include "td/db/binlog/Binlog.h"
+#include "td/db/binlog/BinlogEvent.h"
 
 #include "td/db/DbKey.h"
 
@@ -115,6 +116,8 @@ int main(int argc, char *argv[]) {
     Trie compressed_trie;
   };
   std::map<td::uint64, Info> info;
+  std::size_t crc32_event_count = 0;
+  std::size_t crc32c_event_count = 0;
 
   SET_VERBOSITY_LEVEL(VERBOSITY_NAME(ERROR));
   td::Binlog binlog;
@@ -131,6 +134,8 @@ int main(int argc, char *argv[]) {
           },
           td::DbKey::raw_key("cucumber"), td::DbKey::empty(), -1,
           [&](auto &event) mutable {
+            bool is_crc32c = (event.flags_ & td::BinlogEvent::Flags::Crc32c) != 0;
+            (is_crc32c ? crc32c_event_count : crc32_event_count)++;
             info[0].full_size += event.raw_event_.size();
             info[event.type_].full_size += event.raw_event_.size();
             if (event.type_ == ConfigPmcMagic || event.type_ == BinlogPmcMagic) {
@@ -139,11 +144,13 @@ int main(int argc, char *argv[]) {
             }
             LOG(PLAIN) << "LogEvent[" << td::tag("event_id", td::format::as_hex(event.id_))
                        << td::tag("type", event.type_) << td::tag("flags", event.flags_)
+                       << td::tag("checksum", is_crc32c ? "CRC32C" : "CRC32")
                        << td::tag("size", event.get_data().size())
                        << td::tag("data", td::format::escaped(event.get_data())) << "]\n";
           })
       .ensure();
 
+  LOG(PLAIN) << td::tag("crc32_events", crc32_event_count) << td::tag("crc32c_events", crc32c_event_count);
   for (auto &it : info) {
     LOG(PLAIN) << td::tag("handler", td::format::as_hex(it.first))
                << td::tag("full_size", td::format::as_size(it.second.full_size))
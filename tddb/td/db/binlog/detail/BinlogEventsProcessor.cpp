@@ -54,6 +54,23 @@ Status BinlogEventsProcessor::do_event(BinlogEvent &&event) {
   return Status::OK();
 }
 
+void BinlogEventsProcessor::restore(vector<BinlogEvent> &&events, uint64 last_event_id, int64 offset) {
+  CHECK(event_ids_.empty());
+  for (auto &event : events) {
+    CHECK(event.type_ >= 0);
+    auto fixed_event_id = event.id_ * 2;
+    CHECK(event_ids_.empty() || event_ids_.back() < fixed_event_id);
+    event.flags_ &= ~BinlogEvent::Flags::Rewrite;
+    total_raw_events_size_ += static_cast<int64>(event.raw_event_.size());
+    event_ids_.push_back(fixed_event_id);
+  }
+  events_ = std::move(events);
+  total_events_ = events_.size();
+  CHECK(event_ids_.empty() || event_ids_.back() <= last_event_id * 2);
+  last_event_id_ = last_event_id;
+  offset_ = offset;
+}
+
 void BinlogEventsProcessor::compactify() {
   CHECK(event_ids_.size() == events_.size());
   auto event_ids_from = event_ids_.begin();
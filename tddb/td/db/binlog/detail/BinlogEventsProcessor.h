@@ -21,6 +21,9 @@ class BinlogEventsProcessor {
     return do_event(std::move(event));
   }
 
+  // restores the state saved in a binlog snapshot; events must be sorted by their identifiers
+  void restore(vector<BinlogEvent> &&events, uint64 last_event_id, int64 offset);
+
   template <class CallbackT>
   void for_each(CallbackT &&callback) {
     for (size_t i = 0; i < event_ids_.size(); i++) {
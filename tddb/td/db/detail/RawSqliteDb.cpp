@@ -47,11 +47,56 @@ Status RawSqliteDb::last_error() {
   return last_error(db_, path());
 }
 
+Slice RawSqliteDb::get_sql_keyword(Slice sql) {
+  sql = trim(sql);
+  size_t size = 0;
+  while (size < sql.size() && is_alpha(sql[size])) {
+    size++;
+  }
+  if (size == 0) {
+    return Slice("exec");
+  }
+  return sql.substr(0, size);
+}
+
 bool RawSqliteDb::was_any_database_destroyed() {
   return was_database_destroyed.load(std::memory_order_relaxed);
 }
 
+tdsqlite3_stmt *RawSqliteDb::get_cached_statement(const string &sql) {
+  auto it = cached_statement_by_sql_.find(sql);
+  if (it == cached_statement_by_sql_.end()) {
+    statement_cache_miss_count_++;
+    return nullptr;
+  }
+  statement_cache_hit_count_++;
+  auto stmt = it->second->stmt_;
+  cached_statements_.erase(it->second);
+  cached_statement_by_sql_.erase(it);
+  return stmt;
+}
+
+void RawSqliteDb::put_cached_statement(string sql, tdsqlite3_stmt *stmt) {
+  CHECK(stmt != nullptr);
+  if (cached_statement_by_sql_.count(sql) > 0) {
+    // the same statement was used simultaneously twice; keep only one of them
+    tdsqlite3_finalize(stmt);
+    return;
+  }
+  if (cached_statements_.size() == MAX_CACHED_STATEMENT_COUNT) {
+    auto &least_recently_used = cached_statements_.back();
+    tdsqlite3_finalize(least_recently_used.stmt_);
+    cached_statement_by_sql_.erase(least_recently_used.sql_);
+    cached_statements_.pop_back();
+  }
+  cached_statements_.push_front(CachedStatement{std::move(sql), stmt});
+  cached_statement_by_sql_.emplace(cached_statements_.front().sql_, cached_statements_.begin());
+}
+
 RawSqliteDb::~RawSqliteDb() {
+  for (auto &cached_statement : cached_statements_) {
+    tdsqlite3_finalize(cached_statement.stmt_);
+  }
   auto rc = tdsqlite3_close(db_);
   LOG_IF(FATAL, rc != SQLITE_OK) << last_error(db_, path());
 }
@@ -6,12 +6,19 @@
 //
 #pragma once
 
+#include "td/utils/common.h"
+#include "td/utils/HashTableUtils.h"
 #include "td/utils/optional.h"
 #include "td/utils/Slice.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
 
+#include <functional>
+#include <list>
+#include <unordered_map>
+
 struct tdsqlite3;
+struct tdsqlite3_stmt;
 
 namespace td {
 namespace detail {
@@ -47,6 +54,9 @@ class RawSqliteDb {
 
   static bool was_any_database_destroyed();
 
+  // returns the first keyword of the SQL statement, which can be traced without leaking data or keys
+  static Slice get_sql_keyword(Slice sql);
+
   bool on_begin() {
     begin_cnt_++;
     return begin_cnt_ == 1;
@@ -67,11 +77,54 @@ class RawSqliteDb {
     return cipher_version_.copy();
   }
 
+  // returns nullptr if there is no unused prepared statement with the given SQL text
+  tdsqlite3_stmt *get_cached_statement(const string &sql);
+
+  // the statement must be already reset
+  void put_cached_statement(string sql, tdsqlite3_stmt *stmt);
+
+  uint64 get_statement_cache_hit_count() const {
+    return statement_cache_hit_count_;
+  }
+  uint64 get_statement_cache_miss_count() const {
+    return statement_cache_miss_count_;
+  }
+  size_t get_cached_statement_count() const {
+    return cached_statements_.size();
+  }
+
+  void set_wal_commit_callback(std::function<void()> callback, int32 autocheckpoint_frame_count) {
+    wal_commit_callback_ = std::move(callback);
+    wal_autocheckpoint_frame_count_ = autocheckpoint_frame_count;
+  }
+
+  // returns true, if WAL must be checkpointed by the writer
+  bool on_wal_commit(int32 wal_frame_count) {
+    if (wal_commit_callback_) {
+      wal_commit_callback_();
+    }
+    return wal_frame_count >= wal_autocheckpoint_frame_count_;
+  }
+
  private:
   tdsqlite3 *db_;
   std::string path_;
   size_t begin_cnt_{0};
   optional<int32> cipher_version_;
+  std::function<void()> wal_commit_callback_;
+  int32 wal_autocheckpoint_frame_count_ = 0;
+
+  static constexpr size_t MAX_CACHED_STATEMENT_COUNT = 64;
+
+  struct CachedStatement {
+    string sql_;
+    tdsqlite3_stmt *stmt_;
+  };
+  // the most recently used statements are at the beginning of the list
+  std::list<CachedStatement> cached_statements_;
+  std::unordered_map<string, std::list<CachedStatement>::iterator, Hash<string>> cached_statement_by_sql_;
+  uint64 statement_cache_hit_count_ = 0;
+  uint64 statement_cache_miss_count_ = 0;
 };
 
 }  // namespace detail
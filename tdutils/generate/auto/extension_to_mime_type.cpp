@@ -0,0 +1 @@
+// gperf stub
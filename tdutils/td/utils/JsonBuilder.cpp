@@ -6,14 +6,68 @@
 //
 #include "td/utils/JsonBuilder.h"
 
+#include "td/utils/bits.h"
 #include "td/utils/misc.h"
 #include "td/utils/ScopeGuard.h"
 #include "td/utils/SliceBuilder.h"
 
+#if defined(__SSE2__) || (TD_MSVC && defined(_M_X64))
+#define TD_HAVE_JSON_SSE2 1
+#include <emmintrin.h>
+#endif
+
 #include <cstring>
 
 namespace td {
 
+namespace {
+
+bool is_json_string_clean_char(unsigned char c, bool allow_non_ascii) {
+  return c >= 0x20 && c != '"' && c != '\\' && (allow_non_ascii || c < 0x80);
+}
+
+#if TD_HAVE_JSON_SSE2
+// returns a mask of the characters in the 16-byte block, which can't be copied to a JSON string as is
+uint32 get_json_string_escaped_mask_sse2(const char *s, bool allow_non_ascii) {
+  auto input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(s));
+  // characters 0x80-0xFF are negative, so the signed comparison finds them in addition to the control characters
+  auto is_escaped = allow_non_ascii ? _mm_cmpeq_epi8(_mm_min_epu8(input, _mm_set1_epi8(0x1F)), input)
+                                    : _mm_cmplt_epi8(input, _mm_set1_epi8(0x20));
+  is_escaped = _mm_or_si128(is_escaped, _mm_cmpeq_epi8(input, _mm_set1_epi8('"')));
+  is_escaped = _mm_or_si128(is_escaped, _mm_cmpeq_epi8(input, _mm_set1_epi8('\\')));
+  return static_cast<uint32>(_mm_movemask_epi8(is_escaped));
+}
+#endif
+
+// returns length of the longest prefix of the string, which can be copied to a JSON string as is
+size_t get_json_string_clean_prefix_length(const char *s, size_t len, bool allow_non_ascii) {
+  size_t pos = 0;
+#if TD_HAVE_JSON_SSE2
+  if (len >= 16) {
+    for (; pos + 16 <= len; pos += 16) {
+      auto mask = get_json_string_escaped_mask_sse2(s + pos, allow_non_ascii);
+      if (mask != 0) {
+        return pos + count_trailing_zeroes32(mask);
+      }
+    }
+    if (pos == len) {
+      return len;
+    }
+
+    // the last block overlaps with the already checked clean characters
+    pos = len - 16;
+    auto mask = get_json_string_escaped_mask_sse2(s + pos, allow_non_ascii);
+    return mask == 0 ? len : pos + count_trailing_zeroes32(mask);
+  }
+#endif
+  while (pos < len && is_json_string_clean_char(static_cast<unsigned char>(s[pos]), allow_non_ascii)) {
+    pos++;
+  }
+  return pos;
+}
+
+}  // namespace
+
 StringBuilder &operator<<(StringBuilder &sb, const JsonRawString &val) {
   sb << '"';
   SCOPE_EXIT {
@@ -23,6 +77,15 @@ StringBuilder &operator<<(StringBuilder &sb, const JsonRawString &val) {
   auto len = val.value_.size();
 
   for (size_t pos = 0; pos < len; pos++) {
+    auto clean_length = get_json_string_clean_prefix_length(s + pos, len - pos, true);
+    if (clean_length != 0) {
+      sb << Slice(s + pos, clean_length);
+      pos += clean_length;
+      if (pos == len) {
+        break;
+      }
+    }
+
     auto ch = static_cast<unsigned char>(s[pos]);
     switch (ch) {
       case '"':
@@ -67,6 +130,15 @@ StringBuilder &operator<<(StringBuilder &sb, const JsonString &val) {
   auto len = val.str_.size();
 
   for (size_t pos = 0; pos < len; pos++) {
+    auto clean_length = get_json_string_clean_prefix_length(s + pos, len - pos, false);
+    if (clean_length != 0) {
+      sb << Slice(s + pos, clean_length);
+      pos += clean_length;
+      if (pos == len) {
+        break;
+      }
+    }
+
     auto ch = static_cast<unsigned char>(s[pos]);
     switch (ch) {
       case '"':
@@ -100,8 +100,10 @@ class JsonOneChar {
 
   friend StringBuilder &operator<<(StringBuilder &sb, const JsonOneChar &val) {
     auto c = val.c_;
-    return sb << '\\' << 'u' << "0123456789abcdef"[c >> 12] << "0123456789abcdef"[(c >> 8) & 15]
-              << "0123456789abcdef"[(c >> 4) & 15] << "0123456789abcdef"[c & 15];
+    const char *hex_digits = "0123456789abcdef";
+    const char buf[6] = {'\\', 'u', hex_digits[c >> 12], hex_digits[(c >> 8) & 15], hex_digits[(c >> 4) & 15],
+                         hex_digits[c & 15]};
+    return sb << Slice(buf, sizeof(buf));
   }
 
  private:
@@ -14,6 +14,7 @@
 
 #include "td/utils/port/Mutex.h"
 
+#include <atomic>
 #include <utility>
 
 namespace td {
@@ -42,6 +43,7 @@ class MpscPollableQueue {
         reader_vector_.clear();
         reader_pos_ = 0;
         std::swap(writer_vector_, reader_vector_);
+        has_writer_values_.store(false, std::memory_order_relaxed);
         return narrow_cast<int>(reader_vector_.size());
       }
       event_fd_.acquire();
@@ -57,12 +59,41 @@ class MpscPollableQueue {
   void writer_put(ValueType value) {
     auto guard = lock_.lock();
     writer_vector_.push_back(std::move(value));
+    has_writer_values_.store(true, std::memory_order_relaxed);
     if (wait_event_fd_) {
       wait_event_fd_ = false;
       guard.reset();
       event_fd_.release();
     }
   }
+  // moves all values to the queue under one lock and publishes them, so writer_flush isn't needed;
+  // returns true if the reader had to be woken up
+  bool writer_put_batch(std::vector<ValueType> &values) {
+    if (values.empty()) {
+      return false;
+    }
+    auto guard = lock_.lock();
+    if (writer_vector_.empty()) {
+      std::swap(writer_vector_, values);
+    } else {
+      for (auto &value : values) {
+        writer_vector_.push_back(std::move(value));
+      }
+      values.clear();
+    }
+    has_writer_values_.store(true, std::memory_order_relaxed);
+    if (wait_event_fd_) {
+      wait_event_fd_ = false;
+      guard.reset();
+      event_fd_.release();
+      return true;
+    }
+    return false;
+  }
+  // can be called by the reader without locking, for example, to spin before waiting for the event fd
+  bool reader_has_values() const {
+    return reader_pos_ != reader_vector_.size() || has_writer_values_.load(std::memory_order_relaxed);
+  }
   EventFd &reader_get_event_fd() {
     return event_fd_;
   }
@@ -83,6 +114,7 @@ class MpscPollableQueue {
       event_fd_.close();
       wait_event_fd_ = false;
       writer_vector_.clear();
+      has_writer_values_.store(false, std::memory_order_relaxed);
       reader_vector_.clear();
       reader_pos_ = 0;
     }
@@ -102,6 +134,7 @@ class MpscPollableQueue {
   bool wait_event_fd_{false};
   EventFd event_fd_;
   std::vector<ValueType> writer_vector_;
+  std::atomic<bool> has_writer_values_{false};
   std::vector<ValueType> reader_vector_;
   size_t reader_pos_{0};
 };
@@ -128,6 +161,11 @@ class MpscPollableQueue {
     UNREACHABLE();
   }
 
+  bool writer_put_batch(std::vector<ValueType> &values) {
+    UNREACHABLE();
+    return false;
+  }
+
   void writer_flush() {
     UNREACHABLE();
   }
@@ -137,6 +175,11 @@ class MpscPollableQueue {
     return 0;
   }
 
+  bool reader_has_values() const {
+    UNREACHABLE();
+    return false;
+  }
+
   ValueType reader_get_unsafe() {
     UNREACHABLE();
     return ValueType();
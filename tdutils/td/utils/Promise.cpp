@@ -0,0 +1,122 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/Promise.h"
+
+#include "td/utils/Destructor.h"
+#include "td/utils/port/thread_local.h"
+
+#include <new>
+
+namespace td {
+namespace detail {
+
+namespace {
+
+// memory blocks are rounded up to BLOCK_SIZE_STEP, so a block freed by any thread can be reused by any other thread
+class PromiseMemoryPool {
+ public:
+  static constexpr size_t BLOCK_SIZE_STEP = 32;
+  static constexpr size_t BLOCK_SIZE_COUNT = 4;
+  static constexpr size_t MAX_BLOCK_SIZE = BLOCK_SIZE_STEP * BLOCK_SIZE_COUNT;
+  static constexpr size_t MAX_FREE_BLOCK_COUNT = 256;
+
+  PromiseMemoryPool() = default;
+  PromiseMemoryPool(const PromiseMemoryPool &) = delete;
+  PromiseMemoryPool &operator=(const PromiseMemoryPool &) = delete;
+  PromiseMemoryPool(PromiseMemoryPool &&) = delete;
+  PromiseMemoryPool &operator=(PromiseMemoryPool &&) = delete;
+  ~PromiseMemoryPool() {
+    for (auto block : free_blocks_) {
+      while (block != nullptr) {
+        auto next = block->next;
+        ::operator delete(block);
+        block = next;
+      }
+    }
+  }
+
+  static size_t get_block_index(size_t size) {
+    return (size - 1) / BLOCK_SIZE_STEP;
+  }
+
+  void *allocate(size_t index) {
+    auto block = free_blocks_[index];
+    if (block == nullptr) {
+      return ::operator new((index + 1) * BLOCK_SIZE_STEP);
+    }
+    free_blocks_[index] = block->next;
+    free_block_count_[index]--;
+    return block;
+  }
+
+  bool free(void *ptr, size_t index) {
+    if (free_block_count_[index] == MAX_FREE_BLOCK_COUNT) {
+      return false;
+    }
+    auto block = static_cast<FreeBlock *>(ptr);
+    block->next = free_blocks_[index];
+    free_blocks_[index] = block;
+    free_block_count_[index]++;
+    return true;
+  }
+
+ private:
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+  FreeBlock *free_blocks_[BLOCK_SIZE_COUNT] = {};
+  size_t free_block_count_[BLOCK_SIZE_COUNT] = {};
+};
+
+constexpr size_t PromiseMemoryPool::BLOCK_SIZE_STEP;
+constexpr size_t PromiseMemoryPool::MAX_BLOCK_SIZE;
+
+TD_THREAD_LOCAL PromiseMemoryPool *promise_memory_pool;  // static zero-initialized
+TD_THREAD_LOCAL bool is_promise_memory_pool_destroyed;   // static zero-initialized
+
+// returns nullptr if the thread-local pool has already been destroyed during the thread exit
+PromiseMemoryPool *get_promise_memory_pool() {
+  if (unlikely(promise_memory_pool == nullptr)) {
+    if (is_promise_memory_pool_destroyed) {
+      return nullptr;
+    }
+    promise_memory_pool = new PromiseMemoryPool();
+    add_thread_local_destructor(create_destructor([] {
+      delete promise_memory_pool;
+      promise_memory_pool = nullptr;
+      is_promise_memory_pool_destroyed = true;
+    }));
+  }
+  return promise_memory_pool;
+}
+
+}  // namespace
+
+void *allocate_promise_memory(size_t size) {
+  if (size > PromiseMemoryPool::MAX_BLOCK_SIZE) {
+    return ::operator new(size);
+  }
+  auto index = PromiseMemoryPool::get_block_index(size);
+  auto pool = get_promise_memory_pool();
+  if (pool == nullptr) {
+    return ::operator new((index + 1) * PromiseMemoryPool::BLOCK_SIZE_STEP);
+  }
+  return pool->allocate(index);
+}
+
+void free_promise_memory(void *ptr, size_t size) {
+  if (size <= PromiseMemoryPool::MAX_BLOCK_SIZE) {
+    auto pool = get_promise_memory_pool();
+    if (pool != nullptr && pool->free(ptr, PromiseMemoryPool::get_block_index(size))) {
+      return;
+    }
+  }
+  ::operator delete(ptr);
+}
+
+}  // namespace detail
+}  // namespace td
@@ -88,6 +88,11 @@ struct DropResult<Result<T>> {
 template <class T>
 using drop_result_t = typename DropResult<T>::type;
 
+// lambda promises are created and destroyed very often, so their memory is taken from thread-local free lists
+void *allocate_promise_memory(size_t size);
+
+void free_promise_memory(void *ptr, size_t size);
+
 template <class ValueT, class FunctionT>
 class LambdaPromise : public PromiseInterface<ValueT> {
   enum class State : int32 { Empty, Ready, Complete };
@@ -119,6 +124,13 @@ class LambdaPromise : public PromiseInterface<ValueT> {
   explicit LambdaPromise(FromT &&func) : func_(std::forward<FromT>(func)), state_(State::Ready) {
   }
 
+  static void *operator new(size_t size) {
+    return allocate_promise_memory(size);
+  }
+  static void operator delete(void *ptr, size_t size) {
+    free_promise_memory(ptr, size);
+  }
+
  private:
   FunctionT func_;
   MovableValue<State> state_{State::Empty};
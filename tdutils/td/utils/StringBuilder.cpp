@@ -10,6 +10,7 @@
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Slice.h"
 
+#include <cmath>
 #include <cstdio>
 #include <cstring>
 #include <limits>
@@ -51,6 +52,11 @@ StringBuilder &StringBuilder::operator<<(Slice slice) {
   return *this;
 }
 
+static const char TWO_DIGITS[201] =
+    "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+    "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
 template <class T>
 static char *print_uint(char *current_ptr, T x) {
   if (x < 100) {
@@ -63,18 +69,28 @@ static char *print_uint(char *current_ptr, T x) {
     return current_ptr;
   }
 
-  auto begin_ptr = current_ptr;
-  do {
-    *current_ptr++ = static_cast<char>('0' + x % 10);
-    x /= 10;
-  } while (x > 0);
-
-  auto end_ptr = current_ptr - 1;
-  while (begin_ptr < end_ptr) {
-    std::swap(*begin_ptr++, *end_ptr--);
+  // print two digits at a time from the end to a temporary buffer
+  char buf[std::numeric_limits<T>::digits10 + 1];
+  auto end_ptr = buf + sizeof(buf);
+  auto begin_ptr = end_ptr;
+  while (x >= 100) {
+    auto digits = static_cast<size_t>(x % 100) * 2;
+    x /= 100;
+    begin_ptr -= 2;
+    begin_ptr[0] = TWO_DIGITS[digits];
+    begin_ptr[1] = TWO_DIGITS[digits + 1];
+  }
+  if (x < 10) {
+    *--begin_ptr = static_cast<char>('0' + x);
+  } else {
+    begin_ptr -= 2;
+    begin_ptr[0] = TWO_DIGITS[x * 2];
+    begin_ptr[1] = TWO_DIGITS[x * 2 + 1];
   }
 
-  return current_ptr;
+  auto length = static_cast<size_t>(end_ptr - begin_ptr);
+  std::memcpy(current_ptr, begin_ptr, length);
+  return current_ptr + length;
 }
 
 template <class T>
@@ -94,6 +110,49 @@ static char *print_int(char *current_ptr, T x) {
   return print_uint(current_ptr, x);
 }
 
+// prints x in fixed notation if the correctly rounded result can be computed exactly in integers;
+// returns nullptr if std::stringstream must be used instead
+static char *print_fixed_double(char *current_ptr, double x, int precision) {
+  static const double POWERS_OF_10[] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9};
+  if (precision < 0 || precision > 9 || !(std::fabs(x) < 1e9)) {
+    return nullptr;
+  }
+
+  bool is_negative = std::signbit(x);
+  x = std::fabs(x);
+  auto integer_part = static_cast<uint64>(x);
+  auto scale = static_cast<uint64>(POWERS_OF_10[precision]);
+  // the subtraction is exact and the error of the multiplication is less than 1e-7
+  auto scaled_fractional_part = (x - static_cast<double>(integer_part)) * POWERS_OF_10[precision];
+  auto fractional_part = static_cast<uint64>(scaled_fractional_part);
+  auto remainder = scaled_fractional_part - static_cast<double>(fractional_part);
+  if (std::fabs(remainder - 0.5) < 1e-6) {
+    // the rounding direction can't be reliably determined
+    return nullptr;
+  }
+  if (remainder > 0.5) {
+    fractional_part++;
+    if (fractional_part == scale) {
+      fractional_part = 0;
+      integer_part++;
+    }
+  }
+
+  if (is_negative) {
+    *current_ptr++ = '-';
+  }
+  current_ptr = print_uint(current_ptr, integer_part);
+  if (precision > 0) {
+    *current_ptr++ = '.';
+    for (int i = precision - 1; i >= 0; i--) {
+      current_ptr[i] = static_cast<char>('0' + fractional_part % 10);
+      fractional_part /= 10;
+    }
+    current_ptr += precision;
+  }
+  return current_ptr;
+}
+
 bool StringBuilder::reserve_inner(size_t size) {
   if (!use_buffer_) {
     return false;
@@ -180,6 +239,12 @@ StringBuilder &StringBuilder::operator<<(FixedDouble x) {
     return on_error();
   }
 
+  auto fast_end_ptr = print_fixed_double(current_ptr_, x.d, x.precision);
+  if (fast_end_ptr != nullptr) {
+    current_ptr_ = fast_end_ptr;
+    return *this;
+  }
+
   static TD_THREAD_LOCAL std::stringstream *ss;
   if (init_thread_local<std::stringstream>(ss)) {
     auto previous_locale = ss->imbue(std::locale::classic());
@@ -0,0 +1,253 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/bits.h"
+#include "td/utils/common.h"
+#include "td/utils/logging.h"
+
+#include <limits>
+
+namespace td {
+
+struct TimerWheelNode {
+  bool in_timer_wheel() const {
+    return prev_next_ != nullptr;
+  }
+
+  TimerWheelNode *next_ = nullptr;
+  TimerWheelNode **prev_next_ = nullptr;
+  double key_ = 0.0;
+  int32 slot_ = -1;
+};
+
+// Hashed hierarchical timing wheel with O(1) insert and erase
+// Nodes expire exactly when their key becomes less than the current time,
+// the precision only defines the granularity of the wheel slots
+// The wheel never reads the clock; the current time must be passed by the caller
+class TimerWheel {
+ public:
+  explicit TimerWheel(double precision = 0.001) : precision_(precision) {
+    CHECK(precision_ > 0.0);
+  }
+  TimerWheel(const TimerWheel &) = delete;
+  TimerWheel &operator=(const TimerWheel &) = delete;
+  TimerWheel(TimerWheel &&) = delete;
+  TimerWheel &operator=(TimerWheel &&) = delete;
+  ~TimerWheel() = default;
+
+  bool empty() const {
+    return size_ == 0;
+  }
+  size_t size() const {
+    return size_;
+  }
+
+  double get_precision() const {
+    return precision_;
+  }
+
+  double get_key(const TimerWheelNode *node) const {
+    CHECK(node->in_timer_wheel());
+    return node->key_;
+  }
+
+  void insert(double key, TimerWheelNode *node, double now) {
+    CHECK(!node->in_timer_wheel());
+    node->key_ = key;
+    if (size_ == 0) {
+      // the wheel must be anchored at the current time, otherwise after insertion of a far key all nearer keys
+      // would be put to the current slot and each pop_expired would scan all of them
+      current_tick_ = min(get_tick(key), get_tick(now));
+    }
+    size_++;
+    link(node);
+  }
+
+  void fix(double key, TimerWheelNode *node, double now) {
+    erase(node);
+    insert(key, node, now);
+  }
+
+  void erase(TimerWheelNode *node) {
+    CHECK(node->in_timer_wheel());
+    unlink(node);
+    size_--;
+  }
+
+  // returns a node with key less than now or nullptr if there is no such node
+  TimerWheelNode *pop_expired(double now) {
+    if (size_ == 0) {
+      return nullptr;
+    }
+    auto now_tick = get_tick(now);
+    while (true) {
+      TimerWheelNode *node = slots_[current_tick_ & SLOT_MASK];
+      if (current_tick_ < now_tick) {
+        if (node != nullptr) {
+          erase(node);
+          return node;
+        }
+        advance(now_tick);
+        continue;
+      }
+      for (; node != nullptr; node = node->next_) {
+        if (node->key_ < now) {
+          erase(node);
+          return node;
+        }
+      }
+      return nullptr;
+    }
+  }
+
+  // returns time before which no node will expire; the returned value is exact if the nearest slot isn't cascaded
+  double get_next_timeout() const {
+    CHECK(!empty());
+    const TimerWheelNode *node = slots_[current_tick_ & SLOT_MASK];
+    if (node == nullptr) {
+      auto next_tick = get_next_tick();
+      CHECK(next_tick != std::numeric_limits<int64>::max());
+      node = slots_[next_tick & SLOT_MASK];
+      if ((next_tick >> LEVEL_BITS) != (current_tick_ >> LEVEL_BITS) || node == nullptr) {
+        return static_cast<double>(next_tick) * precision_;
+      }
+    }
+    double result = node->key_;
+    for (node = node->next_; node != nullptr; node = node->next_) {
+      if (node->key_ < result) {
+        result = node->key_;
+      }
+    }
+    return result;
+  }
+
+ private:
+  static constexpr int32 LEVEL_BITS = 6;
+  static constexpr int32 LEVEL_COUNT = 7;
+  static constexpr int32 SLOT_COUNT = 1 << LEVEL_BITS;
+  static constexpr int64 SLOT_MASK = SLOT_COUNT - 1;
+  static constexpr int32 MAX_TICK_BITS = LEVEL_BITS * LEVEL_COUNT;
+
+  double precision_;
+  size_t size_ = 0;
+  int64 current_tick_ = 0;
+  uint64 occupied_slots_[LEVEL_COUNT] = {};
+  TimerWheelNode *slots_[LEVEL_COUNT * SLOT_COUNT] = {};
+
+  int64 get_tick(double key) const {
+    auto tick = key / precision_;
+    if (!(tick > 0.0)) {
+      return 0;
+    }
+    if (tick > 1e18) {
+      return static_cast<int64>(1e18);
+    }
+    return static_cast<int64>(tick);
+  }
+
+  void link(TimerWheelNode *node) {
+    auto tick = get_tick(node->key_);
+    if (tick < current_tick_) {
+      tick = current_tick_;
+    }
+    // the node must belong to the current block of the last level; otherwise it will be reinserted later
+    auto max_tick = (((current_tick_ >> MAX_TICK_BITS) + 1) << MAX_TICK_BITS) - 1;
+    if (tick > max_tick) {
+      tick = max_tick;
+    }
+
+    // the level is defined by the most significant group of bits, which differs from the current tick
+    auto diff = static_cast<uint64>(tick ^ current_tick_);
+    int32 level = diff == 0 ? 0 : (63 - count_leading_zeroes64(diff)) / LEVEL_BITS;
+    auto index = static_cast<int32>((tick >> (level * LEVEL_BITS)) & SLOT_MASK);
+    auto slot = level * SLOT_COUNT + index;
+
+    auto &head = slots_[slot];
+    node->next_ = head;
+    if (head != nullptr) {
+      head->prev_next_ = &node->next_;
+    }
+    head = node;
+    node->prev_next_ = &head;
+    node->slot_ = slot;
+    occupied_slots_[level] |= static_cast<uint64>(1) << index;
+  }
+
+  void unlink(TimerWheelNode *node) {
+    *node->prev_next_ = node->next_;
+    if (node->next_ != nullptr) {
+      node->next_->prev_next_ = node->prev_next_;
+    }
+    auto slot = node->slot_;
+    if (slots_[slot] == nullptr) {
+      occupied_slots_[slot / SLOT_COUNT] &= ~(static_cast<uint64>(1) << (slot % SLOT_COUNT));
+    }
+    node->next_ = nullptr;
+    node->prev_next_ = nullptr;
+    node->slot_ = -1;
+  }
+
+  // returns the nearest tick after the current tick, at which a slot must be expired or cascaded
+  int64 get_next_tick() const {
+    auto result = std::numeric_limits<int64>::max();
+    for (int32 level = 0; level < LEVEL_COUNT; level++) {
+      auto shift = level * LEVEL_BITS;
+      auto index = static_cast<int32>((current_tick_ >> shift) & SLOT_MASK);
+      auto mask = occupied_slots_[level] & (~static_cast<uint64>(1) << index);
+      if (mask != 0) {
+        auto block_start = (current_tick_ >> (shift + LEVEL_BITS)) << (shift + LEVEL_BITS);
+        auto tick = block_start + (static_cast<int64>(count_trailing_zeroes64(mask)) << shift);
+        if (tick < result) {
+          result = tick;
+        }
+      }
+    }
+    return result;
+  }
+
+  // moves the current tick forward up to now_tick and stops at the first non-empty slot
+  void advance(int64 now_tick) {
+    while (current_tick_ < now_tick) {
+      auto next_tick = get_next_tick();
+      if (next_tick > now_tick) {
+        current_tick_ = now_tick;
+        return;
+      }
+      current_tick_ = next_tick;
+      cascade();
+      if (slots_[current_tick_ & SLOT_MASK] != nullptr) {
+        return;
+      }
+    }
+  }
+
+  // moves nodes from slots of the upper levels, which start at the current tick, to the lower levels
+  void cascade() {
+    for (int32 level = LEVEL_COUNT - 1; level > 0; level--) {
+      auto shift = level * LEVEL_BITS;
+      if ((current_tick_ & ((static_cast<int64>(1) << shift) - 1)) != 0) {
+        continue;
+      }
+      auto index = static_cast<int32>((current_tick_ >> shift) & SLOT_MASK);
+      auto &head = slots_[level * SLOT_COUNT + index];
+      TimerWheelNode *node = head;
+      if (node == nullptr) {
+        continue;
+      }
+      head = nullptr;
+      occupied_slots_[level] &= ~(static_cast<uint64>(1) << index);
+      while (node != nullptr) {
+        auto next = node->next_;
+        link(node);
+        node = next;
+      }
+    }
+  }
+};
+
+}  // namespace td
@@ -0,0 +1,205 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/Tracer.h"
+
+#include "td/utils/algorithm.h"
+#include "td/utils/Destructor.h"
+#include "td/utils/filesystem.h"
+#include "td/utils/JsonBuilder.h"
+#include "td/utils/logging.h"
+#include "td/utils/port/sleep.h"
+#include "td/utils/port/thread_local.h"
+#include "td/utils/SliceBuilder.h"
+#include "td/utils/StackAllocator.h"
+#include "td/utils/Time.h"
+#include "td/utils/utf8.h"
+
+#include <cstring>
+
+namespace td {
+
+constexpr size_t Tracer::EVENTS_PER_THREAD;
+constexpr size_t Tracer::MAX_NAME_SIZE;
+
+std::atomic<bool> Tracer::is_enabled_{false};
+std::atomic<uint64> Tracer::next_id_{0};
+
+namespace {
+
+struct TraceEvent {
+  double time;
+  uint64 id;
+  const char *category;
+  char phase;
+  uint8 name_size;
+  char name[Tracer::MAX_NAME_SIZE];
+};
+
+// the buffer is written only by the owning thread while is_recording is set; it is read only after Tracer::stop,
+// which waits until is_recording is cleared, so events are never read while they are written
+struct TraceBuffer {
+  std::atomic<bool> is_used{true};
+  std::atomic<bool> is_recording{false};
+  std::atomic<uint64> pos{0};
+  int32 thread_id = 0;
+  int32 buffer_id = 0;
+  TraceBuffer *next = nullptr;
+  TraceEvent events[Tracer::EVENTS_PER_THREAD];
+};
+
+// buffers are never deleted; a buffer of an exited thread is reused by the next new thread
+std::atomic<TraceBuffer *> trace_buffers{nullptr};
+std::atomic<int32> trace_buffer_count{0};
+std::atomic<double> trace_start_time{0.0};
+
+TraceBuffer *acquire_trace_buffer() {
+  for (auto buffer = trace_buffers.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->next) {
+    bool is_used = false;
+    if (!buffer->is_used.load(std::memory_order_relaxed) &&
+        buffer->is_used.compare_exchange_strong(is_used, true, std::memory_order_acquire)) {
+      buffer->thread_id = get_thread_id();
+      return buffer;
+    }
+  }
+
+  auto buffer = new TraceBuffer();
+  buffer->thread_id = get_thread_id();
+  buffer->buffer_id = trace_buffer_count.fetch_add(1, std::memory_order_relaxed) + 1;
+  auto head = trace_buffers.load(std::memory_order_relaxed);
+  do {
+    buffer->next = head;
+  // the buffer must be visible to Tracer::stop before the first event is recorded to it
+  } while (!trace_buffers.compare_exchange_weak(head, buffer, std::memory_order_seq_cst, std::memory_order_relaxed));
+  return buffer;
+}
+
+TraceBuffer *get_trace_buffer() {
+  static TD_THREAD_LOCAL TraceBuffer *buffer;  // static zero-initialized
+  if (unlikely(buffer == nullptr)) {
+    buffer = acquire_trace_buffer();
+    detail::add_thread_local_destructor(create_destructor([] {
+      buffer->is_used.store(false, std::memory_order_release);
+      buffer = nullptr;
+    }));
+  }
+  return buffer;
+}
+
+}  // namespace
+
+void Tracer::start() {
+  trace_start_time.store(Time::now(), std::memory_order_relaxed);
+  is_enabled_.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::stop() {
+  is_enabled_.store(false, std::memory_order_seq_cst);
+
+  // wait for events, which are being recorded; all subsequent calls to record will see that recording is disabled
+  for (auto buffer = trace_buffers.load(std::memory_order_seq_cst); buffer != nullptr; buffer = buffer->next) {
+    while (buffer->is_recording.load(std::memory_order_seq_cst)) {
+      usleep_for(1);
+    }
+  }
+}
+
+void Tracer::record(char phase, const char *category, Slice name, uint64 id) {
+  if (!is_enabled()) {
+    return;
+  }
+  auto buffer = get_trace_buffer();
+  buffer->is_recording.store(true, std::memory_order_seq_cst);
+  if (!is_enabled_.load(std::memory_order_seq_cst)) {
+    // Tracer::stop was called concurrently and may be already reading the buffer
+    buffer->is_recording.store(false, std::memory_order_release);
+    return;
+  }
+  auto pos = buffer->pos.load(std::memory_order_relaxed);
+  auto &event = buffer->events[pos & (EVENTS_PER_THREAD - 1)];
+  event.time = Time::now();
+  event.id = id;
+  event.category = category;
+  event.phase = phase;
+  auto name_size = name.size();
+  if (name_size > MAX_NAME_SIZE) {
+    // cut the name on a character boundary to keep the trace valid UTF-8
+    name_size = MAX_NAME_SIZE;
+    while (name_size > 0 && !is_utf8_character_first_code_unit(static_cast<unsigned char>(name[name_size]))) {
+      name_size--;
+    }
+  }
+  std::memcpy(event.name, name.data(), name_size);
+  event.name_size = static_cast<uint8>(name_size);
+  buffer->pos.store(pos + 1, std::memory_order_relaxed);
+  buffer->is_recording.store(false, std::memory_order_release);
+}
+
+string Tracer::get_trace() {
+  LOG_CHECK(!is_enabled()) << "Tracer::stop must be called before the trace is read";
+  auto start_time = trace_start_time.load(std::memory_order_relaxed);
+  vector<std::pair<const TraceBuffer *, vector<TraceEvent>>> buffer_events;
+  for (auto buffer = trace_buffers.load(std::memory_order_acquire); buffer != nullptr; buffer = buffer->next) {
+    auto end_pos = buffer->pos.load(std::memory_order_acquire);
+    auto begin_pos = end_pos > EVENTS_PER_THREAD ? end_pos - EVENTS_PER_THREAD : 0;
+    vector<TraceEvent> events;
+    events.reserve(static_cast<size_t>(end_pos - begin_pos));
+    for (auto pos = begin_pos; pos < end_pos; pos++) {
+      events.push_back(buffer->events[pos & (EVENTS_PER_THREAD - 1)]);
+    }
+    td::remove_if(events, [start_time](const TraceEvent &event) { return event.time < start_time; });
+    buffer_events.emplace_back(buffer, std::move(events));
+  }
+
+  auto buf = StackAllocator::alloc(1 << 14);
+  JsonBuilder jb(StringBuilder(buf.as_slice(), true));
+  jb.enter_value() << json_object([&](auto &o) {
+    o("traceEvents", json_array([&](auto &events) {
+        for (auto &it : buffer_events) {
+          auto tid = it.first->buffer_id;
+          events(json_object([&](auto &event_object) {
+            event_object("ph", "M");
+            event_object("name", "thread_name");
+            event_object("pid", 1);
+            event_object("tid", tid);
+            event_object("args", json_object([&](auto &args) {
+                           args("name", PSLICE() << "Thread " << it.first->thread_id << " #" << tid);
+                         }));
+          }));
+          for (auto &event : it.second) {
+            events(json_object([&](auto &event_object) {
+              event_object("ph", Slice(&event.phase, 1));
+              event_object("cat", Slice(event.category));
+              event_object("name", Slice(event.name, event.name_size));
+              event_object("pid", 1);
+              event_object("tid", tid);
+              event_object("ts", JsonRaw(PSLICE() << StringBuilder::FixedDouble((event.time - start_time) * 1e6, 3)));
+              if (event.phase == 'i') {
+                event_object("s", "t");
+              } else if (event.id != 0) {
+                event_object("id", PSLICE() << event.id);
+                if (event.phase == 'f') {
+                  event_object("bp", "e");
+                }
+              }
+            }));
+          }
+        }
+      }));
+    o("displayTimeUnit", "ms");
+  });
+  auto &sb = jb.string_builder();
+  if (sb.is_error()) {
+    LOG(ERROR) << "Trace buffer overflow";
+  }
+  return sb.as_cslice().str();
+}
+
+Status Tracer::dump(CSlice path) {
+  return write_file(path, get_trace());
+}
+
+}  // namespace td
@@ -0,0 +1,86 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/common.h"
+#include "td/utils/Slice.h"
+#include "td/utils/Status.h"
+
+#include <atomic>
+
+namespace td {
+
+// Records trace events into per-thread ring buffers and exports them in Chrome trace event format,
+// which can be opened in https://ui.perfetto.dev or chrome://tracing.
+// Each thread writes only to its own buffer, so recording is lock-free; only the last EVENTS_PER_THREAD
+// events of every thread are kept. Category must be a string literal; names must be encoded in UTF-8 and are truncated
+// to at most MAX_NAME_SIZE bytes.
+class Tracer {
+ public:
+  static constexpr size_t EVENTS_PER_THREAD = 1 << 14;
+  static constexpr size_t MAX_NAME_SIZE = 47;
+
+  static bool is_enabled() {
+    return is_enabled_.load(std::memory_order_relaxed);
+  }
+
+  // starts recording; previously recorded events are dropped
+  static void start();
+
+  // stops recording and waits until events, which are being recorded by other threads, are recorded;
+  // recorded events are kept until the next start
+  static void stop();
+
+  // duration events; must be properly nested within a thread
+  static void begin(const char *category, Slice name) {
+    record('B', category, name, 0);
+  }
+  static void end(const char *category, Slice name) {
+    record('E', category, name, 0);
+  }
+
+  static void instant(const char *category, Slice name) {
+    record('i', category, name, 0);
+  }
+
+  // flow events connect enclosing duration events, possibly in different threads
+  static void flow_begin(const char *category, Slice name, uint64 id) {
+    record('s', category, name, id);
+  }
+  static void flow_end(const char *category, Slice name, uint64 id) {
+    record('f', category, name, id);
+  }
+
+  // asynchronous events with the same category and identifier are shown on a separate track
+  static void async_begin(const char *category, Slice name, uint64 id) {
+    record('b', category, name, id);
+  }
+  static void async_instant(const char *category, Slice name, uint64 id) {
+    record('n', category, name, id);
+  }
+  static void async_end(const char *category, Slice name, uint64 id) {
+    record('e', category, name, id);
+  }
+
+  // returns a new non-zero identifier for flow events
+  static uint64 next_id() {
+    return next_id_.fetch_add(1, std::memory_order_relaxed) + 1;
+  }
+
+  // must be called only after stop and not concurrently with start
+  static string get_trace();
+
+  static Status dump(CSlice path) TD_WARN_UNUSED_RESULT;
+
+ private:
+  static std::atomic<bool> is_enabled_;
+  static std::atomic<uint64> next_id_;
+
+  static void record(char phase, const char *category, Slice name, uint64 id);
+};
+
+}  // namespace td
@@ -13,6 +13,7 @@
 #include "td/utils/Destructor.h"
 #include "td/utils/logging.h"
 #include "td/utils/misc.h"
+#include "td/utils/port/CpuFeatures.h"
 #include "td/utils/port/RwMutex.h"
 #include "td/utils/port/thread_local.h"
 #include "td/utils/Random.h"
@@ -40,12 +41,21 @@
 #include <openssl/params.h>
 #endif
 
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+#include <tmmintrin.h>
+#include <wmmintrin.h>
+#endif
+
 #if TD_HAVE_ZLIB
 #include <zlib.h>
 #endif
 
 #if TD_HAVE_CRC32C
 #include "crc32c/crc32c.h"
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#elif TD_HAVE_X86_TARGET_ATTRIBUTE
+#include <nmmintrin.h>
 #endif
 
 #include <algorithm>
@@ -462,11 +472,208 @@ void AesState::decrypt(const uint8 *src, uint8 *dst, int size) {
   impl_->evp.decrypt(src, dst, size);
 }
 
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+namespace {
+
+// AES-256 using AES-NI instructions directly; each IGE block depends on the previous one,
+// so blocks of independent chains are interleaved to hide latency of the instructions
+constexpr size_t AES_NI_ROUND_KEY_COUNT = 15;
+
+struct AesNiIgeLane {
+  __m128i round_keys[AES_NI_ROUND_KEY_COUNT];
+  __m128i encrypted_iv;
+  __m128i plaintext_iv;
+  const uint8 *in;
+  uint8 *out;
+  size_t block_count;
+  uint8 *iv;
+};
+
+TD_X86_TARGET("aes,sse2") __m128i aes_ni_expand_key_half(__m128i key, __m128i assist) {
+  auto shifted = _mm_slli_si128(key, 4);
+  key = _mm_xor_si128(key, shifted);
+  shifted = _mm_slli_si128(shifted, 4);
+  key = _mm_xor_si128(key, shifted);
+  shifted = _mm_slli_si128(shifted, 4);
+  key = _mm_xor_si128(key, shifted);
+  return _mm_xor_si128(key, assist);
+}
+
+template <int Rcon>
+TD_X86_TARGET("aes,sse2") void aes_ni_expand_key_step(__m128i *round_keys) {
+  round_keys[2] =
+      aes_ni_expand_key_half(round_keys[0], _mm_shuffle_epi32(_mm_aeskeygenassist_si128(round_keys[1], Rcon), 0xff));
+  round_keys[3] =
+      aes_ni_expand_key_half(round_keys[1], _mm_shuffle_epi32(_mm_aeskeygenassist_si128(round_keys[2], 0), 0xaa));
+}
+
+TD_X86_TARGET("aes,sse2") void aes_ni_init_key(Slice key, bool encrypt, __m128i *round_keys) {
+  CHECK(key.size() == 32);
+  __m128i keys[AES_NI_ROUND_KEY_COUNT];
+  keys[0] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key.ubegin()));
+  keys[1] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(key.ubegin() + 16));
+  aes_ni_expand_key_step<0x01>(keys);
+  aes_ni_expand_key_step<0x02>(keys + 2);
+  aes_ni_expand_key_step<0x04>(keys + 4);
+  aes_ni_expand_key_step<0x08>(keys + 6);
+  aes_ni_expand_key_step<0x10>(keys + 8);
+  aes_ni_expand_key_step<0x20>(keys + 10);
+  keys[14] = aes_ni_expand_key_half(keys[12], _mm_shuffle_epi32(_mm_aeskeygenassist_si128(keys[13], 0x40), 0xff));
+
+  if (encrypt) {
+    for (size_t i = 0; i < AES_NI_ROUND_KEY_COUNT; i++) {
+      round_keys[i] = keys[i];
+    }
+  } else {
+    round_keys[0] = keys[AES_NI_ROUND_KEY_COUNT - 1];
+    for (size_t i = 1; i + 1 < AES_NI_ROUND_KEY_COUNT; i++) {
+      round_keys[i] = _mm_aesimc_si128(keys[AES_NI_ROUND_KEY_COUNT - 1 - i]);
+    }
+    round_keys[AES_NI_ROUND_KEY_COUNT - 1] = keys[0];
+  }
+}
+
+TD_X86_TARGET("aes,sse2") void aes_ni_init_ige_lane(AesNiIgeLane &lane, Slice key, Slice iv, bool encrypt) {
+  CHECK(iv.size() == 32);
+  aes_ni_init_key(key, encrypt, lane.round_keys);
+  lane.encrypted_iv = _mm_loadu_si128(reinterpret_cast<const __m128i *>(iv.ubegin()));
+  lane.plaintext_iv = _mm_loadu_si128(reinterpret_cast<const __m128i *>(iv.ubegin() + 16));
+}
+
+TD_X86_TARGET("aes,sse2") void aes_ni_get_ige_lane_iv(const AesNiIgeLane &lane, uint8 *iv) {
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(iv), lane.encrypted_iv);
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(iv + 16), lane.plaintext_iv);
+}
+
+// processes step_count blocks of each of N lanes
+template <size_t N, bool is_encrypt>
+TD_X86_TARGET("aes,sse2") void aes_ni_ige_run_lanes(AesNiIgeLane *lanes, size_t step_count) {
+  __m128i encrypted_iv[N];
+  __m128i plaintext_iv[N];
+  for (size_t i = 0; i < N; i++) {
+    encrypted_iv[i] = lanes[i].encrypted_iv;
+    plaintext_iv[i] = lanes[i].plaintext_iv;
+  }
+
+  for (size_t step = 0; step < step_count; step++) {
+    __m128i data[N];
+    __m128i block[N];
+    for (size_t i = 0; i < N; i++) {
+      data[i] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(lanes[i].in + step * AES_BLOCK_SIZE));
+      block[i] = _mm_xor_si128(_mm_xor_si128(data[i], is_encrypt ? encrypted_iv[i] : plaintext_iv[i]),
+                               lanes[i].round_keys[0]);
+    }
+    for (size_t round = 1; round + 1 < AES_NI_ROUND_KEY_COUNT; round++) {
+      for (size_t i = 0; i < N; i++) {
+        block[i] = is_encrypt ? _mm_aesenc_si128(block[i], lanes[i].round_keys[round])
+                              : _mm_aesdec_si128(block[i], lanes[i].round_keys[round]);
+      }
+    }
+    for (size_t i = 0; i < N; i++) {
+      block[i] = is_encrypt ? _mm_aesenclast_si128(block[i], lanes[i].round_keys[AES_NI_ROUND_KEY_COUNT - 1])
+                            : _mm_aesdeclast_si128(block[i], lanes[i].round_keys[AES_NI_ROUND_KEY_COUNT - 1]);
+      if (is_encrypt) {
+        encrypted_iv[i] = _mm_xor_si128(block[i], plaintext_iv[i]);
+        plaintext_iv[i] = data[i];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes[i].out + step * AES_BLOCK_SIZE), encrypted_iv[i]);
+      } else {
+        plaintext_iv[i] = _mm_xor_si128(block[i], encrypted_iv[i]);
+        encrypted_iv[i] = data[i];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes[i].out + step * AES_BLOCK_SIZE), plaintext_iv[i]);
+      }
+    }
+  }
+
+  for (size_t i = 0; i < N; i++) {
+    lanes[i].encrypted_iv = encrypted_iv[i];
+    lanes[i].plaintext_iv = plaintext_iv[i];
+    lanes[i].in += step_count * AES_BLOCK_SIZE;
+    lanes[i].out += step_count * AES_BLOCK_SIZE;
+    lanes[i].block_count -= step_count;
+  }
+}
+
+template <bool is_encrypt>
+TD_X86_TARGET("aes,sse2") void aes_ni_ige_run(AesNiIgeLane *lanes, size_t lane_count, size_t step_count) {
+  switch (lane_count) {
+    case 1:
+      return aes_ni_ige_run_lanes<1, is_encrypt>(lanes, step_count);
+    case 2:
+      return aes_ni_ige_run_lanes<2, is_encrypt>(lanes, step_count);
+    case 3:
+      return aes_ni_ige_run_lanes<3, is_encrypt>(lanes, step_count);
+    case 4:
+      return aes_ni_ige_run_lanes<4, is_encrypt>(lanes, step_count);
+    case 5:
+      return aes_ni_ige_run_lanes<5, is_encrypt>(lanes, step_count);
+    case 6:
+      return aes_ni_ige_run_lanes<6, is_encrypt>(lanes, step_count);
+    case 7:
+      return aes_ni_ige_run_lanes<7, is_encrypt>(lanes, step_count);
+    case 8:
+      return aes_ni_ige_run_lanes<8, is_encrypt>(lanes, step_count);
+    default:
+      UNREACHABLE();
+  }
+}
+
+template <bool is_encrypt>
+TD_X86_TARGET("aes,sse2") void aes_ni_ige_multi(Span<AesIgeBuffer> buffers) {
+  static constexpr size_t MAX_LANE_COUNT = 8;
+  AesNiIgeLane lanes[MAX_LANE_COUNT];
+  size_t lane_count = 0;
+  size_t next_buffer = 0;
+  while (true) {
+    while (lane_count < MAX_LANE_COUNT && next_buffer < buffers.size()) {
+      auto &buffer = buffers[next_buffer++];
+      CHECK(buffer.from.size() % AES_BLOCK_SIZE == 0);
+      CHECK(buffer.to.size() >= buffer.from.size());
+      CHECK(buffer.iv.size() == 32);
+      if (buffer.from.empty()) {
+        continue;
+      }
+      auto &lane = lanes[lane_count++];
+      aes_ni_init_ige_lane(lane, buffer.key, buffer.iv, is_encrypt);
+      lane.in = buffer.from.ubegin();
+      lane.out = buffer.to.ubegin();
+      lane.block_count = buffer.from.size() / AES_BLOCK_SIZE;
+      lane.iv = buffer.iv.ubegin();
+    }
+    if (lane_count == 0) {
+      break;
+    }
+
+    size_t step_count = lanes[0].block_count;
+    for (size_t i = 1; i < lane_count; i++) {
+      step_count = td::min(step_count, lanes[i].block_count);
+    }
+    aes_ni_ige_run<is_encrypt>(lanes, lane_count, step_count);
+
+    for (size_t i = 0; i < lane_count;) {
+      if (lanes[i].block_count == 0) {
+        aes_ni_get_ige_lane_iv(lanes[i], lanes[i].iv);
+        lanes[i] = lanes[--lane_count];
+      } else {
+        i++;
+      }
+    }
+  }
+}
+}  // namespace
+#endif
+
 class AesIgeStateImpl {
  public:
   void init(Slice key, Slice iv, bool encrypt) {
     CHECK(key.size() == 32);
     CHECK(iv.size() == 32);
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+    use_aes_ni_ = CpuFeatures::get().has_aes;
+    if (use_aes_ni_) {
+      is_encrypt_ = encrypt;
+      return aes_ni_init_ige_lane(aes_ni_lane_, key, iv, encrypt);
+    }
+#endif
     if (encrypt) {
       evp_.init_encrypt_cbc(key);
     } else {
@@ -479,6 +686,11 @@ class AesIgeStateImpl {
 
   void get_iv(MutableSlice iv) {
     CHECK(iv.size() == 32);
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+    if (use_aes_ni_) {
+      return aes_ni_get_ige_lane_iv(aes_ni_lane_, iv.ubegin());
+    }
+#endif
     encrypted_iv_.store(iv.ubegin());
     plaintext_iv_.store(iv.ubegin() + AES_BLOCK_SIZE);
   }
@@ -486,6 +698,12 @@ class AesIgeStateImpl {
   void encrypt(Slice from, MutableSlice to) {
     CHECK(from.size() % AES_BLOCK_SIZE == 0);
     CHECK(to.size() >= from.size());
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+    if (use_aes_ni_) {
+      CHECK(is_encrypt_);
+      return run_aes_ni<true>(from, to);
+    }
+#endif
     auto len = to.size() / AES_BLOCK_SIZE;
     auto in = from.ubegin();
     auto out = to.ubegin();
@@ -526,6 +744,12 @@ class AesIgeStateImpl {
   void decrypt(Slice from, MutableSlice to) {
     CHECK(from.size() % AES_BLOCK_SIZE == 0);
     CHECK(to.size() >= from.size());
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+    if (use_aes_ni_) {
+      CHECK(!is_encrypt_);
+      return run_aes_ni<false>(from, to);
+    }
+#endif
     auto len = to.size() / AES_BLOCK_SIZE;
     auto in = from.ubegin();
     auto out = to.ubegin();
@@ -552,6 +776,19 @@ class AesIgeStateImpl {
   Evp evp_;
   AesBlock encrypted_iv_;
   AesBlock plaintext_iv_;
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  bool use_aes_ni_ = false;
+  bool is_encrypt_ = false;
+  AesNiIgeLane aes_ni_lane_;
+
+  template <bool is_encrypt>
+  void run_aes_ni(Slice from, MutableSlice to) {
+    aes_ni_lane_.in = from.ubegin();
+    aes_ni_lane_.out = to.ubegin();
+    aes_ni_lane_.block_count = from.size() / AES_BLOCK_SIZE;
+    aes_ni_ige_run<is_encrypt>(&aes_ni_lane_, 1, aes_ni_lane_.block_count);
+  }
+#endif
 };
 
 AesIgeState::AesIgeState() = default;
@@ -576,6 +813,12 @@ void AesIgeState::decrypt(Slice from, MutableSlice to) {
 }
 
 void aes_ige_encrypt(Slice aes_key, MutableSlice aes_iv, Slice from, MutableSlice to) {
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (CpuFeatures::get().has_aes) {
+    AesIgeBuffer buffer{aes_key, aes_iv, from, to};
+    return aes_ni_ige_multi<true>(buffer);
+  }
+#endif
   AesIgeStateImpl state;
   state.init(aes_key, aes_iv, true);
   state.encrypt(from, to);
@@ -583,12 +826,40 @@ void aes_ige_encrypt(Slice aes_key, MutableSlice aes_iv, Slice from, MutableSlic
 }
 
 void aes_ige_decrypt(Slice aes_key, MutableSlice aes_iv, Slice from, MutableSlice to) {
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (CpuFeatures::get().has_aes) {
+    AesIgeBuffer buffer{aes_key, aes_iv, from, to};
+    return aes_ni_ige_multi<false>(buffer);
+  }
+#endif
   AesIgeStateImpl state;
   state.init(aes_key, aes_iv, false);
   state.decrypt(from, to);
   state.get_iv(aes_iv);
 }
 
+void aes_ige_encrypt_multi(Span<AesIgeBuffer> buffers) {
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (CpuFeatures::get().has_aes) {
+    return aes_ni_ige_multi<true>(buffers);
+  }
+#endif
+  for (auto &buffer : buffers) {
+    aes_ige_encrypt(buffer.key, buffer.iv, buffer.from, buffer.to);
+  }
+}
+
+void aes_ige_decrypt_multi(Span<AesIgeBuffer> buffers) {
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (CpuFeatures::get().has_aes) {
+    return aes_ni_ige_multi<false>(buffers);
+  }
+#endif
+  for (auto &buffer : buffers) {
+    aes_ige_decrypt(buffer.key, buffer.iv, buffer.from, buffer.to);
+  }
+}
+
 void aes_cbc_encrypt(Slice aes_key, MutableSlice aes_iv, Slice from, MutableSlice to) {
   CHECK(from.size() <= to.size());
   CHECK(from.size() % 16 == 0);
@@ -1221,6 +1492,103 @@ uint32 crc32c(Slice data) {
 uint32 crc32c_extend(uint32 old_crc, Slice data) {
   return crc32c::Extend(old_crc, data.ubegin(), data.size());
 }
+#else
+namespace {
+
+const uint32 *get_crc32c_table() {
+  static uint32 table_raw[8 * 256];
+  static const uint32 *table = [&] {
+    auto *buf = table_raw;
+    for (uint32 i = 0; i < 256; i++) {
+      uint32 crc = i;
+      for (int j = 0; j < 8; j++) {
+        crc = (crc >> 1) ^ (0x82F63B78u & (0 - (crc & 1)));
+      }
+      buf[i] = crc;
+    }
+    for (uint32 i = 0; i < 256; i++) {
+      for (int j = 1; j < 8; j++) {
+        buf[j * 256 + i] = (buf[(j - 1) * 256 + i] >> 8) ^ buf[buf[(j - 1) * 256 + i] & 0xFF];
+      }
+    }
+    return buf;
+  }();
+  return table;
+}
+
+// slicing-by-8
+uint32 crc32c_partial_software(uint32 crc, const unsigned char *p, size_t size) {
+  const uint32 *table = get_crc32c_table();
+  for (; size >= 8; size -= 8, p += 8) {
+    uint32 low = crc ^ (static_cast<uint32>(p[0]) | (static_cast<uint32>(p[1]) << 8) |
+                        (static_cast<uint32>(p[2]) << 16) | (static_cast<uint32>(p[3]) << 24));
+    crc = table[7 * 256 + (low & 0xFF)] ^ table[6 * 256 + ((low >> 8) & 0xFF)] ^
+          table[5 * 256 + ((low >> 16) & 0xFF)] ^ table[4 * 256 + (low >> 24)] ^ table[3 * 256 + p[4]] ^
+          table[2 * 256 + p[5]] ^ table[1 * 256 + p[6]] ^ table[p[7]];
+  }
+  for (; size > 0; size--, p++) {
+    crc = (crc >> 8) ^ table[(crc ^ *p) & 0xFF];
+  }
+  return crc;
+}
+
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+TD_X86_TARGET("sse4.2") uint32 crc32c_partial_sse42(uint32 crc, const unsigned char *p, size_t size) {
+#if defined(__x86_64__)
+  uint64 crc64 = crc;
+  for (; size >= 8; size -= 8, p += 8) {
+    uint64 value = as<uint64>(p);
+    crc64 = _mm_crc32_u64(crc64, value);
+  }
+  crc = static_cast<uint32>(crc64);
+#endif
+  for (; size >= 4; size -= 4, p += 4) {
+    uint32 value = as<uint32>(p);
+    crc = _mm_crc32_u32(crc, value);
+  }
+  for (; size > 0; size--, p++) {
+    crc = _mm_crc32_u8(crc, *p);
+  }
+  return crc;
+}
+#endif
+
+#if defined(__ARM_FEATURE_CRC32)
+uint32 crc32c_partial_arm(uint32 crc, const unsigned char *p, size_t size) {
+  for (; size >= 8; size -= 8, p += 8) {
+    uint64 value = as<uint64>(p);
+    crc = __crc32cd(crc, value);
+  }
+  for (; size > 0; size--, p++) {
+    crc = __crc32cb(crc, *p);
+  }
+  return crc;
+}
+#endif
+
+uint32 crc32c_partial(uint32 crc, Slice data) {
+#if defined(__ARM_FEATURE_CRC32)
+  return crc32c_partial_arm(crc, data.ubegin(), data.size());
+#else
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (CpuFeatures::get().has_sse42) {
+    return crc32c_partial_sse42(crc, data.ubegin(), data.size());
+  }
+#endif
+  return crc32c_partial_software(crc, data.ubegin(), data.size());
+#endif
+}
+
+}  // namespace
+
+uint32 crc32c(Slice data) {
+  return crc32c_extend(0, data);
+}
+
+uint32 crc32c_extend(uint32 old_crc, Slice data) {
+  return ~crc32c_partial(~old_crc, data);
+}
+#endif
 
 namespace {
 
@@ -1273,8 +1641,6 @@ uint32 crc32c_extend(uint32 old_crc, uint32 data_crc, size_t data_size) {
   return old_crc ^ data_crc;
 }
 
-#endif
-
 static const uint64 crc64_table[256] = {
     0x0000000000000000, 0xb32e4cbe03a75f6f, 0xf4843657a840a05b, 0x47aa7ae9abe7ff34, 0x7bd0c384ff8f5e33,
     0xc8fe8f3afc28015c, 0x8f54f5d357cffe68, 0x3c7ab96d5468a107, 0xf7a18709ff1ebc66, 0x448fcbb7fcb9e309,
@@ -1329,18 +1695,122 @@ static const uint64 crc64_table[256] = {
     0x28532e49984f3e05, 0x9b7d62f79be8616a, 0xa707db9acf80c06d, 0x14299724cc279f02, 0x5383edcd67c06036,
     0xe0ada17364673f59};
 
-static uint64 crc64_partial(Slice data, uint64 crc) {
-  const char *p = data.begin();
-  for (auto len = data.size(); len > 0; len--) {
-    crc = crc64_table[(crc ^ *p++) & 0xff] ^ (crc >> 8);
+namespace {
+
+const uint64 *get_crc64_table() {
+  static uint64 table_raw[8 * 256];
+  static const uint64 *table = [&] {
+    auto *buf = table_raw;
+    for (uint32 i = 0; i < 256; i++) {
+      buf[i] = crc64_table[i];
+    }
+    for (uint32 i = 0; i < 256; i++) {
+      for (int j = 1; j < 8; j++) {
+        buf[j * 256 + i] = (buf[(j - 1) * 256 + i] >> 8) ^ buf[buf[(j - 1) * 256 + i] & 0xFF];
+      }
+    }
+    return buf;
+  }();
+  return table;
+}
+
+// slicing-by-8
+uint64 crc64_partial_software(uint64 crc, const unsigned char *p, size_t size) {
+  const uint64 *table = get_crc64_table();
+  for (; size >= 8; size -= 8, p += 8) {
+    uint64 value = crc ^ (static_cast<uint64>(p[0]) | (static_cast<uint64>(p[1]) << 8) |
+                          (static_cast<uint64>(p[2]) << 16) | (static_cast<uint64>(p[3]) << 24) |
+                          (static_cast<uint64>(p[4]) << 32) | (static_cast<uint64>(p[5]) << 40) |
+                          (static_cast<uint64>(p[6]) << 48) | (static_cast<uint64>(p[7]) << 56));
+    crc = table[7 * 256 + (value & 0xFF)] ^ table[6 * 256 + ((value >> 8) & 0xFF)] ^
+          table[5 * 256 + ((value >> 16) & 0xFF)] ^ table[4 * 256 + ((value >> 24) & 0xFF)] ^
+          table[3 * 256 + ((value >> 32) & 0xFF)] ^ table[2 * 256 + ((value >> 40) & 0xFF)] ^
+          table[1 * 256 + ((value >> 48) & 0xFF)] ^ table[value >> 56];
+  }
+  for (; size > 0; size--, p++) {
+    crc = table[(crc ^ *p) & 0xFF] ^ (crc >> 8);
   }
   return crc;
 }
 
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+// folds the 128-bit value forward by multiplying its halves by the corresponding halves of k
+TD_X86_TARGET("pclmul,sse2") __m128i crc_fold(__m128i value, __m128i k) {
+  return _mm_xor_si128(_mm_clmulepi64_si128(value, k, 0x00), _mm_clmulepi64_si128(value, k, 0x11));
+}
+
+TD_X86_TARGET("pclmul,sse2") __m128i crc_load(const unsigned char *p) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+}
+
+// folds data 64 bytes at a time in 4 independent accumulators; the remaining 128-bit value
+// has the same CRC as the folded data and is reduced using the table
+TD_X86_TARGET("pclmul,sse2") uint64 crc64_partial_pclmul(uint64 crc, const unsigned char *p, size_t size) {
+  if (size < 64) {
+    return crc64_partial_software(crc, p, size);
+  }
+
+  // bit-reflected x^575 mod P and x^511 mod P for 64-byte folding, x^191 mod P and x^127 mod P for 16-byte folding
+  const __m128i k64 =
+      _mm_set_epi64x(static_cast<int64>(0x081f6054a7842df4ULL), static_cast<int64>(0x6ae3efbb9dd441f3ULL));
+  const __m128i k16 =
+      _mm_set_epi64x(static_cast<int64>(0xdabe95afc7875f40ULL), static_cast<int64>(0xe05dd497ca393ae4ULL));
+
+  __m128i x0 = _mm_xor_si128(crc_load(p), _mm_set_epi64x(0, static_cast<int64>(crc)));
+  __m128i x1 = crc_load(p + 16);
+  __m128i x2 = crc_load(p + 32);
+  __m128i x3 = crc_load(p + 48);
+  for (p += 64, size -= 64; size >= 64; p += 64, size -= 64) {
+    x0 = _mm_xor_si128(crc_fold(x0, k64), crc_load(p));
+    x1 = _mm_xor_si128(crc_fold(x1, k64), crc_load(p + 16));
+    x2 = _mm_xor_si128(crc_fold(x2, k64), crc_load(p + 32));
+    x3 = _mm_xor_si128(crc_fold(x3, k64), crc_load(p + 48));
+  }
+  x0 = _mm_xor_si128(crc_fold(x0, k16), x1);
+  x0 = _mm_xor_si128(crc_fold(x0, k16), x2);
+  x0 = _mm_xor_si128(crc_fold(x0, k16), x3);
+  for (; size >= 16; p += 16, size -= 16) {
+    x0 = _mm_xor_si128(crc_fold(x0, k16), crc_load(p));
+  }
+
+  unsigned char folded[16];
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(folded), x0);
+  return crc64_partial_software(crc64_partial_software(0, folded, 16), p, size);
+}
+#endif
+
+uint64 crc64_partial(Slice data, uint64 crc) {
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (CpuFeatures::get().has_pclmul) {
+    return crc64_partial_pclmul(crc, data.ubegin(), data.size());
+  }
+#endif
+  return crc64_partial_software(crc, data.ubegin(), data.size());
+}
+
+}  // namespace
+
 uint64 crc64(Slice data) {
   return crc64_partial(data, static_cast<uint64>(-1)) ^ static_cast<uint64>(-1);
 }
 
+namespace detail {
+
+uint64 crc64_software(Slice data) {
+  return crc64_partial_software(static_cast<uint64>(-1), data.ubegin(), data.size()) ^ static_cast<uint64>(-1);
+}
+
+uint64 crc64_pclmul(Slice data) {
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (CpuFeatures::get().has_pclmul) {
+    return crc64_partial_pclmul(static_cast<uint64>(-1), data.ubegin(), data.size()) ^ static_cast<uint64>(-1);
+  }
+#endif
+  return crc64_software(data);
+}
+
+}  // namespace detail
+
 static const uint16 crc16_table[256] = {
     0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50a5, 0x60c6, 0x70e7, 0x8108, 0x9129, 0xa14a, 0xb16b, 0xc18c, 0xd1ad,
     0xe1ce, 0xf1ef, 0x1231, 0x0210, 0x3273, 0x2252, 0x52b5, 0x4294, 0x72f7, 0x62d6, 0x9339, 0x8318, 0xb37b, 0xa35a,
@@ -1362,13 +1832,105 @@ static const uint16 crc16_table[256] = {
     0x1ce0, 0x0cc1, 0xef1f, 0xff3e, 0xcf5d, 0xdf7c, 0xaf9b, 0xbfba, 0x8fd9, 0x9ff8, 0x6e17, 0x7e36, 0x4e55, 0x5e74,
     0x2e93, 0x3eb2, 0x0ed1, 0x1ef0};
 
+namespace {
+
+const uint16 *get_crc16_table() {
+  static uint16 table_raw[8 * 256];
+  static const uint16 *table = [&] {
+    auto *buf = table_raw;
+    for (uint32 i = 0; i < 256; i++) {
+      buf[i] = crc16_table[i];
+    }
+    for (uint32 i = 0; i < 256; i++) {
+      for (int j = 1; j < 8; j++) {
+        auto prev = buf[(j - 1) * 256 + i];
+        buf[j * 256 + i] = static_cast<uint16>((prev << 8) ^ buf[prev >> 8]);
+      }
+    }
+    return buf;
+  }();
+  return table;
+}
+
+// slicing-by-8
+uint32 crc16_partial_software(uint32 crc, const unsigned char *p, size_t size) {
+  const uint16 *table = get_crc16_table();
+  for (; size >= 8; size -= 8, p += 8) {
+    crc = table[7 * 256 + (p[0] ^ (crc >> 8))] ^ table[6 * 256 + (p[1] ^ (crc & 0xFF))] ^ table[5 * 256 + p[2]] ^
+          table[4 * 256 + p[3]] ^ table[3 * 256 + p[4]] ^ table[2 * 256 + p[5]] ^ table[1 * 256 + p[6]] ^ table[p[7]];
+  }
+  for (; size > 0; size--, p++) {
+    crc = (table[(*p ^ (crc >> 8)) & 0xFF] ^ (crc << 8)) & 0xFFFF;
+  }
+  return crc;
+}
+
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+// the CRC isn't bit-reflected, so data is folded as big-endian 128-bit numbers
+TD_X86_TARGET("pclmul,sse4.2") uint32 crc16_partial_pclmul(uint32 crc, const unsigned char *p, size_t size) {
+  if (size < 64) {
+    return crc16_partial_software(crc, p, size);
+  }
+
+  // x^576 mod P and x^512 mod P for 64-byte folding, x^192 mod P and x^128 mod P for 16-byte folding
+  const __m128i k64 = _mm_set_epi64x(0x8832, 0x13fc);
+  const __m128i k16 = _mm_set_epi64x(0x650b, 0xaefc);
+  const __m128i reverse = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+
+  __m128i x0 = _mm_xor_si128(_mm_shuffle_epi8(crc_load(p), reverse),
+                             _mm_set_epi64x(static_cast<int64>(static_cast<uint64>(crc) << 48), 0));
+  __m128i x1 = _mm_shuffle_epi8(crc_load(p + 16), reverse);
+  __m128i x2 = _mm_shuffle_epi8(crc_load(p + 32), reverse);
+  __m128i x3 = _mm_shuffle_epi8(crc_load(p + 48), reverse);
+  for (p += 64, size -= 64; size >= 64; p += 64, size -= 64) {
+    x0 = _mm_xor_si128(crc_fold(x0, k64), _mm_shuffle_epi8(crc_load(p), reverse));
+    x1 = _mm_xor_si128(crc_fold(x1, k64), _mm_shuffle_epi8(crc_load(p + 16), reverse));
+    x2 = _mm_xor_si128(crc_fold(x2, k64), _mm_shuffle_epi8(crc_load(p + 32), reverse));
+    x3 = _mm_xor_si128(crc_fold(x3, k64), _mm_shuffle_epi8(crc_load(p + 48), reverse));
+  }
+  x0 = _mm_xor_si128(crc_fold(x0, k16), x1);
+  x0 = _mm_xor_si128(crc_fold(x0, k16), x2);
+  x0 = _mm_xor_si128(crc_fold(x0, k16), x3);
+  for (; size >= 16; p += 16, size -= 16) {
+    x0 = _mm_xor_si128(crc_fold(x0, k16), _mm_shuffle_epi8(crc_load(p), reverse));
+  }
+
+  unsigned char folded[16];
+  _mm_storeu_si128(reinterpret_cast<__m128i *>(folded), _mm_shuffle_epi8(x0, reverse));
+  return crc16_partial_software(crc16_partial_software(0, folded, 16), p, size);
+}
+#endif
+
+}  // namespace
+
 uint16 crc16(Slice data) {
-  uint32 crc = 0;
-  for (auto c : data) {
-    auto t = (static_cast<unsigned char>(c) ^ (crc >> 8)) & 0xff;
-    crc = crc16_table[t] ^ (crc << 8);
+  uint32 crc;
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (CpuFeatures::get().has_pclmul && CpuFeatures::get().has_sse42) {
+    crc = crc16_partial_pclmul(0, data.ubegin(), data.size());
+  } else
+#endif
+  {
+    crc = crc16_partial_software(0, data.ubegin(), data.size());
   }
   return static_cast<uint16>(crc);
 }
 
+namespace detail {
+
+uint16 crc16_software(Slice data) {
+  return static_cast<uint16>(crc16_partial_software(0, data.ubegin(), data.size()));
+}
+
+uint16 crc16_pclmul(Slice data) {
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (CpuFeatures::get().has_pclmul && CpuFeatures::get().has_sse42) {
+    return static_cast<uint16>(crc16_partial_pclmul(0, data.ubegin(), data.size()));
+  }
+#endif
+  return crc16_software(data);
+}
+
+}  // namespace detail
+
 }  // namespace td
@@ -10,6 +10,7 @@
 #include "td/utils/common.h"
 #include "td/utils/SharedSlice.h"
 #include "td/utils/Slice.h"
+#include "td/utils/Span.h"
 #include "td/utils/Status.h"
 
 namespace td {
@@ -44,6 +45,17 @@ class AesState {
 void aes_ige_encrypt(Slice aes_key, MutableSlice aes_iv, Slice from, MutableSlice to);
 void aes_ige_decrypt(Slice aes_key, MutableSlice aes_iv, Slice from, MutableSlice to);
 
+struct AesIgeBuffer {
+  Slice key;
+  MutableSlice iv;
+  Slice from;
+  MutableSlice to;
+};
+
+// encrypt or decrypt independent buffers with their own keys at once, interleaving their block chains if possible
+void aes_ige_encrypt_multi(Span<AesIgeBuffer> buffers);
+void aes_ige_decrypt_multi(Span<AesIgeBuffer> buffers);
+
 class AesIgeStateImpl;
 
 class AesIgeState {
@@ -172,13 +184,21 @@ void clear_openssl_errors(Slice source);
 uint32 crc32(Slice data);
 #endif
 
-#if TD_HAVE_CRC32C
+// uses SSE4.2 or ARMv8 CRC32 instructions if available
 uint32 crc32c(Slice data);
 uint32 crc32c_extend(uint32 old_crc, Slice data);
 uint32 crc32c_extend(uint32 old_crc, uint32 new_crc, size_t data_size);
-#endif
 
 uint64 crc64(Slice data);
 uint16 crc16(Slice data);
 
+namespace detail {
+// separate implementations of crc64 and crc16 for testing; PCLMULQDQ versions fall back to the software ones
+// if the instructions aren't supported
+uint64 crc64_software(Slice data);
+uint64 crc64_pclmul(Slice data);
+uint16 crc16_software(Slice data);
+uint16 crc16_pclmul(Slice data);
+}  // namespace detail
+
 }  // namespace td
@@ -0,0 +1,28 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/port/CpuFeatures.h"
+
+namespace td {
+
+static CpuFeatures detect_cpu_features() {
+  CpuFeatures result;
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  __builtin_cpu_init();
+  result.has_sse42 = __builtin_cpu_supports("sse4.2") != 0;
+  result.has_pclmul = __builtin_cpu_supports("pclmul") != 0;
+  result.has_aes = __builtin_cpu_supports("aes") != 0;
+  result.has_avx2 = __builtin_cpu_supports("avx2") != 0;
+#endif
+  return result;
+}
+
+const CpuFeatures &CpuFeatures::get() {
+  static const CpuFeatures features = detect_cpu_features();
+  return features;
+}
+
+}  // namespace td
@@ -0,0 +1,29 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#pragma once
+
+#include "td/utils/port/platform.h"
+
+// functions, using x86 instruction set extensions, can be compiled only with target attributes
+#if (TD_GCC || TD_CLANG) && (defined(__x86_64__) || defined(__i386__))
+#define TD_HAVE_X86_TARGET_ATTRIBUTE 1
+#define TD_X86_TARGET(features) __attribute__((target(features)))
+#endif
+
+namespace td {
+
+struct CpuFeatures {
+  bool has_sse42 = false;
+  bool has_pclmul = false;
+  bool has_aes = false;
+  bool has_avx2 = false;
+
+  // returns features of the current CPU, which can be used by the current build
+  static const CpuFeatures &get();
+};
+
+}  // namespace td
@@ -649,6 +649,18 @@ Status FileFd::sync() {
   return Status::OK();
 }
 
+Status FileFd::sync_data() {
+  CHECK(!empty());
+#if TD_LINUX || TD_ANDROID
+  if (detail::skip_eintr([&] { return fdatasync(get_native_fd().fd()); }) != 0) {
+    return OS_ERROR("Data sync failed");
+  }
+  return Status::OK();
+#else
+  return sync();
+#endif
+}
+
 Status FileFd::sync_barrier() {
   CHECK(!empty());
 #if TD_DARWIN && defined(F_BARRIERFSYNC)
@@ -9,6 +9,8 @@
 #include "td/utils/port/detail/PollableFd.h"
 #include "td/utils/port/PollFlags.h"
 
+#include <cmath>
+
 namespace td {
 class PollBase {
  public:
@@ -24,5 +26,15 @@ class PollBase {
   virtual void unsubscribe(PollableFdRef fd) = 0;
   virtual void unsubscribe_before_close(PollableFdRef fd) = 0;
   virtual void run(int timeout_ms) = 0;
+
+  // waits for at most timeout seconds; the timeout is rounded up to whole milliseconds by default
+  virtual void run_precise(double timeout) {
+    if (timeout <= 0) {
+      timeout = 0;
+    } else if (timeout > 1000000.0) {
+      timeout = 1000000.0;
+    }
+    run(static_cast<int>(std::ceil(timeout * 1000)));
+  }
 };
 }  // namespace td
@@ -16,6 +16,7 @@ char disable_linker_warning_about_empty_file_epoll_cpp TD_UNUSED;
 
 #include <cerrno>
 
+#include <sys/syscall.h>
 #include <unistd.h>
 
 namespace td {
@@ -82,7 +83,43 @@ void Epoll::unsubscribe_before_close(PollableFdRef fd) {
 
 void Epoll::run(int timeout_ms) {
   int ready_n = epoll_wait(epoll_fd_.fd(), &events_[0], static_cast<int>(events_.size()), timeout_ms);
-  auto epoll_wait_errno = errno;
+  process_events(ready_n, errno);
+}
+
+void Epoll::run_precise(double timeout) {
+#ifdef SYS_epoll_pwait2
+  if (!is_epoll_pwait2_unsupported_) {
+    if (timeout <= 0) {
+      timeout = 0;
+    } else if (timeout > 1000000.0) {
+      timeout = 1000000.0;
+    }
+    // layout of struct __kernel_timespec, which is used by the system call on all platforms
+    struct {
+      int64 tv_sec;
+      int64 tv_nsec;
+    } timeout_data;
+    auto timeout_ns = static_cast<int64>(timeout * 1e9);
+    timeout_data.tv_sec = timeout_ns / 1000000000;
+    timeout_data.tv_nsec = timeout_ns % 1000000000;
+
+    // call the system call directly, because the wrapper is available only since glibc 2.35
+    int ready_n = static_cast<int>(syscall(SYS_epoll_pwait2, epoll_fd_.fd(), &events_[0],
+                                           static_cast<int>(events_.size()), &timeout_data, nullptr, 0));
+    auto epoll_wait_errno = errno;
+    if (ready_n != -1 || (epoll_wait_errno != ENOSYS && epoll_wait_errno != EPERM)) {
+      process_events(ready_n, epoll_wait_errno);
+      return;
+    }
+    // the kernel is older than 5.11 or the system call is forbidden by seccomp
+    LOG(INFO) << "epoll_pwait2 is unsupported";
+    is_epoll_pwait2_unsupported_ = true;
+  }
+#endif
+  PollBase::run_precise(timeout);
+}
+
+void Epoll::process_events(int ready_n, int epoll_wait_errno) {
   LOG_IF(FATAL, ready_n == -1 && epoll_wait_errno != EINTR)
       << Status::PosixError(epoll_wait_errno, "epoll_wait failed");
 
@@ -43,6 +43,9 @@ class Epoll final : public PollBase {
 
   void run(int timeout_ms) final;
 
+  // uses epoll_pwait2 if supported by the kernel to wait with nanosecond precision
+  void run_precise(double timeout) final;
+
   static bool is_edge_triggered() {
     return true;
   }
@@ -51,6 +54,9 @@ class Epoll final : public PollBase {
   NativeFd epoll_fd_;
   vector<struct epoll_event> events_;
   ListNode list_root_;
+  bool is_epoll_pwait2_unsupported_ = false;
+
+  void process_events(int ready_n, int epoll_wait_errno);
 };
 
 }  // namespace detail
@@ -7,12 +7,21 @@
 #include "td/utils/utf8.h"
 
 #include "td/utils/misc.h"
+#include "td/utils/port/CpuFeatures.h"
 #include "td/utils/SliceBuilder.h"
 #include "td/utils/unicode.h"
 
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+#include <immintrin.h>
+#endif
+
+#include <cstring>
+
 namespace td {
 
-bool check_utf8(CSlice str) {
+namespace {
+
+bool check_utf8_scalar(CSlice str) {
   const char *data = str.data();
   const char *data_end = data + str.size();
   do {
@@ -62,6 +71,266 @@ bool check_utf8(CSlice str) {
   return false;
 }
 
+size_t utf8_utf16_length_scalar(const unsigned char *data, size_t size) {
+  size_t result = 0;
+  for (size_t i = 0; i < size; i++) {
+    auto c = data[i];
+    result += is_utf8_character_first_code_unit(c) + ((c & 0xf8) == 0xf0);
+  }
+  return result;
+}
+
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+// vectorized UTF-8 validation by J. Keiser and D. Lemire: errors in 2-byte sequences are found by looking up
+// the high and low nibbles of the first byte and the high nibble of the second byte in the tables below
+// and intersecting the results; the bytes, which must be the third and the fourth continuation bytes, are checked
+// separately; the input is processed in blocks, which are skipped if they contain only ASCII characters
+constexpr uint8 UTF8_TOO_SHORT = 1 << 0;   // 11______ 0_______ or 11______ 11______
+constexpr uint8 UTF8_TOO_LONG = 1 << 1;    // 0_______ 10______
+constexpr uint8 UTF8_OVERLONG_3 = 1 << 2;  // 11100000 100_____
+constexpr uint8 UTF8_TOO_LARGE = 1 << 3;   // 11110100 1001____, 11110100 101_____ or 11110101+ 10______
+constexpr uint8 UTF8_SURROGATE = 1 << 4;   // 11101101 101_____
+constexpr uint8 UTF8_OVERLONG_2 = 1 << 5;  // 1100000_ 10______
+constexpr uint8 UTF8_TOO_LARGE_1000 = 1 << 6;  // 11110101+ 1000____
+constexpr uint8 UTF8_OVERLONG_4 = 1 << 6;      // 11110000 1000____
+constexpr uint8 UTF8_TWO_CONTINUATIONS = 1 << 7;  // 10______ 10______
+constexpr uint8 UTF8_CARRY = UTF8_TOO_SHORT | UTF8_TOO_LONG | UTF8_TWO_CONTINUATIONS;
+
+alignas(16) const uint8 UTF8_BYTE_1_HIGH_TABLE[16] = {
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TOO_LONG,
+    UTF8_TWO_CONTINUATIONS,
+    UTF8_TWO_CONTINUATIONS,
+    UTF8_TWO_CONTINUATIONS,
+    UTF8_TWO_CONTINUATIONS,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_2,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT | UTF8_OVERLONG_3 | UTF8_SURROGATE,
+    UTF8_TOO_SHORT | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4};
+
+alignas(16) const uint8 UTF8_BYTE_1_LOW_TABLE[16] = {
+    UTF8_CARRY | UTF8_OVERLONG_3 | UTF8_OVERLONG_2 | UTF8_OVERLONG_4,
+    UTF8_CARRY | UTF8_OVERLONG_2,
+    UTF8_CARRY,
+    UTF8_CARRY,
+    UTF8_CARRY | UTF8_TOO_LARGE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000 | UTF8_SURROGATE,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000,
+    UTF8_CARRY | UTF8_TOO_LARGE | UTF8_TOO_LARGE_1000};
+
+alignas(16) const uint8 UTF8_BYTE_2_HIGH_TABLE[16] = {
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE_1000 | UTF8_OVERLONG_4,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS | UTF8_OVERLONG_3 | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_LONG | UTF8_OVERLONG_2 | UTF8_TWO_CONTINUATIONS | UTF8_SURROGATE | UTF8_TOO_LARGE,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT,
+    UTF8_TOO_SHORT};
+
+// the last 3 bytes of a block must not start a sequence, which doesn't fit in the block
+alignas(32) const uint8 UTF8_INCOMPLETE_MAX_VALUE[32] = {
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDF, 0xBF};
+
+TD_X86_TARGET("sse4.2") __m128i utf8_load_table_sse42(const uint8 *table) {
+  return _mm_load_si128(reinterpret_cast<const __m128i *>(table));
+}
+
+struct Utf8CheckerSse42 {
+  __m128i error;
+  __m128i prev_input;
+  __m128i prev_incomplete;
+};
+
+TD_X86_TARGET("sse4.2") void check_utf8_block_sse42(Utf8CheckerSse42 &checker, __m128i input) {
+  if (_mm_movemask_epi8(input) == 0) {
+    checker.error = _mm_or_si128(checker.error, checker.prev_incomplete);
+    checker.prev_incomplete = _mm_setzero_si128();
+    checker.prev_input = input;
+    return;
+  }
+
+  const __m128i low_nibble_mask = _mm_set1_epi8(0x0F);
+  auto prev1 = _mm_alignr_epi8(input, checker.prev_input, 15);
+  auto byte_1_high = _mm_shuffle_epi8(utf8_load_table_sse42(UTF8_BYTE_1_HIGH_TABLE),
+                                      _mm_and_si128(_mm_srli_epi16(prev1, 4), low_nibble_mask));
+  auto byte_1_low =
+      _mm_shuffle_epi8(utf8_load_table_sse42(UTF8_BYTE_1_LOW_TABLE), _mm_and_si128(prev1, low_nibble_mask));
+  auto byte_2_high = _mm_shuffle_epi8(utf8_load_table_sse42(UTF8_BYTE_2_HIGH_TABLE),
+                                      _mm_and_si128(_mm_srli_epi16(input, 4), low_nibble_mask));
+  auto special_cases = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+  auto prev2 = _mm_alignr_epi8(input, checker.prev_input, 14);
+  auto prev3 = _mm_alignr_epi8(input, checker.prev_input, 13);
+  auto is_third_byte = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+  auto is_fourth_byte = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+  auto must_be_continuation =
+      _mm_and_si128(_mm_or_si128(is_third_byte, is_fourth_byte), _mm_set1_epi8(static_cast<char>(0x80)));
+
+  checker.error = _mm_or_si128(checker.error, _mm_xor_si128(must_be_continuation, special_cases));
+  checker.prev_incomplete = _mm_subs_epu8(input, utf8_load_table_sse42(UTF8_INCOMPLETE_MAX_VALUE + 16));
+  checker.prev_input = input;
+}
+
+TD_X86_TARGET("sse4.2") bool check_utf8_sse42(const unsigned char *data, size_t size) {
+  Utf8CheckerSse42 checker;
+  checker.error = _mm_setzero_si128();
+  checker.prev_input = _mm_setzero_si128();
+  checker.prev_incomplete = _mm_setzero_si128();
+  size_t pos = 0;
+  for (; size - pos >= 16; pos += 16) {
+    check_utf8_block_sse42(checker, _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos)));
+  }
+
+  // zero bytes are valid, but can't continue a sequence, so incomplete sequences at the end are found too
+  alignas(16) unsigned char tail[16] = {};
+  std::memcpy(tail, data + pos, size - pos);
+  check_utf8_block_sse42(checker, _mm_load_si128(reinterpret_cast<const __m128i *>(tail)));
+  return _mm_testz_si128(checker.error, checker.error) != 0;
+}
+
+TD_X86_TARGET("avx2") __m256i utf8_load_table_avx2(const uint8 *table) {
+  return _mm256_broadcastsi128_si256(_mm_load_si128(reinterpret_cast<const __m128i *>(table)));
+}
+
+struct Utf8CheckerAvx2 {
+  __m256i error;
+  __m256i prev_input;
+  __m256i prev_incomplete;
+};
+
+TD_X86_TARGET("avx2") void check_utf8_block_avx2(Utf8CheckerAvx2 &checker, __m256i input) {
+  if (_mm256_movemask_epi8(input) == 0) {
+    checker.error = _mm256_or_si256(checker.error, checker.prev_incomplete);
+    checker.prev_incomplete = _mm256_setzero_si256();
+    checker.prev_input = input;
+    return;
+  }
+
+  const __m256i low_nibble_mask = _mm256_set1_epi8(0x0F);
+  // the previous 16 bytes for each 128-bit lane
+  auto prev_lanes = _mm256_permute2x128_si256(checker.prev_input, input, 0x21);
+  auto prev1 = _mm256_alignr_epi8(input, prev_lanes, 15);
+  auto byte_1_high = _mm256_shuffle_epi8(utf8_load_table_avx2(UTF8_BYTE_1_HIGH_TABLE),
+                                         _mm256_and_si256(_mm256_srli_epi16(prev1, 4), low_nibble_mask));
+  auto byte_1_low =
+      _mm256_shuffle_epi8(utf8_load_table_avx2(UTF8_BYTE_1_LOW_TABLE), _mm256_and_si256(prev1, low_nibble_mask));
+  auto byte_2_high = _mm256_shuffle_epi8(utf8_load_table_avx2(UTF8_BYTE_2_HIGH_TABLE),
+                                         _mm256_and_si256(_mm256_srli_epi16(input, 4), low_nibble_mask));
+  auto special_cases = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+  auto prev2 = _mm256_alignr_epi8(input, prev_lanes, 14);
+  auto prev3 = _mm256_alignr_epi8(input, prev_lanes, 13);
+  auto is_third_byte = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xE0 - 0x80)));
+  auto is_fourth_byte = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xF0 - 0x80)));
+  auto must_be_continuation =
+      _mm256_and_si256(_mm256_or_si256(is_third_byte, is_fourth_byte), _mm256_set1_epi8(static_cast<char>(0x80)));
+
+  checker.error = _mm256_or_si256(checker.error, _mm256_xor_si256(must_be_continuation, special_cases));
+  checker.prev_incomplete =
+      _mm256_subs_epu8(input, _mm256_load_si256(reinterpret_cast<const __m256i *>(UTF8_INCOMPLETE_MAX_VALUE)));
+  checker.prev_input = input;
+}
+
+TD_X86_TARGET("avx2") bool check_utf8_avx2(const unsigned char *data, size_t size) {
+  Utf8CheckerAvx2 checker;
+  checker.error = _mm256_setzero_si256();
+  checker.prev_input = _mm256_setzero_si256();
+  checker.prev_incomplete = _mm256_setzero_si256();
+  size_t pos = 0;
+  for (; size - pos >= 32; pos += 32) {
+    check_utf8_block_avx2(checker, _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + pos)));
+  }
+
+  alignas(32) unsigned char tail[32] = {};
+  std::memcpy(tail, data + pos, size - pos);
+  check_utf8_block_avx2(checker, _mm256_load_si256(reinterpret_cast<const __m256i *>(tail)));
+  return _mm256_testz_si256(checker.error, checker.error) != 0;
+}
+
+// counts first code units and first code units of 4-byte sequences, which need a surrogate pair;
+// per-byte counters are summed up before they can overflow
+TD_X86_TARGET("sse4.2") size_t utf8_utf16_length_sse42(const unsigned char *data, size_t size) {
+  const __m128i max_continuation = _mm_set1_epi8(static_cast<char>(0xBF));
+  const __m128i four_byte_lead_mask = _mm_set1_epi8(static_cast<char>(0xF8));
+  const __m128i four_byte_lead = _mm_set1_epi8(static_cast<char>(0xF0));
+  size_t result = 0;
+  size_t pos = 0;
+  while (size - pos >= 16) {
+    auto block_end = pos + 16 * td::min(static_cast<size_t>(127), (size - pos) / 16);
+    __m128i counts = _mm_setzero_si128();
+    for (; pos < block_end; pos += 16) {
+      auto input = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + pos));
+      auto is_first_code_unit = _mm_cmpgt_epi8(input, max_continuation);
+      auto is_four_byte_lead = _mm_cmpeq_epi8(_mm_and_si128(input, four_byte_lead_mask), four_byte_lead);
+      counts = _mm_sub_epi8(counts, _mm_add_epi8(is_first_code_unit, is_four_byte_lead));
+    }
+    auto sums = _mm_sad_epu8(counts, _mm_setzero_si128());
+    result += static_cast<size_t>(_mm_extract_epi16(sums, 0)) + static_cast<size_t>(_mm_extract_epi16(sums, 4));
+  }
+  return result + utf8_utf16_length_scalar(data + pos, size - pos);
+}
+
+TD_X86_TARGET("avx2") size_t utf8_utf16_length_avx2(const unsigned char *data, size_t size) {
+  const __m256i max_continuation = _mm256_set1_epi8(static_cast<char>(0xBF));
+  const __m256i four_byte_lead_mask = _mm256_set1_epi8(static_cast<char>(0xF8));
+  const __m256i four_byte_lead = _mm256_set1_epi8(static_cast<char>(0xF0));
+  size_t result = 0;
+  size_t pos = 0;
+  while (size - pos >= 32) {
+    auto block_end = pos + 32 * td::min(static_cast<size_t>(127), (size - pos) / 32);
+    __m256i counts = _mm256_setzero_si256();
+    for (; pos < block_end; pos += 32) {
+      auto input = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + pos));
+      auto is_first_code_unit = _mm256_cmpgt_epi8(input, max_continuation);
+      auto is_four_byte_lead = _mm256_cmpeq_epi8(_mm256_and_si256(input, four_byte_lead_mask), four_byte_lead);
+      counts = _mm256_sub_epi8(counts, _mm256_add_epi8(is_first_code_unit, is_four_byte_lead));
+    }
+    auto sums = _mm256_sad_epu8(counts, _mm256_setzero_si256());
+    result += static_cast<size_t>(_mm256_extract_epi16(sums, 0)) + static_cast<size_t>(_mm256_extract_epi16(sums, 4)) +
+              static_cast<size_t>(_mm256_extract_epi16(sums, 8)) + static_cast<size_t>(_mm256_extract_epi16(sums, 12));
+  }
+  return result + utf8_utf16_length_scalar(data + pos, size - pos);
+}
+#endif
+
+}  // namespace
+
+bool check_utf8(CSlice str) {
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (str.size() >= 32 && CpuFeatures::get().has_avx2) {
+    return check_utf8_avx2(str.ubegin(), str.size());
+  }
+  if (str.size() >= 16 && CpuFeatures::get().has_sse42) {
+    return check_utf8_sse42(str.ubegin(), str.size());
+  }
+#endif
+  return check_utf8_scalar(str);
+}
+
 const unsigned char *next_utf8_unsafe(const unsigned char *ptr, uint32 *code) {
   uint32 a = ptr[0];
   if ((a & 0x80) == 0) {
@@ -157,11 +426,15 @@ string utf8_encode(CSlice data) {
 }
 
 size_t utf8_utf16_length(Slice str) {
-  size_t result = 0;
-  for (auto c : str) {
-    result += is_utf8_character_first_code_unit(c) + ((c & 0xf8) == 0xf0);
+#if TD_HAVE_X86_TARGET_ATTRIBUTE
+  if (str.size() >= 32 && CpuFeatures::get().has_avx2) {
+    return utf8_utf16_length_avx2(str.ubegin(), str.size());
   }
-  return result;
+  if (str.size() >= 16 && CpuFeatures::get().has_sse42) {
+    return utf8_utf16_length_sse42(str.ubegin(), str.size());
+  }
+#endif
+  return utf8_utf16_length_scalar(str.ubegin(), str.size());
 }
 
 Slice utf8_utf16_truncate(Slice str, size_t length) {
@@ -0,0 +1,120 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "td/utils/common.h"
+#include "td/utils/JsonBuilder.h"
+#include "td/utils/port/sleep.h"
+#include "td/utils/port/thread.h"
+#include "td/utils/Slice.h"
+#include "td/utils/tests.h"
+#include "td/utils/Tracer.h"
+
+#include <atomic>
+
+TEST(Tracer, chrome_trace) {
+  td::Tracer::instant("test", "ignored");
+  td::Tracer::start();
+  ASSERT_TRUE(td::Tracer::is_enabled());
+
+  td::string long_name(2 * td::Tracer::MAX_NAME_SIZE, 'a');
+  for (size_t i = 0; i < td::Tracer::EVENTS_PER_THREAD + 10; i++) {
+    td::Tracer::async_instant("test", long_name, 1);
+  }
+  // the last character doesn't fit and must be dropped entirely
+  td::string utf8_name(td::Tracer::MAX_NAME_SIZE - 1, 'b');
+  utf8_name += "\xD0\xB0";
+  td::Tracer::instant("test", utf8_name);
+
+  auto flow_id = td::Tracer::next_id();
+  ASSERT_TRUE(flow_id != 0);
+  td::Tracer::begin("test", "send");
+  td::Tracer::flow_begin("test", "flow", flow_id);
+  td::Tracer::end("test", "send");
+
+  td::thread receiver([flow_id] {
+    td::Tracer::begin("test", "receive");
+    td::Tracer::flow_end("test", "flow", flow_id);
+    td::Tracer::end("test", "receive");
+  });
+  receiver.join();
+
+  td::Tracer::stop();
+  td::Tracer::instant("test", "ignored");
+  ASSERT_TRUE(!td::Tracer::is_enabled());
+
+  auto trace = td::Tracer::get_trace();
+  auto r_value = td::json_decode(trace);
+  ASSERT_TRUE(r_value.is_ok());
+  auto value = r_value.move_as_ok();
+  ASSERT_TRUE(value.type() == td::JsonValue::Type::Object);
+  auto &object = value.get_object();
+  ASSERT_TRUE(!object.empty());
+  ASSERT_EQ("traceEvents", object[0].first);
+  ASSERT_TRUE(object[0].second.type() == td::JsonValue::Type::Array);
+
+  size_t event_count = 0;
+  size_t flow_count = 0;
+  size_t async_count = 0;
+  for (auto &event : object[0].second.get_array()) {
+    ASSERT_TRUE(event.type() == td::JsonValue::Type::Object);
+    td::Slice phase;
+    td::Slice name;
+    for (auto &field : event.get_object()) {
+      if (field.first == "ph") {
+        phase = field.second.get_string();
+      } else if (field.first == "name") {
+        name = field.second.get_string();
+      }
+    }
+    ASSERT_TRUE(name != "ignored");
+    if (phase == "M") {
+      continue;
+    }
+    event_count++;
+    if (phase == "s" || phase == "f") {
+      flow_count++;
+    }
+    if (phase == "n") {
+      ASSERT_EQ(td::Tracer::MAX_NAME_SIZE, name.size());
+      async_count++;
+    }
+    if (phase == "i") {
+      ASSERT_EQ(td::string(td::Tracer::MAX_NAME_SIZE - 1, 'b'), name);
+    }
+  }
+  ASSERT_EQ(2u, flow_count);
+  ASSERT_EQ(td::Tracer::EVENTS_PER_THREAD - 4, async_count);
+  ASSERT_EQ(td::Tracer::EVENTS_PER_THREAD + 3, event_count);
+}
+
+TEST(Tracer, stop_while_recording) {
+  td::Tracer::start();
+  constexpr int THREAD_COUNT = 3;
+  std::atomic<int> started_thread_count{0};
+  td::vector<td::thread> threads;
+  for (int i = 0; i < THREAD_COUNT; i++) {
+    threads.emplace_back([&started_thread_count] {
+      for (int j = 0; j < 100000; j++) {
+        td::Tracer::instant("test", "event");
+        if (j == 1000) {
+          started_thread_count++;
+        }
+      }
+    });
+  }
+  while (started_thread_count != THREAD_COUNT) {
+    td::usleep_for(1);
+  }
+
+  // the trace can be read while other threads are still trying to record events
+  td::Tracer::stop();
+  auto trace = td::Tracer::get_trace();
+  for (auto &thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(trace, td::Tracer::get_trace());
+  ASSERT_TRUE(td::json_decode(trace).is_ok());
+}
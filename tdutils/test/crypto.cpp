@@ -160,6 +160,45 @@ TEST(Crypto, AesIgeState) {
   }
 }
 
+TEST(Crypto, AesIgeMulti) {
+  for (int test = 0; test < 100; test++) {
+    auto buffer_count = td::Random::fast(0, 20);
+    td::vector<td::string> keys;
+    td::vector<td::string> ivs;
+    td::vector<td::string> data;
+    for (int i = 0; i < buffer_count; i++) {
+      keys.push_back(td::rand_string(0, 255, 32));
+      ivs.push_back(td::rand_string(0, 255, 32));
+      data.push_back(td::rand_string(0, 255, 16 * td::Random::fast(0, td::Random::fast_bool() ? 4 : 100)));
+    }
+
+    auto expected_ivs = ivs;
+    auto expected_data = data;
+    for (int i = 0; i < buffer_count; i++) {
+      td::aes_ige_encrypt(keys[i], expected_ivs[i], expected_data[i], expected_data[i]);
+    }
+
+    auto new_ivs = ivs;
+    auto new_data = data;
+    td::vector<td::AesIgeBuffer> buffers;
+    for (int i = 0; i < buffer_count; i++) {
+      buffers.push_back({keys[i], new_ivs[i], new_data[i], new_data[i]});
+    }
+    td::aes_ige_encrypt_multi(buffers);
+    ASSERT_TRUE(expected_ivs == new_ivs);
+    ASSERT_TRUE(expected_data == new_data);
+
+    new_ivs = ivs;
+    buffers.clear();
+    for (int i = 0; i < buffer_count; i++) {
+      buffers.push_back({keys[i], new_ivs[i], new_data[i], new_data[i]});
+    }
+    td::aes_ige_decrypt_multi(buffers);
+    ASSERT_TRUE(data == new_data);
+    ASSERT_TRUE(expected_ivs == new_ivs);
+  }
+}
+
 TEST(Crypto, AesCbcState) {
   td::vector<td::uint32> answers1{0u, 3617355989u, 3449188102u, 186999968u, 4244808847u, 2626031206u};
 
@@ -341,7 +380,6 @@ TEST(Crypto, crc32) {
 }
 #endif
 
-#if TD_HAVE_CRC32C
 TEST(Crypto, crc32c) {
   td::vector<td::uint32> answers{0u, 2432014819u, 1077264849u, 1131405888u};
 
@@ -359,6 +397,24 @@ TEST(Crypto, crc32c) {
     ASSERT_EQ(answers[i], a);
     ASSERT_EQ(answers[i], b);
   }
+
+  auto crc32c_slow = [](td::Slice data) {
+    td::uint32 crc = 0xFFFFFFFF;
+    for (auto c : data) {
+      crc ^= static_cast<unsigned char>(c);
+      for (int j = 0; j < 8; j++) {
+        crc = (crc >> 1) ^ (0x82F63B78u & (0 - (crc & 1)));
+      }
+    }
+    return ~crc;
+  };
+  auto data = td::rand_string(std::numeric_limits<char>::min(), std::numeric_limits<char>::max(), 1000);
+  for (size_t begin = 0; begin < 16; begin++) {
+    for (size_t size = 0; begin + size <= data.size(); size += td::Random::fast(1, 20)) {
+      auto slice = td::Slice(data).substr(begin, size);
+      ASSERT_EQ(crc32c_slow(slice), td::crc32c(slice));
+    }
+  }
 }
 
 TEST(Crypto, crc32c_benchmark) {
@@ -402,7 +458,6 @@ TEST(Crypto, crc32c_benchmark) {
   bench(Crc32cExtendBenchmark(128));
   bench(Crc32cExtendBenchmark(65536));
 }
-#endif
 
 TEST(Crypto, crc64) {
   td::vector<td::uint64> answers{0ull, 3039664240384658157ull, 17549519902062861804ull, 8794730974279819706ull};
@@ -410,6 +465,33 @@ TEST(Crypto, crc64) {
   for (std::size_t i = 0; i < strings.size(); i++) {
     ASSERT_EQ(answers[i], td::crc64(strings[i]));
   }
+
+  auto crc64_slow = [](td::Slice data) {
+    td::uint64 crc = static_cast<td::uint64>(-1);
+    for (auto c : data) {
+      crc ^= static_cast<unsigned char>(c);
+      for (int j = 0; j < 8; j++) {
+        crc = (crc >> 1) ^ (0xC96C5795D7870F42ull & (0 - (crc & 1)));
+      }
+    }
+    return ~crc;
+  };
+  auto data = td::rand_string(std::numeric_limits<char>::min(), std::numeric_limits<char>::max(), 1000);
+  for (size_t begin = 0; begin < 16; begin++) {
+    for (size_t size = 0; begin + size <= data.size(); size += td::Random::fast(1, 20)) {
+      auto slice = td::Slice(data).substr(begin, size);
+      auto expected = crc64_slow(slice);
+      ASSERT_EQ(expected, td::crc64(slice));
+      ASSERT_EQ(expected, td::detail::crc64_software(slice));
+      ASSERT_EQ(expected, td::detail::crc64_pclmul(slice));
+    }
+  }
+  for (int i = 0; i < 1000; i++) {
+    auto slice = td::Slice(data).substr(td::Random::fast(0, 15)).truncate(td::Random::fast(0, 1000));
+    auto expected = crc64_slow(slice);
+    ASSERT_EQ(expected, td::detail::crc64_software(slice));
+    ASSERT_EQ(expected, td::detail::crc64_pclmul(slice));
+  }
 }
 
 TEST(Crypto, crc16) {
@@ -418,6 +500,33 @@ TEST(Crypto, crc16) {
   for (std::size_t i = 0; i < strings.size(); i++) {
     ASSERT_EQ(answers[i], td::crc16(strings[i]));
   }
+
+  auto crc16_slow = [](td::Slice data) {
+    td::uint32 crc = 0;
+    for (auto c : data) {
+      crc ^= static_cast<td::uint32>(static_cast<unsigned char>(c)) << 8;
+      for (int j = 0; j < 8; j++) {
+        crc = ((crc << 1) ^ (0x1021u & (0 - (crc >> 15)))) & 0xFFFF;
+      }
+    }
+    return static_cast<td::uint16>(crc);
+  };
+  auto data = td::rand_string(std::numeric_limits<char>::min(), std::numeric_limits<char>::max(), 1000);
+  for (size_t begin = 0; begin < 16; begin++) {
+    for (size_t size = 0; begin + size <= data.size(); size += td::Random::fast(1, 20)) {
+      auto slice = td::Slice(data).substr(begin, size);
+      auto expected = crc16_slow(slice);
+      ASSERT_EQ(expected, td::crc16(slice));
+      ASSERT_EQ(expected, td::detail::crc16_software(slice));
+      ASSERT_EQ(expected, td::detail::crc16_pclmul(slice));
+    }
+  }
+  for (int i = 0; i < 1000; i++) {
+    auto slice = td::Slice(data).substr(td::Random::fast(0, 15)).truncate(td::Random::fast(0, 1000));
+    auto expected = crc16_slow(slice);
+    ASSERT_EQ(expected, td::detail::crc16_software(slice));
+    ASSERT_EQ(expected, td::detail::crc16_pclmul(slice));
+  }
 }
 
 static td::Slice rsa_private_key = R"ABCD(
@@ -10,6 +10,8 @@
 #include "td/utils/Heap.h"
 #include "td/utils/Random.h"
 #include "td/utils/Span.h"
+#include "td/utils/Time.h"
+#include "td/utils/TimerWheel.h"
 
 #include <cstdio>
 #include <set>
@@ -176,3 +178,89 @@ TEST(Heap, random_events) {
     // heap.check();
   }
 }
+
+TEST(TimerWheel, random_events) {
+  struct Node final : public td::TimerWheelNode {
+    int id = 0;
+  };
+  for (auto precision : {0.001, 0.1, 1.0}) {
+    td::TimerWheel wheel(precision);
+    td::vector<Node> nodes(1000);
+    std::set<std::pair<double, int>> expected;
+    for (int i = 0; i < 1000; i++) {
+      nodes[i].id = i;
+    }
+    auto random_node = [&] {
+      return &nodes[td::Random::fast(0, static_cast<int>(nodes.size()) - 1)];
+    };
+
+    double now = 1000.0;
+    for (int i = 0; i < 300000; i++) {
+      int x = td::Random::fast(0, 9);
+      if (x < 4) {
+        auto node = random_node();
+        auto key = now + td::Random::fast(-1000, 1000000) * 0.001 * td::Random::fast(0, 1000);
+        if (node->in_timer_wheel()) {
+          expected.erase(std::make_pair(wheel.get_key(node), node->id));
+          wheel.fix(key, node, now);
+        } else {
+          wheel.insert(key, node, now);
+        }
+        expected.emplace(key, node->id);
+      } else if (x < 6) {
+        auto node = random_node();
+        if (node->in_timer_wheel()) {
+          expected.erase(std::make_pair(wheel.get_key(node), node->id));
+          wheel.erase(node);
+        }
+      } else {
+        now += td::Random::fast(0, 1000) * 0.001 * td::Random::fast(0, 100);
+        while (true) {
+          auto node = static_cast<Node *>(wheel.pop_expired(now));
+          if (node == nullptr) {
+            break;
+          }
+          ASSERT_TRUE(node->key_ < now);
+          ASSERT_EQ(1u, expected.erase(std::make_pair(node->key_, node->id)));
+        }
+        ASSERT_TRUE(expected.empty() || expected.begin()->first >= now);
+      }
+      ASSERT_EQ(expected.size(), wheel.size());
+      if (!wheel.empty()) {
+        ASSERT_TRUE(wheel.get_next_timeout() <= expected.begin()->first);
+      }
+    }
+  }
+}
+
+TEST(TimerWheel, far_key_then_near_keys) {
+  struct Node final : public td::TimerWheelNode {
+    int id = 0;
+  };
+  constexpr int NODE_COUNT = 100000;
+  td::TimerWheel wheel(0.001);
+  td::vector<Node> nodes(NODE_COUNT + 1);
+  auto now = td::Time::now();
+  nodes[NODE_COUNT].id = NODE_COUNT;
+  wheel.insert(now + 1e6, &nodes[NODE_COUNT], now);
+  for (int i = 0; i < NODE_COUNT; i++) {
+    nodes[i].id = i;
+    wheel.insert(now + 1.0 + i * 0.001, &nodes[i], now);
+  }
+  ASSERT_TRUE(wheel.get_next_timeout() <= now + 1.0);
+  ASSERT_TRUE(wheel.get_next_timeout() > now);
+
+  // each node must be found without scanning all other nodes
+  for (int i = 0; i < NODE_COUNT; i++) {
+    auto node = static_cast<Node *>(wheel.pop_expired(now + 1.0 + i * 0.001 + 0.0005));
+    ASSERT_TRUE(node != nullptr);
+    ASSERT_EQ(i, node->id);
+    ASSERT_TRUE(wheel.pop_expired(now + 1.0 + i * 0.001 + 0.0005) == nullptr);
+  }
+  ASSERT_EQ(1u, wheel.size());
+  ASSERT_TRUE(wheel.pop_expired(now + 1e5) == nullptr);
+  auto node = static_cast<Node *>(wheel.pop_expired(now + 1e6 + 1));
+  ASSERT_TRUE(node != nullptr);
+  ASSERT_EQ(NODE_COUNT, node->id);
+  ASSERT_TRUE(wheel.empty());
+}
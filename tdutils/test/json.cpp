@@ -7,9 +7,12 @@
 #include "td/utils/common.h"
 #include "td/utils/JsonBuilder.h"
 #include "td/utils/logging.h"
+#include "td/utils/Random.h"
 #include "td/utils/Slice.h"
+#include "td/utils/SliceBuilder.h"
 #include "td/utils/StringBuilder.h"
 #include "td/utils/tests.h"
+#include "td/utils/utf8.h"
 
 #include <utility>
 
@@ -89,3 +92,82 @@ TEST(JSON, kphp) {
       "{\"keyboard\":[[\"\\u2022 abcdefg\"],[\"\\u2022 hijklmnop\"],[\"\\u2022 "
       "qrstuvwxyz\"]],\"one_time_keyboard\":true}");
 }
+
+static td::string escape_json_string_slow(const td::vector<td::uint32> &code_points, bool escape_non_ascii) {
+  td::string result = "\"";
+  auto append_escaped = [&result](td::uint32 code) {
+    const char *hex_digits = "0123456789abcdef";
+    result += "\\u";
+    for (int shift = 12; shift >= 0; shift -= 4) {
+      result += hex_digits[(code >> shift) & 15];
+    }
+  };
+  for (auto code : code_points) {
+    switch (code) {
+      case '"':
+        result += "\\\"";
+        break;
+      case '\\':
+        result += "\\\\";
+        break;
+      case '\b':
+        result += "\\b";
+        break;
+      case '\f':
+        result += "\\f";
+        break;
+      case '\n':
+        result += "\\n";
+        break;
+      case '\r':
+        result += "\\r";
+        break;
+      case '\t':
+        result += "\\t";
+        break;
+      default:
+        if (code < 0x20) {
+          append_escaped(code);
+        } else if (code < 0x80 || !escape_non_ascii) {
+          td::append_utf8_character(result, code);
+        } else if (code < 0x10000) {
+          append_escaped(code);
+        } else {
+          append_escaped(0xD7C0 + (code >> 10));
+          append_escaped(0xDC00 + (code & 0x3FF));
+        }
+        break;
+    }
+  }
+  result += '"';
+  return result;
+}
+
+TEST(JSON, string_escaping) {
+  for (int i = 0; i < 100000; i++) {
+    td::vector<td::uint32> code_points(td::Random::fast(0, 100));
+    td::string str;
+    int max_code_point_type = td::Random::fast(0, 4);
+    for (auto &code : code_points) {
+      switch (td::Random::fast(0, max_code_point_type)) {
+        case 0:
+        case 1:
+          code = td::Random::fast(0x20, 0x7F);
+          break;
+        case 2:
+          code = td::Random::fast(0, 0x7F);
+          break;
+        case 3:
+          code = td::Random::fast(0x80, 0xD7FF);
+          break;
+        case 4:
+          code = td::Random::fast(0xE000, 0x10FFFF);
+          break;
+      }
+      td::append_utf8_character(str, code);
+    }
+
+    ASSERT_STREQ(escape_json_string_slow(code_points, true), PSLICE() << td::JsonString(str));
+    ASSERT_STREQ(escape_json_string_slow(code_points, false), PSLICE() << td::JsonRawString(str));
+  }
+}
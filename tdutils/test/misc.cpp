@@ -7,6 +7,7 @@
 #include "td/utils/algorithm.h"
 #include "td/utils/as.h"
 #include "td/utils/base64.h"
+#include "td/utils/benchmark.h"
 #include "td/utils/BigNum.h"
 #include "td/utils/bits.h"
 #include "td/utils/CancellationToken.h"
@@ -45,8 +46,11 @@
 
 #include <algorithm>
 #include <atomic>
+#include <cmath>
 #include <limits>
 #include <locale>
+#include <sstream>
+#include <string>
 #include <unordered_map>
 #include <utility>
 
@@ -515,6 +519,39 @@ TEST(Misc, print_uint) {
   ASSERT_STREQ("9223372036854775807", PSLICE() << 9223372036854775807u);
 }
 
+TEST(Misc, print_int_random) {
+  for (int i = 0; i < 100000; i++) {
+    auto x = static_cast<td::int64>(td::Random::fast_uint64()) >> td::Random::fast(0, 63);
+    ASSERT_STREQ(std::to_string(x), PSLICE() << x);
+    ASSERT_STREQ(std::to_string(static_cast<td::uint64>(x)), PSLICE() << static_cast<td::uint64>(x));
+    ASSERT_STREQ(std::to_string(static_cast<td::int32>(x)), PSLICE() << static_cast<td::int32>(x));
+  }
+}
+
+TEST(Misc, print_fixed_double) {
+  std::stringstream ss;
+  ss.imbue(std::locale::classic());
+  ss.setf(std::ios_base::fixed, std::ios_base::floatfield);
+  auto test_double = [&ss](double x) {
+    for (int precision = 0; precision <= 10; precision++) {
+      ss.str(td::string());
+      ss.precision(precision);
+      ss << x;
+      ASSERT_STREQ(ss.str(), PSLICE() << td::StringBuilder::FixedDouble(x, precision));
+    }
+  };
+
+  for (auto x : {0.0, -0.0, 0.5, 1.5, 2.5, -2.5, 0.125, 0.0000005, 0.0000015, 0.9999995, 0.99999999999, -1e-10, 1e9 - 0.5,
+                 1e9, 123456789.987654321, -51.507351, 1e300}) {
+    test_double(x);
+  }
+  for (int i = 0; i < 100000; i++) {
+    auto x = td::Random::fast(-1000000000, 1000000000) * std::pow(10.0, td::Random::fast(-12, 2)) +
+             td::Random::fast(-1000, 1000) * 0.0005;
+    test_double(x);
+  }
+}
+
 static void test_idn_to_ascii_one(const td::string &host, const td::string &result) {
   if (result != td::idn_to_ascii(host).ok()) {
     LOG(ERROR) << "Failed to convert " << host << " to " << result << ", receive \"" << td::idn_to_ascii(host).ok()
@@ -647,6 +684,168 @@ TEST(Misc, get_unicode_simple_category_small) {
   LOG(INFO) << result;
 }
 
+static bool check_utf8_slow(td::Slice str) {
+  size_t pos = 0;
+  while (pos < str.size()) {
+    td::uint32 a = static_cast<unsigned char>(str[pos]);
+    size_t length;
+    td::uint32 code;
+    td::uint32 min_code;
+    if (a < 0x80) {
+      pos++;
+      continue;
+    } else if ((a & 0xE0) == 0xC0) {
+      length = 2;
+      code = a & 0x1F;
+      min_code = 0x80;
+    } else if ((a & 0xF0) == 0xE0) {
+      length = 3;
+      code = a & 0x0F;
+      min_code = 0x800;
+    } else if ((a & 0xF8) == 0xF0) {
+      length = 4;
+      code = a & 0x07;
+      min_code = 0x10000;
+    } else {
+      return false;
+    }
+    if (str.size() - pos < length) {
+      return false;
+    }
+    for (size_t i = 1; i < length; i++) {
+      td::uint32 c = static_cast<unsigned char>(str[pos + i]);
+      if ((c & 0xC0) != 0x80) {
+        return false;
+      }
+      code = (code << 6) | (c & 0x3F);
+    }
+    if (code < min_code || code > 0x10FFFF || (0xD800 <= code && code <= 0xDFFF)) {
+      return false;
+    }
+    pos += length;
+  }
+  return true;
+}
+
+static td::string gen_utf8_test_string() {
+  static const td::vector<td::string> invalid_pieces{"\x80", "\xBF", "\xC0\x80", "\xC1\xBF", "\xE0\x80\x80",
+                                                     "\xE0\x9F\xBF", "\xED\xA0\x80", "\xED\xBF\xBF", "\xF0\x80\x80\x80",
+                                                     "\xF0\x8F\xBF\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80",
+                                                     "\xF8\x88\x80\x80\x80", "\xFF", "\xC3", "\xE2\x82", "\xF0\x9F\x98"};
+  static const td::vector<td::uint32> edge_codes{0,      0x7F,   0x80,   0x7FF,   0x800,    0xD7FF,
+                                                 0xE000, 0xFFFF, 0x10000, 0xFFFFF, 0x100000, 0x10FFFF};
+  td::string str;
+  auto piece_count = td::Random::fast(0, 40);
+  for (int i = 0; i < piece_count; i++) {
+    switch (td::Random::fast(0, 5)) {
+      case 0:
+        str += td::string(td::Random::fast(1, 40), static_cast<char>(td::Random::fast(1, 127)));
+        break;
+      case 1:
+        td::append_utf8_character(str, edge_codes[td::Random::fast(0, static_cast<int>(edge_codes.size()) - 1)]);
+        break;
+      case 2:
+        td::append_utf8_character(str, td::Random::fast(0x80, 0xD7FF));
+        break;
+      case 3:
+        td::append_utf8_character(str, td::Random::fast(0x10000, 0x10FFFF));
+        break;
+      case 4:
+        if (td::Random::fast(0, 3) == 0) {
+          str += invalid_pieces[td::Random::fast(0, static_cast<int>(invalid_pieces.size()) - 1)];
+        }
+        break;
+      case 5:
+        if (td::Random::fast(0, 7) == 0 && !str.empty()) {
+          str[td::Random::fast(0, static_cast<int>(str.size()) - 1)] = static_cast<char>(td::Random::fast(0, 255));
+        }
+        break;
+    }
+  }
+  return str;
+}
+
+TEST(Misc, check_utf8) {
+  ASSERT_TRUE(td::check_utf8(""));
+  ASSERT_TRUE(td::check_utf8(td::string(100, '\0')));
+  ASSERT_TRUE(td::check_utf8("тест 测试 😀"));
+  ASSERT_TRUE(!td::check_utf8(td::string(100, 'a') + "\xC3"));
+
+  size_t valid_count = 0;
+  for (int i = 0; i < 100000; i++) {
+    auto str = gen_utf8_test_string();
+    auto is_valid = check_utf8_slow(str);
+    ASSERT_EQ(is_valid, td::check_utf8(str));
+    valid_count += is_valid;
+  }
+  ASSERT_TRUE(valid_count > 1000);
+  ASSERT_TRUE(valid_count < 99000);
+}
+
+TEST(Misc, utf8_utf16_length) {
+  auto utf8_utf16_length_slow = [](td::Slice str) {
+    size_t result = 0;
+    for (auto c : str) {
+      auto code_unit = static_cast<unsigned char>(c);
+      if ((code_unit & 0xC0) != 0x80) {
+        result += code_unit >= 0xF0 && code_unit < 0xF8 ? 2 : 1;
+      }
+    }
+    return result;
+  };
+
+  for (int i = 0; i < 10000; i++) {
+    auto str = i % 2 == 0 ? gen_utf8_test_string() : td::rand_string(-128, 127, td::Random::fast(0, 200));
+    ASSERT_EQ(utf8_utf16_length_slow(str), td::utf8_utf16_length(str));
+  }
+  ASSERT_EQ(20000u, td::utf8_utf16_length(td::string(10000, '\xF0')));
+  ASSERT_EQ(10000u, td::utf8_utf16_length(td::string(10000, '\xC0')));
+  ASSERT_EQ(0u, td::utf8_utf16_length(td::string(10000, '\x80')));
+}
+
+TEST(Misc, utf8_benchmark) {
+  class Utf8Benchmark final : public td::Benchmark {
+   public:
+    Utf8Benchmark(td::Slice name, td::Slice text, bool is_utf16_length)
+        : name_(name.str()), is_utf16_length_(is_utf16_length) {
+      while (data_.size() < 4096) {
+        data_.append(text.begin(), text.size());
+      }
+    }
+    td::string get_description() const final {
+      return PSTRING() << (is_utf16_length_ ? "utf8_utf16_length" : "check_utf8") << " [" << name_ << ' '
+                       << data_.size() << "B]";
+    }
+    void run(int n) final {
+      size_t res = 0;
+      for (int i = 0; i < n; i++) {
+        if (is_utf16_length_) {
+          res += td::utf8_utf16_length(data_);
+        } else {
+          res += td::check_utf8(data_);
+        }
+      }
+      td::do_not_optimize_away(res);
+    }
+
+   private:
+    td::string name_;
+    td::string data_;
+    bool is_utf16_length_;
+  };
+
+  td::vector<std::pair<td::Slice, td::Slice>> corpora{
+      {"ASCII", "The quick brown fox jumps over the lazy dog. "},
+      {"Cyrillic", "Съешь же ещё этих мягких французских булок, да выпей чаю. "},
+      {"CJK", "我能吞下玻璃而不伤身体。私はガラスを食べられます。それは私を傷つけません。"},
+      {"emoji", "😀👍🏻🎉❤️🔥🚀🌍 ok 🤔🙈💯✨ "}};
+  for (auto is_utf16_length : {false, true}) {
+    for (auto &corpus : corpora) {
+      bench(Utf8Benchmark(corpus.first, corpus.second, is_utf16_length), 0.1);
+    }
+  }
+}
+
 TEST(BigNum, from_decimal) {
   ASSERT_TRUE(td::BigNum::from_decimal("").is_error());
   ASSERT_TRUE(td::BigNum::from_decimal("a").is_error());
@@ -11,28 +11,42 @@
 #include "td/db/BinlogKeyValue.h"
 #include "td/db/DbKey.h"
 #include "td/db/SeqKeyValue.h"
+#include "td/db/SqliteCheckpointer.h"
 #include "td/db/SqliteConnectionSafe.h"
 #include "td/db/SqliteDb.h"
 #include "td/db/SqliteKeyValue.h"
 #include "td/db/SqliteKeyValueSafe.h"
+#include "td/db/SqliteReaderPool.h"
+#include "td/db/SqliteWriteBatcher.h"
 #include "td/db/TsSeqKeyValue.h"
 
 #include "td/actor/actor.h"
 #include "td/actor/ConcurrentScheduler.h"
 
+#include "td/utils/as.h"
 #include "td/utils/base64.h"
 #include "td/utils/common.h"
+#include "td/utils/crypto.h"
 #include "td/utils/filesystem.h"
 #include "td/utils/FlatHashMap.h"
 #include "td/utils/logging.h"
+#include "td/utils/misc.h"
 #include "td/utils/port/FileFd.h"
+#include "td/utils/port/path.h"
+#include "td/utils/port/Stat.h"
 #include "td/utils/port/thread.h"
+#include "td/utils/Promise.h"
 #include "td/utils/Random.h"
 #include "td/utils/Slice.h"
+#include "td/utils/SliceBuilder.h"
 #include "td/utils/Status.h"
 #include "td/utils/StringBuilder.h"
 #include "td/utils/tests.h"
+#include "td/utils/Time.h"
+#include "td/utils/tl_parsers.h"
 
+#include <algorithm>
+#include <atomic>
 #include <limits>
 #include <map>
 #include <memory>
@@ -138,6 +152,640 @@ TEST(DB, binlog_encryption) {
   td::Binlog::destroy(binlog_name).ignore();
 }
 
+TEST(DB, binlog_background_reindex) {
+  td::CSlice binlog_name = "test_binlog";
+  for (auto is_encrypted : {false, true}) {
+    auto db_key = is_encrypted ? td::DbKey::raw_key(td::string(32, 'A')) : td::DbKey::empty();
+    td::Binlog::destroy(binlog_name).ignore();
+
+    td::vector<td::uint64> event_ids;
+    td::vector<td::string> values;
+    {
+      td::Binlog binlog;
+      binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {}, db_key).ensure();
+      for (int i = 0; i < 1024; i++) {
+        values.push_back(td::string(1000, static_cast<char>('a' + i % 26)));
+        event_ids.push_back(binlog.add(1, td::create_storer(values.back())));
+      }
+
+      td::int64 max_size = 0;
+      bool was_reindexed = false;
+      for (int i = 0; i < 100000 && !was_reindexed; i++) {
+        auto pos = td::Random::fast(0, static_cast<int>(values.size()) - 1);
+        values[pos] = td::string(1000, static_cast<char>('a' + i % 26));
+        binlog.rewrite(event_ids[pos], 1, td::create_storer(values[pos]));
+
+        auto size = td::stat(binlog_name).move_as_ok().size_;
+        // after reindex the binlog shrinks to the size of live events, so compare with the middle between the size
+        // of live events and the size triggering reindex
+        was_reindexed = size * (100 + td::Binlog::BACKGROUND_REINDEX_SIZE_PERCENT) < max_size * 200;
+        max_size = td::max(max_size, size);
+      }
+      ASSERT_TRUE(was_reindexed);
+
+      for (int i = 0; i < 100; i++) {
+        auto pos = td::Random::fast(0, static_cast<int>(values.size()) - 1);
+        values[pos] = td::string(1000, static_cast<char>('A' + i % 26));
+        binlog.rewrite(event_ids[pos], 1, td::create_storer(values[pos]));
+      }
+      binlog.close().ensure();
+    }
+
+    td::vector<td::string> v;
+    td::Binlog binlog;
+    binlog
+        .init(
+            binlog_name.str(), [&](const td::BinlogEvent &x) { v.push_back(x.get_data().str()); }, db_key)
+        .ensure();
+    ASSERT_TRUE(v == values);
+    binlog.close_and_destroy().ensure();
+  }
+}
+
+static void write_binlog(td::CSlice binlog_name, const td::DbKey &db_key, td::vector<td::string> &values) {
+  td::Binlog::destroy(binlog_name).ignore();
+  td::Binlog binlog;
+  binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {}, db_key).ensure();
+  for (int i = 0; i < 1000; i++) {
+    values.push_back(td::string(4 * td::Random::fast(1, 100), static_cast<char>('a' + i % 26)));
+    binlog.add(1, td::create_storer(values.back()));
+  }
+  binlog.close().ensure();
+}
+
+static td::vector<td::string> read_binlog(td::CSlice binlog_name, const td::DbKey &db_key,
+                                          td::BinlogInfo *info = nullptr) {
+  td::vector<td::string> result;
+  td::Binlog binlog;
+  binlog
+      .init(
+          binlog_name.str(), [&](const td::BinlogEvent &x) { result.push_back(x.get_data().str()); }, db_key)
+      .ensure();
+  binlog.close().ensure();
+  if (info != nullptr) {
+    *info = binlog.get_info();
+  }
+  return result;
+}
+
+TEST(DB, binlog_crash_consistency) {
+  td::CSlice binlog_name = "test_binlog";
+  auto new_binlog_name = binlog_name.str() + ".new";
+  for (auto is_encrypted : {false, true}) {
+    auto db_key = is_encrypted ? td::DbKey::raw_key(td::string(32, 'A')) : td::DbKey::empty();
+    td::vector<td::string> values;
+    write_binlog(binlog_name, db_key, values);
+    auto binlog_data = td::read_file_str(binlog_name).move_as_ok();
+
+    // crash during reindex: the main binlog is intact and the new binlog is partially written
+    td::write_file(new_binlog_name, td::Slice(binlog_data).substr(0, binlog_data.size() / 2)).ensure();
+    ASSERT_TRUE(read_binlog(binlog_name, db_key) == values);
+
+    // crash after the main binlog was deleted, but before the new binlog was renamed
+    td::unlink(binlog_name).ensure();
+    td::write_file(new_binlog_name, binlog_data).ensure();
+    ASSERT_TRUE(read_binlog(binlog_name, db_key) == values);
+    ASSERT_TRUE(td::stat(new_binlog_name).is_error());
+
+    // crash during write: only a prefix of events must be replayed
+    for (int i = 0; i < 20; i++) {
+      auto size = td::Random::fast(0, static_cast<int>(binlog_data.size()));
+      td::write_file(binlog_name, td::Slice(binlog_data).substr(0, size)).ensure();
+      auto result = read_binlog(binlog_name, db_key);
+      ASSERT_TRUE(result.size() <= values.size());
+      ASSERT_TRUE(td::vector<td::string>(values.begin(), values.begin() + result.size()) == result);
+    }
+
+    // unwritten data at the end of the binlog is ignored
+    td::write_file(binlog_name, binlog_data + td::string(100, '\0')).ensure();
+    ASSERT_TRUE(read_binlog(binlog_name, db_key) == values);
+
+    td::Binlog::destroy(binlog_name).ignore();
+  }
+}
+
+TEST(DB, binlog_snapshot) {
+  td::CSlice binlog_name = "test_binlog";
+  auto snapshot_name = binlog_name.str() + ".snapshot";
+  for (auto is_encrypted : {false, true}) {
+    auto db_key = is_encrypted ? td::DbKey::raw_key(td::string(32, 'A')) : td::DbKey::empty();
+    td::Binlog::destroy(binlog_name).ignore();
+
+    td::vector<td::uint64> event_ids;
+    td::vector<td::string> values;
+    td::uint64 erased_event_id = 0;
+    {
+      td::Binlog binlog;
+      binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {}, db_key).ensure();
+      for (int i = 0; i < 1100; i++) {
+        values.push_back(td::string(1000, static_cast<char>('a' + i % 26)));
+        event_ids.push_back(binlog.add(1, td::create_storer(values.back())));
+      }
+      erased_event_id = binlog.add(1, td::create_storer(td::string(100, 'x')));
+      binlog.erase(erased_event_id);
+      for (int i = 0; i < 100000 && td::stat(snapshot_name).is_error(); i++) {
+        auto pos = td::Random::fast(0, static_cast<int>(values.size()) - 1);
+        values[pos] = td::string(1000, static_cast<char>('a' + i % 26));
+        binlog.rewrite(event_ids[pos], 1, td::create_storer(values[pos]));
+      }
+      ASSERT_TRUE(td::stat(snapshot_name).is_ok());
+
+      // events changed after the snapshot are read from the binlog
+      for (int i = 0; i < 100; i++) {
+        auto pos = td::Random::fast(0, static_cast<int>(values.size()) - 1);
+        values[pos] = td::string(1000, static_cast<char>('A' + i % 26));
+        binlog.rewrite(event_ids[pos], 1, td::create_storer(values[pos]));
+      }
+      binlog.erase(event_ids[0]);
+      event_ids.erase(event_ids.begin());
+      values.erase(values.begin());
+      binlog.close().ensure();
+    }
+    auto binlog_data = td::read_file_str(binlog_name).move_as_ok();
+    auto snapshot_data = td::read_file_str(snapshot_name).move_as_ok();
+    auto restore_files = [&] {
+      td::write_file(binlog_name, binlog_data).ensure();
+      td::write_file(snapshot_name, snapshot_data).ensure();
+    };
+    auto check_binlog = [&](bool expect_snapshot_used) {
+      td::BinlogInfo info;
+      ASSERT_TRUE(read_binlog(binlog_name, db_key, &info) == values);
+      ASSERT_EQ(expect_snapshot_used, info.was_snapshot_used);
+      ASSERT_EQ(expect_snapshot_used, td::stat(snapshot_name).is_ok());
+    };
+
+    check_binlog(true);
+    check_binlog(true);
+
+    // the same events are replayed without the snapshot
+    td::unlink(snapshot_name).ensure();
+    check_binlog(false);
+
+    // new event identifiers don't repeat identifiers of events deleted before the snapshot
+    restore_files();
+    {
+      td::Binlog binlog;
+      binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {}, db_key).ensure();
+      ASSERT_TRUE(binlog.get_info().was_snapshot_used);
+      ASSERT_TRUE(binlog.peek_next_event_id() > erased_event_id);
+      binlog.close().ensure();
+    }
+
+    // a partially written new snapshot is ignored
+    restore_files();
+    td::write_file(snapshot_name + ".new", td::Slice(snapshot_data).substr(0, snapshot_data.size() / 2)).ensure();
+    check_binlog(true);
+    td::unlink(snapshot_name + ".new").ensure();
+
+    // a torn or corrupted snapshot is ignored and deleted
+    for (int i = 0; i < 10; i++) {
+      restore_files();
+      auto size = td::Random::fast(0, static_cast<int>(snapshot_data.size()) - 1);
+      td::write_file(snapshot_name, td::Slice(snapshot_data).substr(0, size)).ensure();
+      check_binlog(false);
+    }
+    for (int i = 0; i < 10; i++) {
+      restore_files();
+      auto corrupted_snapshot_data = snapshot_data;
+      corrupted_snapshot_data[td::Random::fast(0, static_cast<int>(snapshot_data.size()) - 1)] ^= 1;
+      td::write_file(snapshot_name, corrupted_snapshot_data).ensure();
+      check_binlog(false);
+    }
+
+    // a snapshot isn't used if the binlog lost data written before the snapshot
+    auto zeroed_binlog_data = binlog_data;
+    std::fill(zeroed_binlog_data.begin() + binlog_data.size() / 2, zeroed_binlog_data.end(), '\0');
+    for (auto &lost_binlog_data : {binlog_data.substr(0, binlog_data.size() / 2), zeroed_binlog_data}) {
+      td::unlink(snapshot_name).ignore();
+      td::write_file(binlog_name, lost_binlog_data).ensure();
+      auto expected_values = read_binlog(binlog_name, db_key);
+      ASSERT_TRUE(expected_values != values);
+
+      td::write_file(binlog_name, lost_binlog_data).ensure();
+      td::write_file(snapshot_name, snapshot_data).ensure();
+      td::BinlogInfo info;
+      ASSERT_TRUE(read_binlog(binlog_name, db_key, &info) == expected_values);
+      ASSERT_TRUE(!info.was_snapshot_used);
+      ASSERT_TRUE(td::stat(snapshot_name).is_error());
+    }
+
+    // a snapshot of the binlog before regeneration is ignored
+    restore_files();
+    {
+      td::Binlog binlog;
+      binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {}, db_key).ensure();
+      binlog.change_key(db_key);
+      ASSERT_TRUE(td::stat(snapshot_name).is_error());
+      binlog.close().ensure();
+    }
+    td::write_file(snapshot_name, snapshot_data).ensure();
+    check_binlog(false);
+
+    if (is_encrypted) {
+      restore_files();
+      td::Binlog binlog;
+      auto status = binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {},
+                                td::DbKey::raw_key(td::string(32, 'B')));
+      ASSERT_EQ(static_cast<int>(td::Binlog::Error::WrongPassword), status.code());
+      ASSERT_TRUE(td::stat(snapshot_name).is_ok());
+    }
+
+    td::Binlog::destroy(binlog_name).ignore();
+    ASSERT_TRUE(td::stat(snapshot_name).is_error());
+  }
+}
+
+TEST(DB, binlog_big_load) {
+  td::CSlice binlog_name = "test_binlog";
+  for (auto is_encrypted : {false, true}) {
+    auto db_key = is_encrypted ? td::DbKey::raw_key(td::string(32, 'A')) : td::DbKey::empty();
+    td::vector<td::string> values;
+    {
+      td::Binlog::destroy(binlog_name).ignore();
+      td::Binlog binlog;
+      binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {}, db_key).ensure();
+      for (int i = 0; i < 6000; i++) {
+        td::string value = PSTRING() << i << ' ';
+        value.resize(4 * td::Random::fast(2, 500), 'a');
+        values.push_back(std::move(value));
+        binlog.add(1, td::create_storer(values.back()));
+      }
+      binlog.close().ensure();
+    }
+    ASSERT_TRUE(read_binlog(binlog_name, db_key) == values);
+
+    // events after a corrupted event must not be replayed
+    auto binlog_data = td::read_file_str(binlog_name).move_as_ok();
+    binlog_data[binlog_data.size() / 2] ^= 1;
+    td::write_file(binlog_name, binlog_data).ensure();
+    auto result = read_binlog(binlog_name, db_key);
+    ASSERT_TRUE(!result.empty() && result.size() < values.size());
+    ASSERT_TRUE(td::vector<td::string>(values.begin(), values.begin() + result.size()) == result);
+    ASSERT_TRUE(read_binlog(binlog_name, db_key) == result);
+  }
+  td::Binlog::destroy(binlog_name).ignore();
+}
+
+static td::vector<td::int32> get_binlog_event_flags(td::CSlice binlog_name) {
+  td::vector<td::int32> result;
+  auto binlog_data = td::read_file_str(binlog_name).move_as_ok();
+  size_t offset = 0;
+  while (offset < binlog_data.size()) {
+    auto size = td::TlParser(td::Slice(&binlog_data[offset], 4)).fetch_int();
+    td::BinlogEvent event(td::BufferSlice(td::Slice(&binlog_data[offset], size)),
+                          td::BinlogDebugInfo{__FILE__, __LINE__});
+    result.push_back(event.flags_);
+    offset += size;
+  }
+  return result;
+}
+
+TEST(DB, binlog_crc32c) {
+  td::CSlice binlog_name = "test_binlog";
+  td::vector<td::string> values;
+  write_binlog(binlog_name, td::DbKey::empty(), values);
+
+  // events are checksummed with the legacy zlib CRC32 by default
+  for (auto flags : get_binlog_event_flags(binlog_name)) {
+    ASSERT_TRUE((flags & td::BinlogEvent::Flags::Crc32c) == 0);
+  }
+
+  // events with CRC32C checksums can be appended on request
+  size_t crc32c_event_count = 100;
+  {
+    td::Binlog binlog;
+    binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {}).ensure();
+    for (size_t i = 0; i < crc32c_event_count; i++) {
+      values.push_back(td::string(4 * td::Random::fast(1, 100), static_cast<char>('a' + i % 26)));
+      binlog.add_raw_event(td::BinlogEvent::create_raw(binlog.next_event_id(), 1, td::BinlogEvent::Flags::Crc32c,
+                                                       td::create_storer(values.back())),
+                           td::BinlogDebugInfo{__FILE__, __LINE__});
+    }
+    binlog.close().ensure();
+  }
+  ASSERT_TRUE(read_binlog(binlog_name, td::DbKey::empty()) == values);
+  auto flags = get_binlog_event_flags(binlog_name);
+  ASSERT_TRUE(flags.size() >= crc32c_event_count);
+  for (size_t i = flags.size() - crc32c_event_count; i < flags.size(); i++) {
+    ASSERT_TRUE((flags[i] & td::BinlogEvent::Flags::Crc32c) != 0);
+  }
+
+  // a corrupted event with CRC32C checksum is detected
+  auto binlog_data = td::read_file_str(binlog_name).move_as_ok();
+  binlog_data[binlog_data.size() - 10] ^= 1;
+  td::write_file(binlog_name, binlog_data).ensure();
+  values.pop_back();
+  ASSERT_TRUE(read_binlog(binlog_name, td::DbKey::empty()) == values);
+
+  // events added by a binlog with enabled CRC32C checksums are replayed after reopening
+  td::Binlog::destroy(binlog_name).ignore();
+  values.clear();
+  {
+    td::Binlog binlog;
+    binlog.init(binlog_name.str(), [](const td::BinlogEvent &x) {}).ensure();
+    binlog.set_use_crc32c(true);
+    td::vector<td::uint64> event_ids;
+    for (size_t i = 0; i < crc32c_event_count; i++) {
+      values.push_back(td::string(4 * td::Random::fast(1, 100), static_cast<char>('a' + i % 26)));
+      event_ids.push_back(binlog.add(1, td::create_storer(values.back())));
+    }
+    binlog.erase(event_ids[0]);
+    values.erase(values.begin());
+    binlog.close().ensure();
+  }
+  ASSERT_TRUE(read_binlog(binlog_name, td::DbKey::empty()) == values);
+  flags = get_binlog_event_flags(binlog_name);
+  ASSERT_TRUE(flags.size() >= crc32c_event_count + 1);
+  for (size_t i = flags.size() - crc32c_event_count - 1; i < flags.size(); i++) {
+    ASSERT_TRUE((flags[i] & td::BinlogEvent::Flags::Crc32c) != 0);
+  }
+  td::Binlog::destroy(binlog_name).ignore();
+}
+
+TEST(DB, concurrent_binlog_group_commit) {
+  static constexpr int EVENT_COUNT = 100;
+  class Main final : public td::Actor {
+   public:
+    void start_up() final {
+      td::Binlog::destroy(binlog_name_).ignore();
+      binlog_->init(binlog_name_.str(), [](const td::BinlogEvent &) {}).ensure();
+      binlog_->set_group_commit_delay(0.05);
+      for (int i = 0; i < EVENT_COUNT; i++) {
+        binlog_->add(1, td::create_storer("AAAA"));
+        binlog_->force_sync(td::PromiseCreator::lambda([actor_id = actor_id(this)](td::Unit) {
+          send_closure(actor_id, &Main::on_synced);
+        }));
+      }
+    }
+
+    void on_synced() {
+      if (++synced_count_ < EVENT_COUNT) {
+        return;
+      }
+      auto statistics = binlog_->get_sync_statistics();
+      LOG(INFO) << statistics;
+      ASSERT_EQ(static_cast<td::uint64>(EVENT_COUNT), statistics.synced_request_count);
+      ASSERT_TRUE(statistics.sync_count < static_cast<td::uint64>(EVENT_COUNT) / 10);
+      ASSERT_TRUE(statistics.max_batch_size > 1);
+      ASSERT_TRUE(statistics.max_commit_latency >= statistics.average_commit_latency);
+      binlog_->close_and_destroy(td::PromiseCreator::lambda([](td::Unit) { td::Scheduler::instance()->finish(); }));
+      stop();
+    }
+
+   private:
+    td::CSlice binlog_name_ = "test_binlog";
+    std::shared_ptr<td::ConcurrentBinlog> binlog_ = std::make_shared<td::ConcurrentBinlog>();
+    int synced_count_ = 0;
+  };
+
+  td::ConcurrentScheduler sched(0, 0);
+  sched.create_actor_unsafe<Main>(0, "Main").release();
+  sched.start();
+  while (sched.run_main(10)) {
+    // empty
+  }
+  sched.finish();
+}
+
+TEST(DB, concurrent_binlog_lazy_sync) {
+  static constexpr int EVENT_COUNT = 100;
+  class Main final : public td::Actor {
+   public:
+    void start_up() final {
+      td::Binlog::destroy(binlog_name_).ignore();
+      binlog_->init(binlog_name_.str(), [](const td::BinlogEvent &) {}).ensure();
+      for (int i = 0; i < EVENT_COUNT; i++) {
+        binlog_->add(1, td::create_storer("AAAA"), td::PromiseCreator::lambda([actor_id = actor_id(this)](td::Unit) {
+                       send_closure(actor_id, &Main::on_synced);
+                     }));
+      }
+      set_timeout_in(0.2);
+    }
+
+    void timeout_expired() final {
+      // lazy sync requests don't cause a disk sync by themselves
+      ASSERT_EQ(0, synced_count_);
+      ASSERT_EQ(0u, binlog_->get_sync_statistics().sync_count);
+      binlog_->force_sync(td::PromiseCreator::lambda([actor_id = actor_id(this)](td::Unit) {
+        send_closure(actor_id, &Main::on_synced);
+      }));
+    }
+
+    void on_synced() {
+      if (++synced_count_ <= EVENT_COUNT) {
+        return;
+      }
+      // the forced sync request commits all pending lazy sync requests together with it
+      auto statistics = binlog_->get_sync_statistics();
+      ASSERT_EQ(1u, statistics.sync_count);
+      ASSERT_EQ(static_cast<td::uint64>(EVENT_COUNT + 1), statistics.synced_request_count);
+      binlog_->close_and_destroy(td::PromiseCreator::lambda([](td::Unit) { td::Scheduler::instance()->finish(); }));
+      stop();
+    }
+
+   private:
+    td::CSlice binlog_name_ = "test_binlog";
+    std::shared_ptr<td::ConcurrentBinlog> binlog_ = std::make_shared<td::ConcurrentBinlog>();
+    int synced_count_ = 0;
+  };
+
+  td::ConcurrentScheduler sched(0, 0);
+  sched.create_actor_unsafe<Main>(0, "Main").release();
+  sched.start();
+  while (sched.run_main(10)) {
+    // empty
+  }
+  sched.finish();
+}
+
+TEST(DB, binlog_key_value_prefix) {
+  td::CSlice path = "test_binlog";
+  td::Binlog::destroy(path).ignore();
+
+  std::map<td::string, td::string> baseline;
+  {
+    td::BinlogKeyValue<td::Binlog> kv;
+    kv.init(path.str()).ensure();
+    for (int i = 0; i < 1000; i++) {
+      auto key = PSTRING() << (i % 3 == 0 ? "a" : "ab") << i;
+      auto value = PSTRING() << i;
+      kv.set(key, value);
+      baseline[key] = value;
+    }
+    kv.set("b", "b");
+    baseline["b"] = "b";
+
+    auto check_prefix = [&](td::Slice prefix) {
+      auto prefix_values = kv.prefix_get(prefix);
+      size_t expected_count = 0;
+      for (auto &it : baseline) {
+        if (td::begins_with(it.first, prefix)) {
+          expected_count++;
+          ASSERT_EQ(it.second, prefix_values[it.first.substr(prefix.size())]);
+        }
+      }
+      ASSERT_EQ(expected_count, prefix_values.size());
+    };
+    check_prefix("a");
+    check_prefix("ab");
+    check_prefix("ab1");
+    check_prefix("c");
+    check_prefix("");
+    ASSERT_EQ(baseline.size(), kv.get_all().size());
+
+    kv.erase_by_prefix("ab1");
+    for (auto it = baseline.begin(); it != baseline.end();) {
+      if (td::begins_with(it->first, "ab1")) {
+        it = baseline.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    check_prefix("ab");
+    check_prefix("ab1");
+    ASSERT_EQ(baseline.size(), kv.get_all().size());
+    kv.close();
+  }
+  {
+    td::BinlogKeyValue<td::Binlog> kv;
+    kv.init(path.str()).ensure();
+    ASSERT_EQ(baseline.size(), kv.get_all().size());
+    for (auto &it : baseline) {
+      ASSERT_EQ(it.second, kv.get(it.first));
+    }
+    ASSERT_TRUE(kv.prefix_get("ab1").empty());
+    kv.close();
+  }
+  td::Binlog::destroy(path).ignore();
+}
+
+TEST(DB, sqlite_reader_pool) {
+  static constexpr int QUERY_COUNT = 100;
+  class Main final : public td::Actor {
+   public:
+    Main(std::atomic<int> *query_count, std::atomic<int> *bad_query_count)
+        : query_count_(query_count), bad_query_count_(bad_query_count) {
+    }
+
+    void start_up() final {
+      td::SqliteReaderPool pool({1, 2});
+      for (int i = 0; i < QUERY_COUNT; i++) {
+        pool.run([query_count = query_count_, bad_query_count = bad_query_count_] {
+          auto scheduler_id = td::Scheduler::instance()->sched_id();
+          if (scheduler_id != 1 && scheduler_id != 2) {
+            bad_query_count->fetch_add(1);
+          }
+          query_count->fetch_add(1);
+        });
+      }
+      pool.close(td::PromiseCreator::lambda([query_count = query_count_](td::Unit) {
+        ASSERT_EQ(QUERY_COUNT, query_count->load());
+        td::Scheduler::instance()->finish();
+      }));
+      ASSERT_TRUE(pool.empty());
+      stop();
+    }
+
+   private:
+    std::atomic<int> *query_count_;
+    std::atomic<int> *bad_query_count_;
+  };
+
+  std::atomic<int> query_count{0};
+  std::atomic<int> bad_query_count{0};
+  td::ConcurrentScheduler sched(2, 0);
+  sched.create_actor_unsafe<Main>(0, "Main", &query_count, &bad_query_count).release();
+  sched.start();
+  while (sched.run_main(10)) {
+    // empty
+  }
+  sched.finish();
+  ASSERT_EQ(QUERY_COUNT, query_count.load());
+  ASSERT_EQ(0, bad_query_count.load());
+}
+
+TEST(DB, sqlite_checkpointer) {
+  class Main final : public td::Actor {
+   public:
+    explicit Main(td::string path) : path_(std::move(path)) {
+    }
+
+    void start_up() final {
+      connection_ = std::make_shared<td::SqliteConnectionSafe>(path_, td::DbKey::empty());
+      td::SqliteConnectionSafe::Options options;
+      options.mmap_size = 1 << 20;
+      options.cache_size = 1024;
+      options.wal_autocheckpoint = 10;
+      options.use_background_checkpoint = true;
+      connection_->set_options(options);
+
+      auto &db = connection_->get();
+      ASSERT_EQ(-1024, db.get_pragma_int64("cache_size").ok());
+      // automatic checkpoints are replaced with the commit callback
+      ASSERT_EQ(0, db.get_pragma_int64("wal_autocheckpoint").ok());
+      write(0);
+
+      checkpointer_ = td::make_unique<td::SqliteCheckpointer>(connection_, 1);
+      set_timeout_in(1.5);
+    }
+
+    void write(int from) {
+      auto &db = connection_->get();
+      db.begin_write_transaction().ensure();
+      for (int i = from; i < from + 100; i++) {
+        db.exec(PSLICE() << "INSERT INTO t VALUES (" << i << ", randomblob(1000))").ensure();
+      }
+      db.commit_transaction().ensure();
+    }
+
+    void timeout_expired() final {
+      auto statistics = checkpointer_->get_statistics();
+      LOG(INFO) << statistics;
+      ASSERT_TRUE(statistics.wal_frame_count > 0);
+      ASSERT_TRUE(statistics.wal_size > 0);
+      if (checkpoint_count_ == 0) {
+        // WAL left before the checkpointer was created is checkpointed on start
+        ASSERT_EQ(1u, statistics.checkpoint_count);
+        checkpoint_count_ = statistics.checkpoint_count;
+        write(100);
+        set_timeout_in(1.5);
+        return;
+      }
+      // the commit has woken up the checkpointer
+      ASSERT_EQ(checkpoint_count_ + 1, statistics.checkpoint_count);
+
+      checkpointer_->close(td::PromiseCreator::lambda([connection = std::move(connection_)](td::Unit) mutable {
+        ASSERT_TRUE(connection.unique());
+        connection->close();
+        td::Scheduler::instance()->finish();
+      }));
+      checkpointer_.reset();
+      stop();
+    }
+
+   private:
+    td::string path_;
+    std::shared_ptr<td::SqliteConnectionSafe> connection_;
+    td::unique_ptr<td::SqliteCheckpointer> checkpointer_;
+    td::uint64 checkpoint_count_ = 0;
+  };
+
+  td::string path = "test_sqlite_db";
+  td::SqliteDb::destroy(path).ignore();
+  {
+    auto db = td::SqliteDb::open_with_key(path, true, td::DbKey::empty()).move_as_ok();
+    db.exec("CREATE TABLE t (k INTEGER PRIMARY KEY, v BLOB)").ensure();
+  }
+  td::ConcurrentScheduler sched(1, 0);
+  sched.create_actor_unsafe<Main>(0, "Main", path).release();
+  sched.start();
+  while (sched.run_main(10)) {
+    // empty
+  }
+  sched.finish();
+  td::SqliteDb::destroy(path).ignore();
+}
+
 TEST(DB, sqlite_lfs) {
   td::string path = "test_sqlite_db";
   td::SqliteDb::destroy(path).ignore();
@@ -147,6 +795,87 @@ TEST(DB, sqlite_lfs) {
   td::SqliteDb::destroy(path).ignore();
 }
 
+TEST(DB, sqlite_statement_cache) {
+  td::string path = "test_sqlite_db";
+  td::SqliteDb::destroy(path).ignore();
+  {
+    auto db = td::SqliteDb::open_with_key(path, true, td::DbKey::empty()).move_as_ok();
+    db.exec("CREATE TABLE t (k INTEGER PRIMARY KEY, v BLOB)").ensure();
+    auto base_statistics = db.get_statement_cache_statistics();
+
+    td::CSlice insert_query = "INSERT INTO t VALUES (?1, ?2)";
+    for (int i = 1; i <= 10; i++) {
+      auto stmt = db.get_cached_statement(insert_query).move_as_ok();
+      stmt.bind_int32(1, i).ensure();
+      if (i != 10) {
+        stmt.bind_blob(2, "value").ensure();
+      }
+      stmt.step().ensure();
+    }
+    auto statistics = db.get_statement_cache_statistics();
+    ASSERT_EQ(base_statistics.miss_count + 1, statistics.miss_count);
+    ASSERT_EQ(base_statistics.hit_count + 9, statistics.hit_count);
+
+    {
+      // parameters must be cleared when the statement is returned to the cache
+      auto stmt = db.get_cached_statement("SELECT COUNT(*) FROM t WHERE v IS NULL").move_as_ok();
+      stmt.step().ensure();
+      ASSERT_EQ(1, stmt.view_int32(0));
+    }
+
+    {
+      auto stmt1 = db.get_cached_statement("SELECT v FROM t WHERE k = ?1").move_as_ok();
+      auto stmt2 = db.get_cached_statement("SELECT v FROM t WHERE k = ?1").move_as_ok();
+      stmt1.bind_int32(1, 1).ensure();
+      stmt2.bind_int32(1, 2).ensure();
+      stmt1.step().ensure();
+      stmt2.step().ensure();
+      ASSERT_TRUE(stmt1.has_row());
+      ASSERT_TRUE(stmt2.has_row());
+      ASSERT_EQ("value", stmt1.view_blob(0));
+    }
+
+    for (int i = 0; i < 100; i++) {
+      auto stmt = db.get_cached_statement(PSLICE() << "SELECT v FROM t WHERE k = " << i).move_as_ok();
+      stmt.step().ensure();
+    }
+    statistics = db.get_statement_cache_statistics();
+    LOG(INFO) << statistics;
+    ASSERT_TRUE(statistics.size <= 64u);
+    db.get_cached_statement("SELECT v FROM t WHERE k = 99").move_as_ok();
+    ASSERT_EQ(statistics.hit_count + 1, db.get_statement_cache_statistics().hit_count);
+  }
+  td::SqliteDb::destroy(path).ignore();
+}
+
+TEST(DB, sqlite_write_batcher) {
+  td::SqliteWriteBatcher batcher;
+
+  // a query to an idle database must be committed without delay
+  ASSERT_TRUE(!batcher.add_query());
+  ASSERT_TRUE(batcher.get_commit_time() <= td::Time::now());
+  while (!batcher.add_query()) {
+  }
+  ASSERT_EQ(50u, batcher.get_pending_query_count());
+  batcher.commit([] {});
+  ASSERT_EQ(0u, batcher.get_pending_query_count());
+
+  // commits are cheap, so the batch size must grow, but queries must wait a bit for other queries
+  ASSERT_TRUE(!batcher.add_query());
+  ASSERT_TRUE(batcher.get_commit_time() > td::Time::now_cached());
+  while (!batcher.add_query()) {
+  }
+  auto batch_size = batcher.get_pending_query_count();
+  ASSERT_TRUE(batch_size > 50u);
+  batcher.commit([] {});
+
+  auto statistics = batcher.get_statistics();
+  LOG(INFO) << statistics;
+  ASSERT_EQ(2u, statistics.transaction_count);
+  ASSERT_EQ(50u + batch_size, statistics.query_count);
+  ASSERT_EQ(batch_size, statistics.max_batch_size);
+}
+
 TEST(DB, sqlite_encryption) {
   td::string path = "test_sqlite_db";
   td::SqliteDb::destroy(path).ignore();
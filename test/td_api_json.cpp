@@ -0,0 +1,288 @@
+//
+// Copyright Aliaksei Levin (levlam@telegram.org), Arseny Smirnov (arseny30@gmail.com) 2014-2023
+//
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+#include "data.h"
+
+#include "td/telegram/td_api.h"
+#include "td/telegram/td_api_json.h"
+
+#include "td/utils/common.h"
+#include "td/utils/JsonBuilder.h"
+#include "td/utils/logging.h"
+#include "td/utils/Random.h"
+#include "td/utils/Slice.h"
+#include "td/utils/Status.h"
+#include "td/utils/tests.h"
+
+#include <utility>
+
+static td::Result<std::pair<td::string, td::string>> decode_request_slow(td::Slice request) {
+  auto request_str = request.str();
+  TRY_RESULT(json_value, td::json_decode(request_str));
+  if (json_value.type() != td::JsonValue::Type::Object) {
+    return td::Status::Error("Expected a JSON object");
+  }
+  td::string extra;
+  if (td::has_json_object_field(json_value.get_object(), "@extra")) {
+    extra = td::json_encode<td::string>(
+        td::get_json_object_field(json_value.get_object(), "@extra", td::JsonValue::Type::Null).move_as_ok());
+  }
+  td::td_api::object_ptr<td::td_api::Function> func;
+  TRY_STATUS(td::td_api::from_json(func, std::move(json_value)));
+  return std::make_pair(td::td_api::to_string(func), std::move(extra));
+}
+
+static bool check_request(td::Slice request) {
+  auto request_str = request.str();
+  td::td_api::object_ptr<td::td_api::Function> func;
+  td::string extra;
+  auto status = td::td_api::from_json(func, request_str, extra);
+  auto r_expected = decode_request_slow(request);
+  if (status.is_error()) {
+    if (r_expected.is_ok()) {
+      LOG(FATAL) << "Failed to decode valid request " << request << ": " << status;
+    }
+    return false;
+  }
+  if (r_expected.is_error()) {
+    LOG(FATAL) << "Decoded invalid request " << request << ": " << r_expected.error();
+  }
+  auto result = std::make_pair(td::td_api::to_string(func), std::move(extra));
+  if (result != r_expected.ok()) {
+    LOG(FATAL) << "Receive " << result.first << " with extra " << result.second << " instead of "
+               << r_expected.ok().first << " with extra " << r_expected.ok().second << " from " << request;
+  }
+  return true;
+}
+
+static const td::vector<td::string> &get_test_requests() {
+  static const td::vector<td::string> requests = [] {
+    td::vector<td::string> result{
+        R"({"@type":"getMe"})",
+        R"( { "@type" : "getChat" , "chat_id" : 123456789 , "@extra" : { "a" : [ 1 , "b" , null ] } } )",
+        R"({"@type":"getChat","chat_id":"-1001234567890","@extra":"A\n","@extra":5})",
+        R"({"@type":"getChat","@extra":1.5e10,"chat_id":null,"chat_id":12})",
+        R"({"@type":"getOption","name":"my_id","unknown":[{"x":[]},{}]})",
+        R"({"@type":"getOption","name":"😀 \"quoted\" \\ \/"})",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListArchive"},"limit":"100"})",
+        R"({"@type":"getChats","chat_list":{"chat_list_id":5,"@type":"chatListFolder"},"limit":100})",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListFolder","chat_list_id":1.5},"limit":100})",
+        R"({"@type":"getChats","chat_list":null,"limit":true})",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListUnknown"}})",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListMain","@type":"chatListArchive"}})",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListFolder","chat_list_id":1,"chat_list_id":2}})",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListMain"},"limit":100} )",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListMain"},"limit":100}})",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListMain"},"limit":100,})",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListMain"} "limit":100})",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListMain"},"limit":2147483648})",
+        R"({"@type":"getChats","chat_list":{"@type":"chatListMain"},"limit":[100]})",
+        R"({"@type":"getChats","chat_list":"chatListMain","limit":100})",
+        R"({"@type":"getChatHistory","chat_id":1,"from_message_id":2,"offset":-3,"limit":4,"only_local":1})",
+        R"({"@type":"getMessages","chat_id":1,"message_ids":[1,"2",3e0,null]})",
+        R"({"@type":"getMessages","chat_id":1,"message_ids":[]})",
+        R"({"@type":"getMessages","chat_id":1,"message_ids":[[1]]})",
+        R"({"@type":"getMessages","chat_id":1,"message_ids":{}})",
+        R"({"chat_id":1,"@type":"getMessages","message_ids":[1,2]})",
+        R"({"@type":"setTdlibParameters","use_test_dc":false,"database_directory":"tdlib","files_directory":"",)"
+        R"("database_encryption_key":"YWJjZA==","use_file_database":true,"use_chat_info_database":true,)"
+        R"("use_message_database":true,"use_secret_chats":true,"api_id":94575,)"
+        R"("api_hash":"a3406de8d171bb422bb6ddf3bbd800e2","system_language_code":"en","device_model":"Desktop",)"
+        R"("system_version":"Linux","application_version":"1.0","enable_storage_optimizer":true,)"
+        R"("ignore_file_names":false})",
+        R"({"@type":"setTdlibParameters","database_encryption_key":"not base64"})",
+        R"({"@type":"checkDatabaseEncryptionKey","encryption_key":"YWJjZA"})",
+        R"({"@type":"sendMessage","chat_id":123456789,"message_thread_id":0,"reply_to":{"@type":)"
+        R"("messageReplyToMessage","chat_id":123456789,"message_id":1048576},"options":{"@type":"messageSendOptions",)"
+        R"("disable_notification":false,"from_background":false,"protect_content":false,"sending_id":0},)"
+        R"("input_message_content":{"@type":"inputMessageText","text":{"@type":"formattedText","text":"Hello",)"
+        R"("entities":[{"@type":"textEntity","offset":0,"length":5,"type":{"@type":"textEntityTypeBold"}},)"
+        R"({"offset":1,"length":2,"type":{"url":"https://t.me","@type":"textEntityTypeTextUrl"}},)"
+        R"({"@type":"textEntity","offset":0,"length":1,"type":null}]},"disable_web_page_preview":true},"@extra":42})",
+        R"({"@type":"sendMessage","input_message_content":{"@type":"inputMessageText","text":{"text":"a"}}})",
+        R"({"@type":"sendMessage","options":{"@type":"inputMessageText","disable_notification":true}})"};
+
+    for (int depth : {99, 100, 101}) {
+      td::string deep_array(depth, '[');
+      deep_array += td::string(depth, ']');
+      result.push_back(R"({"@type":"getChat","@extra":)" + deep_array + "}");
+      result.push_back(R"({"@type":"getChats","chat_list":{"@type":"chatListMain","x":)" + deep_array + "}}");
+    }
+
+    td::string deep_text = R"({"@type":"formattedText","text":"a"})";
+    for (int i = 0; i < 60; i++) {
+      deep_text = R"({"@type":"inputMessageText","text":{"@type":"formattedText","text":"b"},"x":)" + deep_text + "}";
+    }
+    result.push_back(R"({"@type":"sendMessage","input_message_content":)" + deep_text + "}");
+    return result;
+  }();
+  return requests;
+}
+
+TEST(TdApiJson, from_json) {
+  int decoded_count = 0;
+  for (auto &request : get_test_requests()) {
+    if (check_request(request)) {
+      decoded_count++;
+    }
+  }
+  ASSERT_EQ(23, decoded_count);
+
+  ASSERT_TRUE(check_request(R"({"chat_id":1,"@type":"getChat"})"));
+  ASSERT_TRUE(check_request(R"({"@extra":1,"@type":"getChat","@extra":2})"));
+  ASSERT_TRUE(!check_request(R"([{"@type":"getChat"}])"));
+
+  td::string request = R"({"@type":"getChat","chat_id":1,"@extra":2,"chat_id":3,"@extra":4})";
+  td::td_api::object_ptr<td::td_api::Function> func;
+  td::string extra;
+  ASSERT_TRUE(td::td_api::from_json(func, request, extra).is_ok());
+  ASSERT_EQ(1, static_cast<const td::td_api::getChat *>(func.get())->chat_id_);
+  ASSERT_STREQ("2", extra);
+}
+
+TEST(TdApiJson, from_json_fuzz) {
+  const td::string symbols = R"({}[]":,\ 0123456789aeflnrstu@-+.)";
+  auto &requests = get_test_requests();
+  for (int i = 0; i < 100000; i++) {
+    auto request = requests[td::Random::fast(0, static_cast<int>(requests.size()) - 1)];
+    auto mutation_count = td::Random::fast(1, 3);
+    for (int j = 0; j < mutation_count; j++) {
+      auto pos = static_cast<size_t>(td::Random::fast(0, static_cast<int>(request.size()) - 1));
+      auto c = symbols[td::Random::fast(0, static_cast<int>(symbols.size()) - 1)];
+      switch (td::Random::fast(0, 2)) {
+        case 0:
+          request[pos] = c;
+          break;
+        case 1:
+          request.insert(pos, 1, c);
+          break;
+        case 2:
+          request.erase(pos, 1);
+          break;
+      }
+    }
+    check_request(request);
+  }
+}
+
+static td::td_api::object_ptr<td::td_api::formattedText> get_formatted_text(td::string text, bool with_entities) {
+  td::vector<td::td_api::object_ptr<td::td_api::textEntity>> entities;
+  if (with_entities) {
+    entities.push_back(
+        td::td_api::make_object<td::td_api::textEntity>(0, 5, td::td_api::make_object<td::td_api::textEntityTypeBold>()));
+    entities.push_back(td::td_api::make_object<td::td_api::textEntity>(
+        6, 12, td::td_api::make_object<td::td_api::textEntityTypeTextUrl>("https://telegram.org/blog")));
+  }
+  return td::td_api::make_object<td::td_api::formattedText>(std::move(text), std::move(entities));
+}
+
+static td::td_api::object_ptr<td::td_api::file> get_file(td::int32 id, td::int64 size) {
+  auto file = td::td_api::make_object<td::td_api::file>();
+  file->id_ = id;
+  file->size_ = size;
+  file->expected_size_ = size;
+  file->local_ = td::td_api::make_object<td::td_api::localFile>();
+  file->remote_ = td::td_api::make_object<td::td_api::remoteFile>(
+      "AgACAgIAAxkBAAIBZ2S7Hk3u1wABbZ6TkQABv1m9hQqTBkQAAmTNMRtF0ehJb9sL2jWZm9wBAAMCAAN5AAMvBA", "AQADZM0xG0XR6El-", false,
+      true, size);
+  return file;
+}
+
+static td::td_api::object_ptr<td::td_api::message> get_message(td::int64 id,
+                                                               td::td_api::object_ptr<td::td_api::MessageContent> content) {
+  auto message = td::td_api::make_object<td::td_api::message>();
+  message->id_ = id << 20;
+  message->sender_id_ = td::td_api::make_object<td::td_api::messageSenderUser>(1234567890);
+  message->chat_id_ = -1001234567890;
+  message->can_be_forwarded_ = true;
+  message->can_be_saved_ = true;
+  message->can_be_deleted_only_for_self_ = true;
+  message->can_get_message_thread_ = true;
+  message->is_channel_post_ = true;
+  message->date_ = 1690000000 + static_cast<td::int32>(id);
+  message->self_destruct_in_ = 0.0;
+  message->auto_delete_in_ = 86400.0;
+  message->media_album_id_ = 13678523478126348;
+
+  auto interaction_info = td::td_api::make_object<td::td_api::messageInteractionInfo>();
+  interaction_info->view_count_ = 123456;
+  interaction_info->forward_count_ = 789;
+  interaction_info->reactions_.push_back(td::td_api::make_object<td::td_api::messageReaction>(
+      td::td_api::make_object<td::td_api::reactionTypeEmoji>("\xF0\x9F\x91\x8D"), 1024, false,
+      td::vector<td::td_api::object_ptr<td::td_api::MessageSender>>()));
+  message->interaction_info_ = std::move(interaction_info);
+  message->content_ = std::move(content);
+  return message;
+}
+
+// a set of objects, resembling updates received by a client subscribed to several channels
+static const td::vector<td::td_api::object_ptr<td::td_api::Object>> &get_test_objects() {
+  static const td::vector<td::td_api::object_ptr<td::td_api::Object>> objects = [] {
+    td::vector<td::td_api::object_ptr<td::td_api::Object>> result;
+    td::string english_text;
+    td::string russian_text;
+    for (int i = 0; i < 10; i++) {
+      english_text +=
+          "Hello world! Telegram is a cloud-based mobile and desktop messaging app with a focus on security and "
+          "speed. See \"https://telegram.org/faq\" for details.\n";
+      russian_text +=
+          "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82, \xD0\xBC\xD0\xB8\xD1\x80! "
+          "\xD0\xAD\xD1\x82\xD0\xBE \xD1\x82\xD0\xB5\xD1\x81\xD1\x82\xD0\xBE\xD0\xB2\xD0\xBE\xD0\xB5 "
+          "\xD1\x81\xD0\xBE\xD0\xBE\xD0\xB1\xD1\x89\xD0\xB5\xD0\xBD\xD0\xB8\xD0\xB5 \xF0\x9F\x98\x80\n";
+    }
+
+    result.push_back(td::td_api::make_object<td::td_api::updateNewMessage>(get_message(
+        1, td::td_api::make_object<td::td_api::messageText>(get_formatted_text(english_text, true), nullptr))));
+    result.push_back(td::td_api::make_object<td::td_api::updateNewMessage>(get_message(
+        2, td::td_api::make_object<td::td_api::messageText>(get_formatted_text(russian_text, true), nullptr))));
+
+    auto photo = td::td_api::make_object<td::td_api::photo>();
+    photo->minithumbnail_ =
+        td::td_api::make_object<td::td_api::minithumbnail>(40, 40, td::string(thumbnail, thumbnail_size));
+    photo->sizes_.push_back(td::td_api::make_object<td::td_api::photoSize>("m", get_file(101, 15309), 320, 320,
+                                                                           td::vector<td::int32>()));
+    photo->sizes_.push_back(td::td_api::make_object<td::td_api::photoSize>(
+        "y", get_file(102, 152342), 1280, 1280, td::vector<td::int32>{10152, 35721, 80834, 118563}));
+    result.push_back(td::td_api::make_object<td::td_api::updateNewMessage>(
+        get_message(3, td::td_api::make_object<td::td_api::messagePhoto>(
+                           std::move(photo), get_formatted_text("Photo of the day", false), false, false))));
+
+    result.push_back(td::td_api::make_object<td::td_api::updateNewMessage>(
+        get_message(4, td::td_api::make_object<td::td_api::messageLocation>(
+                           td::td_api::make_object<td::td_api::location>(51.507351, -0.127758, 16.25), 900, 897, 0, 0))));
+
+    for (int i = 0; i < 4; i++) {
+      result.push_back(td::td_api::make_object<td::td_api::updateUserStatus>(
+          1000000000 + i, td::td_api::make_object<td::td_api::userStatusOnline>(1690000300 + i)));
+    }
+    return result;
+  }();
+  return objects;
+}
+
+TEST(TdApiJson, to_json) {
+  for (auto &object : get_test_objects()) {
+    auto json = td::json_encode<td::string>(td::ToJson(*object));
+    auto json_copy = json;
+    auto r_json_value = td::json_decode(json_copy);
+    ASSERT_TRUE(r_json_value.is_ok());
+    ASSERT_EQ(json, td::json_encode<td::string>(r_json_value.ok()));
+  }
+
+  for (size_t i = 0; i < 2; i++) {
+    auto json = td::json_encode<td::string>(td::ToJson(*get_test_objects()[i]));
+    auto r_json_value = td::json_decode(json);
+    ASSERT_TRUE(r_json_value.is_ok());
+    auto json_value = r_json_value.move_as_ok();
+    auto message = td::get_json_object_field_force(json_value.get_object(), "message");
+    ASSERT_EQ(-1001234567890, td::get_json_object_long_field(message.get_object(), "chat_id").move_as_ok());
+    auto content = td::get_json_object_field_force(message.get_object(), "content");
+    auto text = td::get_json_object_field_force(content.get_object(), "text");
+    auto &expected_update = static_cast<const td::td_api::updateNewMessage &>(*get_test_objects()[i]);
+    auto &expected_content = static_cast<const td::td_api::messageText &>(*expected_update.message_->content_);
+    ASSERT_EQ(expected_content.text_->text_, td::get_json_object_string_field(text.get_object(), "text").move_as_ok());
+  }
+}